@@ -35,15 +35,129 @@
 
 #include "LoadHDF5FileDialog.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <QtConcurrent>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QLocale>
+#include <QtCore/QMutexLocker>
+#include <QtGui/QPixmap>
+
 #include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
 
 #include "SIMPLVtkLib/Dialogs/Utilities/DREAM3DFileTreeModel.h"
 
+namespace
+{
+const int PreviewSize = 192;
+
+/**
+ * @brief Converts the preview values to an image.  Three component uint8_t arrays are shown as
+ * colors and other arrays show their first component scaled to their range.
+ * @param values
+ * @param width
+ * @param height
+ * @param arrayInfo
+ * @return
+ */
+QImage CreatePreviewImage(const std::vector<double>& values, size_t width, size_t height, const VSImageArrayInfo& arrayInfo)
+{
+  size_t numComps = arrayInfo.getNumberOfComponents();
+  bool rgb = (numComps == 3 && arrayInfo.m_TypeName == "uint8_t");
+
+  QImage image(static_cast<int>(width), static_cast<int>(height), rgb ? QImage::Format_RGB888 : QImage::Format_Grayscale8);
+  if(rgb)
+  {
+    for(size_t y = 0; y < height; y++)
+    {
+      uchar* line = image.scanLine(static_cast<int>(y));
+      for(size_t i = 0; i < width * 3; i++)
+      {
+        line[i] = static_cast<uchar>(values[y * width * 3 + i]);
+      }
+    }
+  }
+  else
+  {
+    double min = std::numeric_limits<double>::max();
+    double max = std::numeric_limits<double>::lowest();
+    for(size_t i = 0; i < width * height; i++)
+    {
+      double value = values[i * numComps];
+      if(std::isfinite(value))
+      {
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+    }
+
+    double scale = (max > min) ? 255.0 / (max - min) : 0.0;
+    for(size_t y = 0; y < height; y++)
+    {
+      uchar* line = image.scanLine(static_cast<int>(y));
+      for(size_t x = 0; x < width; x++)
+      {
+        double value = values[(y * width + x) * numComps];
+        line[x] = std::isfinite(value) ? static_cast<uchar>((value - min) * scale) : 0;
+      }
+    }
+  }
+
+  // Y increases upwards in the viewer
+  return image.mirrored(false, true);
+}
+
+/**
+ * @brief Returns the number of bytes as a readable string
+ * @param bytes
+ * @return
+ */
+QString FormatBytes(double bytes)
+{
+  QLocale locale;
+  const double megabyte = 1024.0 * 1024.0;
+  if(bytes >= 1024.0 * megabyte)
+  {
+    return QObject::tr("%1 GB").arg(locale.toString(bytes / (1024.0 * megabyte), 'f', 1));
+  }
+
+  return QObject::tr("%1 MB").arg(locale.toString(bytes / megabyte, 'f', 1));
+}
+
+/**
+ * @brief Returns the number of seconds as a readable string
+ * @param seconds
+ * @return
+ */
+QString FormatSeconds(double seconds)
+{
+  QLocale locale;
+  if(seconds < 1.0)
+  {
+    return QObject::tr("less than a second");
+  }
+  if(seconds < 60.0)
+  {
+    return QObject::tr("%1 s").arg(locale.toString(seconds, 'f', 0));
+  }
+  if(seconds < 3600.0)
+  {
+    return QObject::tr("%1 min").arg(locale.toString(seconds / 60.0, 'f', 1));
+  }
+
+  return QObject::tr("%1 h").arg(locale.toString(seconds / 3600.0, 'f', 1));
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 LoadHDF5FileDialog::LoadHDF5FileDialog(QWidget* parent)
 : QDialog(parent)
+, m_PreviewWatcher(this)
+, m_PreviewGeneration(new std::atomic<int>(0))
 {
   setupUi(this);
 
@@ -55,6 +169,8 @@ LoadHDF5FileDialog::LoadHDF5FileDialog(QWidget* parent)
 // -----------------------------------------------------------------------------
 LoadHDF5FileDialog::~LoadHDF5FileDialog()
 {
+  // A preview still being read finishes on its own without waiting on the dialog
+  (*m_PreviewGeneration)++;
 }
 
 // -----------------------------------------------------------------------------
@@ -108,11 +224,28 @@ void LoadHDF5FileDialog::setupGui()
 
   treeView->setModel(model);
 
-  connect(loadBtn, &QPushButton::clicked, [=] { accept(); });
+  // Previews are read on a separate thread and only shown for the current selection
+  connect(treeView->selectionModel(), &QItemSelectionModel::currentChanged, [=](const QModelIndex& current) { updatePreview(current); });
+  connect(&m_PreviewWatcher, &QFutureWatcher<PreviewResult>::finished, [=] { previewFinished(); });
+  clearPreview(tr("Select an ImageGeom array to preview it."));
+
+  connect(loadBtn, &QPushButton::clicked, [=] { loadWhenPreviewFinished(); });
 
   connect(cancelBtn, &QPushButton::clicked, [=] { reject(); });
 
   loadBtn->setDisabled(true);
+
+  // Slice-only data is never read as a whole volume, so it cannot be refined or cropped
+  connect(sliceOnlyCB, &QCheckBox::toggled, [=](bool checked) {
+    progressiveCB->setDisabled(checked);
+    regionGroupBox->setDisabled(checked);
+  });
+  connect(progressiveCB, &QCheckBox::toggled, [=](bool checked) { sliceOnlyCB->setDisabled(checked); });
+
+  // The region of interest is only available once an ImageGeom has been found in the file
+  regionGroupBox->setVisible(false);
+  progressiveCB->setVisible(false);
+  sliceOnlyCB->setVisible(false);
 }
 
 // -----------------------------------------------------------------------------
@@ -124,6 +257,7 @@ void LoadHDF5FileDialog::setProxy(DataContainerArrayProxy proxy)
   if(model != nullptr)
   {
     model->populateTreeWithProxy(proxy);
+    updateImageRegionRange(proxy);
     selectAllCB->setChecked(true);
 
     QModelIndexList indexes = model->match(model->index(0, 0), Qt::DisplayRole, "*", -1, Qt::MatchWildcard | Qt::MatchRecursive);
@@ -148,3 +282,306 @@ DataContainerArrayProxy LoadHDF5FileDialog::getDataStructureProxy()
 
   return model->getModelProxy();
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LoadHDF5FileDialog::setFilePath(const QString& filePath)
+{
+  m_FilePath = filePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LoadHDF5FileDialog::updateImageRegionRange(const DataContainerArrayProxy& proxy)
+{
+  size_t dims[3] = {0, 0, 0};
+  bool hasImageGeom = false;
+  if(false == m_FilePath.isEmpty())
+  {
+    for(const DataContainerProxy& dcProxy : proxy.dataContainers)
+    {
+      if(dcProxy.dcType != static_cast<unsigned int>(IGeometry::Type::Image))
+      {
+        continue;
+      }
+
+      ImageGeom::Pointer geom = VSImageRegionReader::ReadImageGeometry(m_FilePath, dcProxy.name);
+      if(nullptr == geom)
+      {
+        continue;
+      }
+
+      std::tuple<size_t, size_t, size_t> geomDims = geom->getDimensions();
+      dims[0] = std::max(dims[0], std::get<0>(geomDims));
+      dims[1] = std::max(dims[1], std::get<1>(geomDims));
+      dims[2] = std::max(dims[2], std::get<2>(geomDims));
+      hasImageGeom = true;
+    }
+  }
+
+  regionWidget->setDimensions(dims);
+  regionGroupBox->setChecked(false);
+  regionGroupBox->setVisible(hasImageGeom);
+  progressiveCB->setVisible(hasImageGeom);
+  sliceOnlyCB->setVisible(hasImageGeom);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LoadHDF5FileDialog::updatePreview(const QModelIndex& index)
+{
+  int generation = ++(*m_PreviewGeneration);
+
+  DREAM3DFileTreeModel* model = static_cast<DREAM3DFileTreeModel*>(treeView->model());
+  if(nullptr == model || false == index.isValid() || m_FilePath.isEmpty())
+  {
+    clearPreview(tr("Select an ImageGeom array to preview it."));
+    return;
+  }
+
+  // Selecting a Data Container previews its first cell array
+  QString dcName;
+  QString amName;
+  QString arrayName;
+  DREAM3DFileItem::ItemType itemType = model->itemType(index);
+  if(itemType == DREAM3DFileItem::ItemType::DataArray)
+  {
+    QModelIndex amIndex = index.parent();
+    dcName = model->data(amIndex.parent(), Qt::DisplayRole).toString();
+    amName = model->data(amIndex, Qt::DisplayRole).toString();
+    arrayName = model->data(index, Qt::DisplayRole).toString();
+  }
+  else if(itemType == DREAM3DFileItem::ItemType::DataContainer)
+  {
+    dcName = model->data(index, Qt::DisplayRole).toString();
+  }
+
+  DataContainerArrayProxy proxy = model->getModelProxy();
+  DataContainerProxy dcProxy = proxy.dataContainers.value(dcName);
+
+  PreviewRequest request;
+  request.m_FilePath = m_FilePath;
+  request.m_DataContainer = dcName;
+  request.m_Generation = generation;
+
+  bool foundArray = false;
+  if(dcProxy.dcType == static_cast<unsigned int>(IGeometry::Type::Image))
+  {
+    if(arrayName.isEmpty())
+    {
+      DataContainerProxy allArraysProxy = dcProxy;
+      AttributeMatrixProxy::AMTypeFlags amFlags(AttributeMatrixProxy::AMTypeFlag::Cell_AMType);
+      DataArrayProxy::PrimitiveTypeFlags pFlags(DataArrayProxy::PrimitiveTypeFlag::Any_PType);
+      DataArrayProxy::CompDimsVector compDimsVector;
+      allArraysProxy.setFlags(Qt::Checked, amFlags, pFlags, compDimsVector);
+
+      QList<VSImageArrayInfo> arrays = VSImageRegionReader::GetCellArrays(allArraysProxy);
+      foundArray = (false == arrays.isEmpty());
+      if(foundArray)
+      {
+        request.m_Array = arrays.front();
+      }
+    }
+    else
+    {
+      foundArray = VSImageRegionReader::FindCellArray(dcProxy, amName, arrayName, request.m_Array);
+    }
+  }
+
+  if(false == foundArray)
+  {
+    clearPreview(tr("Previews are only available for cell arrays of ImageGeom Data Containers."));
+    return;
+  }
+
+  previewImageLabel->setPixmap(QPixmap());
+  previewImageLabel->setText(tr("Reading preview..."));
+  previewInfoLabel->clear();
+  m_PreviewWatcher.setFuture(QtConcurrent::run(&LoadHDF5FileDialog::ReadPreview, request, m_PreviewGeneration));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LoadHDF5FileDialog::PreviewResult LoadHDF5FileDialog::ReadPreview(PreviewRequest request, std::shared_ptr<std::atomic<int>> currentGeneration)
+{
+  PreviewResult result;
+  result.m_Generation = request.m_Generation;
+  result.m_Array = request.m_Array;
+
+  // Previews share the process-wide HDF5 lock and requests replaced while waiting for it are never read
+  QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
+  if(*currentGeneration != request.m_Generation)
+  {
+    result.m_Cancelled = true;
+    return result;
+  }
+
+  ImageGeom::Pointer geom = VSImageRegionReader::ReadImageGeometry(request.m_FilePath, request.m_DataContainer);
+  if(nullptr == geom)
+  {
+    result.m_ErrorMessage = QObject::tr("The geometry of '%1' could not be read.").arg(request.m_DataContainer);
+    return result;
+  }
+
+  std::tuple<size_t, size_t, size_t> geomDims = geom->getDimensions();
+  result.m_Dims[0] = std::get<0>(geomDims);
+  result.m_Dims[1] = std::get<1>(geomDims);
+  result.m_Dims[2] = std::get<2>(geomDims);
+  if(result.m_Dims[0] == 0 || result.m_Dims[1] == 0 || result.m_Dims[2] == 0)
+  {
+    result.m_ErrorMessage = QObject::tr("'%1' does not contain any voxels.").arg(request.m_DataContainer);
+    return result;
+  }
+
+  size_t stride = std::max<size_t>(1, (std::max(result.m_Dims[0], result.m_Dims[1]) + PreviewSize - 1) / PreviewSize);
+  size_t midSlice = result.m_Dims[2] / 2;
+
+  VSImageRegion region;
+  region.m_Min[0] = 0;
+  region.m_Min[1] = 0;
+  region.m_Min[2] = midSlice;
+  region.m_Max[0] = result.m_Dims[0] - 1;
+  region.m_Max[1] = result.m_Dims[1] - 1;
+  region.m_Max[2] = midSlice;
+  region.m_Stride[0] = stride;
+  region.m_Stride[1] = stride;
+
+  size_t previewDims[3];
+  region.getDimensions(previewDims);
+  result.m_PreviewDims[0] = previewDims[0];
+  result.m_PreviewDims[1] = previewDims[1];
+
+  QElapsedTimer timer;
+  timer.start();
+  std::vector<double> values;
+  if(false == VSImageRegionReader::ReadArrayRegionValues(request.m_FilePath, request.m_DataContainer, request.m_Array, region, values, result.m_ErrorMessage))
+  {
+    return result;
+  }
+  result.m_ReadSeconds = timer.nsecsElapsed() / 1.0e9;
+  locker.unlock();
+
+  // Strided reads still pull each sampled row from disk
+  result.m_BytesScanned = previewDims[1] * result.m_Dims[0] * request.m_Array.getNumberOfComponents() * request.m_Array.getTypeSize();
+
+  if(*currentGeneration != request.m_Generation)
+  {
+    result.m_Cancelled = true;
+    return result;
+  }
+
+  result.m_Image = CreatePreviewImage(values, previewDims[0], previewDims[1], request.m_Array);
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LoadHDF5FileDialog::loadWhenPreviewFinished()
+{
+  // The file is read right after the dialog closes and HDF5 may not be used from two threads at once.
+  // Any preview still being read is cancelled and the dialog closes once its thread has finished.
+  (*m_PreviewGeneration)++;
+  if(false == m_PreviewWatcher.isRunning())
+  {
+    accept();
+    return;
+  }
+
+  m_LoadPending = true;
+  loadBtn->setDisabled(true);
+  treeView->setDisabled(true);
+  previewImageLabel->setPixmap(QPixmap());
+  previewImageLabel->setText(tr("Finishing preview..."));
+  previewInfoLabel->clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LoadHDF5FileDialog::previewFinished()
+{
+  if(m_LoadPending)
+  {
+    m_LoadPending = false;
+    accept();
+    return;
+  }
+
+  PreviewResult result = m_PreviewWatcher.result();
+  if(result.m_Cancelled || result.m_Generation != *m_PreviewGeneration)
+  {
+    return;
+  }
+  if(false == result.m_ErrorMessage.isEmpty())
+  {
+    clearPreview(result.m_ErrorMessage);
+    return;
+  }
+
+  QImage image = result.m_Image.scaled(PreviewSize, PreviewSize, Qt::KeepAspectRatio, Qt::FastTransformation);
+  previewImageLabel->setText(QString());
+  previewImageLabel->setPixmap(QPixmap::fromImage(image));
+
+  QLocale locale;
+  double voxelCount = static_cast<double>(result.m_Dims[0]) * result.m_Dims[1] * result.m_Dims[2];
+  double arrayBytes = voxelCount * result.m_Array.getNumberOfComponents() * result.m_Array.getTypeSize();
+
+  QStringList lines;
+  lines.push_back(QString("<b>%1</b>").arg(result.m_Array.m_Name.toHtmlEscaped()));
+  lines.push_back(tr("Volume: %1 x %2 x %3").arg(locale.toString(static_cast<qulonglong>(result.m_Dims[0]))).arg(locale.toString(static_cast<qulonglong>(result.m_Dims[1]))).arg(locale.toString(static_cast<qulonglong>(result.m_Dims[2]))));
+  lines.push_back(tr("Preview: %1 x %2 of Z slice %3").arg(result.m_PreviewDims[0]).arg(result.m_PreviewDims[1]).arg(result.m_Dims[2] / 2));
+  lines.push_back(tr("Memory: %1").arg(FormatBytes(arrayBytes)));
+  if(result.m_ReadSeconds > 0.0 && result.m_BytesScanned > 0)
+  {
+    double bytesPerSecond = result.m_BytesScanned / result.m_ReadSeconds;
+    lines.push_back(tr("Estimated load time: %1").arg(FormatSeconds(arrayBytes / bytesPerSecond)));
+  }
+  previewInfoLabel->setText(lines.join("<br>"));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void LoadHDF5FileDialog::clearPreview(const QString& message)
+{
+  previewImageLabel->setPixmap(QPixmap());
+  previewImageLabel->setText(message);
+  previewInfoLabel->clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LoadHDF5FileDialog::useImageRegion() const
+{
+  return false == regionGroupBox->isHidden() && regionGroupBox->isChecked();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegion LoadHDF5FileDialog::getImageRegion() const
+{
+  return regionWidget->getRegion();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LoadHDF5FileDialog::useProgressiveImport() const
+{
+  return false == progressiveCB->isHidden() && progressiveCB->isEnabled() && progressiveCB->isChecked();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LoadHDF5FileDialog::useSliceOnlyImport() const
+{
+  return false == sliceOnlyCB->isHidden() && sliceOnlyCB->isEnabled() && sliceOnlyCB->isChecked();
+}
@@ -35,8 +35,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
+#include <QtCore/QFutureWatcher>
+#include <QtGui/QImage>
 #include <QtWidgets/QDialog>
 
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
+
 #include "ui_LoadHDF5FileDialog.h"
 
 class DataContainerArrayProxy;
@@ -61,10 +68,110 @@ public:
    */
   void setProxy(DataContainerArrayProxy proxy);
 
+  /**
+   * @brief Sets the file the proxy was read from.  This must be called before setProxy
+   * for the region of interest to be available for ImageGeom Data Containers.
+   * @param filePath
+   */
+  void setFilePath(const QString& filePath);
+
+  /**
+   * @brief Returns true if ImageGeom Data Containers should be read with a region of interest
+   * @return
+   */
+  bool useImageRegion() const;
+
+  /**
+   * @brief Returns the region of interest to read ImageGeom Data Containers with
+   * @return
+   */
+  VSImageRegion getImageRegion() const;
+
+  /**
+   * @brief Returns true if ImageGeom Data Containers should be read progressively from coarse to fine
+   * @return
+   */
+  bool useProgressiveImport() const;
+
+  /**
+   * @brief Returns true if only the geometry of ImageGeom Data Containers should be read and
+   * their cell arrays read from file one slice at a time
+   * @return
+   */
+  bool useSliceOnlyImport() const;
+
 protected:
+  struct PreviewRequest
+  {
+    QString m_FilePath;
+    QString m_DataContainer;
+    VSImageArrayInfo m_Array;
+    int m_Generation = 0;
+  };
+
+  struct PreviewResult
+  {
+    int m_Generation = 0;
+    bool m_Cancelled = false;
+    QString m_ErrorMessage;
+    VSImageArrayInfo m_Array;
+    QImage m_Image;
+    size_t m_Dims[3] = {0, 0, 0};
+    size_t m_PreviewDims[2] = {0, 0};
+    size_t m_BytesScanned = 0;
+    double m_ReadSeconds = 0.0;
+  };
+
   void setupGui();
 
+  /**
+   * @brief Starts reading a preview of the array selected in the tree on a separate thread.
+   * Previews still being read for earlier selections are discarded.
+   * @param index
+   */
+  void updatePreview(const QModelIndex& index);
+
+  /**
+   * @brief Shows the preview once it has been read if it is still for the current selection.
+   * Accepts the dialog instead if Load was pressed while the preview was being read.
+   */
+  void previewFinished();
+
+  /**
+   * @brief Cancels any pending preview and accepts the dialog.  If a preview is still being
+   * read, the Load button is disabled and the dialog is accepted by previewFinished.
+   */
+  void loadWhenPreviewFinished();
+
+  /**
+   * @brief Removes the preview image and shows the message instead
+   * @param message
+   */
+  void clearPreview(const QString& message);
+
+  /**
+   * @brief Reads a strided version of the middle Z slice of the requested array and converts it
+   * to an image.  Returns without reading if the request is no longer the current generation.
+   * This method is run on a separate thread by updatePreview.
+   * @param request
+   * @param currentGeneration
+   * @return
+   */
+  static PreviewResult ReadPreview(PreviewRequest request, std::shared_ptr<std::atomic<int>> currentGeneration);
+
+  /**
+   * @brief Reads the ImageGeom dimensions of the proxy's Data Containers from file and sets
+   * the range of the region of interest to the largest of them
+   * @param proxy
+   */
+  void updateImageRegionRange(const DataContainerArrayProxy& proxy);
+
 private:
+  QString m_FilePath;
+  QFutureWatcher<PreviewResult> m_PreviewWatcher;
+  std::shared_ptr<std::atomic<int>> m_PreviewGeneration;
+  bool m_LoadPending = false;
+
   LoadHDF5FileDialog(const LoadHDF5FileDialog&); // Copy Constructor Not Implemented
   void operator=(const LoadHDF5FileDialog&);     // Operator '=' Not Implemented
 };
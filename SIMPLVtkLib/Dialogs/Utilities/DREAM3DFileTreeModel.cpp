@@ -146,9 +146,10 @@ Qt::ItemFlags DREAM3DFileTreeModel::flags(const QModelIndex& index) const
   }
 
   DREAM3DFileItem* item = getItem(index);
+  // Data Containers and arrays can be selected to preview them
   if(item->getItemType() == DREAM3DFileItem::ItemType::DataContainer)
   {
-    return (Qt::ItemIsEnabled | Qt::ItemIsUserCheckable);
+    return (Qt::ItemIsEnabled | Qt::ItemIsUserCheckable | Qt::ItemIsSelectable);
   }
   else if(item->getItemType() == DREAM3DFileItem::ItemType::AttributeMatrix)
   {
@@ -156,7 +157,7 @@ Qt::ItemFlags DREAM3DFileTreeModel::flags(const QModelIndex& index) const
   }
   else if(item->getItemType() == DREAM3DFileItem::ItemType::DataArray)
   {
-    return (Qt::ItemNeverHasChildren);
+    return (Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemNeverHasChildren);
   }
 
   return QAbstractItemModel::flags(index);
@@ -111,6 +111,7 @@ void VSAbstractViewWidget::addViewSettings(VSFilterViewSettings* viewSettings)
   connect(viewSettings, &VSFilterViewSettings::showScalarBarChanged, this, &VSAbstractViewWidget::setFilterShowScalarBar);
   connect(viewSettings, &VSFilterViewSettings::requiresRender, this, &VSAbstractViewWidget::renderView);
   connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, &VSAbstractViewWidget::updateScene);
+  connect(viewSettings, &VSFilterViewSettings::swappingActors, this, &VSAbstractViewWidget::swapActors);
 
   checkFilterViewSetting(viewSettings);
 
@@ -129,6 +130,9 @@ void VSAbstractViewWidget::removeViewSettings(VSFilterViewSettings* viewSettings
   {
     changeFilterVisibility(viewSettings, false);
     checkFilterViewSetting(viewSettings);
+
+    // Released or invalid settings skip changeFilterVisibility, but their props must not stay pickable
+    removePropFilter(viewSettings->getFilter());
   }
 }
 
@@ -137,14 +141,9 @@ void VSAbstractViewWidget::removeViewSettings(VSFilterViewSettings* viewSettings
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::copyFilters(const VSFilterViewModel& filterViewModel)
 {
-  // clearFilters();
+  // VSFilterViewSettings are only created for visible filters and are added
+  // through the viewSettingsCreated signal.  Hidden filters are created on demand.
   m_FilterViewModel->deepCopy(filterViewModel);
-
-  std::vector<VSFilterViewSettings*> filterViewSettings = m_FilterViewModel->getAllFilterViewSettings();
-  for(VSFilterViewSettings* viewSettings : filterViewSettings)
-  {
-    addViewSettings(viewSettings);
-  }
 }
 
 // -----------------------------------------------------------------------------
@@ -270,9 +269,12 @@ void VSAbstractViewWidget::changeFilterVisibility(VSFilterViewSettings* viewSett
   if(filterVisible)
   {
     getVisualizationWidget()->getRenderer()->AddViewProp(viewSettings->getActor());
+    m_PropFilters[viewSettings->getActor()] = viewSettings->getFilter();
 
     if(viewSettings->isScalarBarVisible())
     {
+      // The scalar bar is recreated if the view settings released their resources
+      viewSettings->getScalarBarWidget()->SetInteractor(getVisualizationWidget()->GetInteractor());
       viewSettings->getScalarBarWidget()->SetEnabled(1);
     }
     // Do not show the grid if the filter is not visible
@@ -286,6 +288,7 @@ void VSAbstractViewWidget::changeFilterVisibility(VSFilterViewSettings* viewSett
   else
   {
     getVisualizationWidget()->getRenderer()->RemoveViewProp(viewSettings->getActor());
+    removePropFilter(viewSettings->getFilter());
     getVisualizationWidget()->getRenderer()->RemoveViewProp(viewSettings->getCubeAxesActor());
 
     if(viewSettings->isScalarBarVisible())
@@ -394,8 +397,42 @@ void VSAbstractViewWidget::setGridVisibility(const bool& gridVisible)
 // -----------------------------------------------------------------------------
 void VSAbstractViewWidget::swapActors(vtkProp3D* oldProp, vtkProp3D* newProp)
 {
+  if(nullptr == getVisualizationWidget())
+  {
+    return;
+  }
+
   getVisualizationWidget()->getRenderer()->RemoveViewProp(oldProp);
   getVisualizationWidget()->getRenderer()->AddViewProp(newProp);
+
+  VSFilterPicker::PropFilterMap::iterator iter = m_PropFilters.find(oldProp);
+  if(iter != m_PropFilters.end())
+  {
+    VSAbstractFilter* filter = iter->second;
+    m_PropFilters.erase(iter);
+    m_PropFilters[newProp] = filter;
+  }
+  m_FilterPicker.releaseProp(oldProp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractViewWidget::removePropFilter(VSAbstractFilter* filter)
+{
+  // The filter's actor may have been swapped since it was shown so match by filter
+  for(VSFilterPicker::PropFilterMap::iterator iter = m_PropFilters.begin(); iter != m_PropFilters.end();)
+  {
+    if(iter->second == filter)
+    {
+      m_FilterPicker.releaseProp(iter->first);
+      iter = m_PropFilters.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -757,6 +794,7 @@ void VSAbstractViewWidget::setController(VSController* controller)
     connect(viewSettings, &VSFilterViewSettings::showScalarBarChanged, this, &VSAbstractViewWidget::setFilterShowScalarBar);
     connect(viewSettings, &VSFilterViewSettings::requiresRender, this, &VSAbstractViewWidget::renderView);
     connect(viewSettings, &VSFilterViewSettings::actorsUpdated, this, &VSAbstractViewWidget::updateScene);
+    connect(viewSettings, &VSFilterViewSettings::swappingActors, this, &VSAbstractViewWidget::swapActors);
 
     // Check filter and scalar bar visibility
     checkFilterViewSetting(viewSettings);
@@ -786,18 +824,31 @@ VSAbstractFilter* VSAbstractViewWidget::getFilterFromProp(vtkProp3D* prop)
     return nullptr;
   }
 
-  // Compare prop with all VSFilterViewSettings to find a match
-  for(std::pair<VSAbstractFilter*, VSFilterViewSettings*> settingPair : getAllFilterViewSettings())
+  VSFilterPicker::PropFilterMap::const_iterator iter = m_PropFilters.find(prop);
+  if(iter != m_PropFilters.end())
   {
-    if(settingPair.second->getActor() == prop)
-    {
-      return settingPair.first;
-    }
+    return iter->second;
   }
 
   return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const VSFilterPicker::PropFilterMap& VSAbstractViewWidget::getVisiblePropFilters() const
+{
+  return m_PropFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterPicker* VSAbstractViewWidget::getFilterPicker()
+{
+  return &m_FilterPicker;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -41,6 +41,7 @@
 #include <QtWidgets/QFrame>
 #include <QtWidgets/QSplitter>
 
+#include "SIMPLVtkLib/QtWidgets/VSFilterPicker.h"
 #include "SIMPLVtkLib/QtWidgets/VSVisualizationWidget.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSController.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.h"
@@ -138,6 +139,18 @@ public:
    */
   virtual VSAbstractFilter* getFilterFromProp(vtkProp3D* prop);
 
+  /**
+   * @brief Returns the map of visible vtkProp3Ds to the filters that they represent
+   * @return
+   */
+  const VSFilterPicker::PropFilterMap& getVisiblePropFilters() const;
+
+  /**
+   * @brief Returns the picker used to find filters rendered in this view
+   * @return
+   */
+  VSFilterPicker* getFilterPicker();
+
   /**
    * @brief Returns the visualization filter based on the given mouse coordinates.
    * @param pos
@@ -316,6 +329,12 @@ protected:
    */
   void changeFilterVisibility(VSFilterViewSettings* settings, const bool& visibility);
 
+  /**
+   * @brief Removes any visible prop entries for the given filter
+   * @param filter
+   */
+  void removePropFilter(VSAbstractFilter* filter);
+
   /**
    * @brief changeScalarBarVisibility
    * @param settings
@@ -398,4 +417,6 @@ private:
   VSController* m_Controller = nullptr;
   bool m_BlockRender = false;
   bool m_Active = false;
+  VSFilterPicker::PropFilterMap m_PropFilters;
+  VSFilterPicker m_FilterPicker;
 };
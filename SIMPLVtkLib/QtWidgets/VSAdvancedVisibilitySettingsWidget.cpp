@@ -100,6 +100,7 @@ void VSAdvancedVisibilitySettingsWidget::connectFilterViewSettings(VSFilterViewS
 
   if(m_ViewSettings)
   {
+    m_ViewSettings->createResources();
     connect(settings, &VSFilterViewSettings::pointRenderingChanged, this, &VSAdvancedVisibilitySettingsWidget::updatePointSettingVisibility);
     connect(settings, &VSFilterViewSettings::pointSizeChanged, this, &VSAdvancedVisibilitySettingsWidget::listenPointSize);
     connect(settings, &VSFilterViewSettings::renderPointSpheresChanged, this, &VSAdvancedVisibilitySettingsWidget::listenPointSphere);
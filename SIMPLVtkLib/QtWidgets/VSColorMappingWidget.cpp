@@ -55,6 +55,7 @@ void VSColorMappingWidget::setupGui()
   m_presetsDialog = new ColorPresetsDialog();
 
   connect(m_Ui->mapScalarsComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(setScalarsMapped(int)));
+  connect(m_Ui->lookupTableComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(setLookupTableMode(int)));
   connect(m_Ui->showScalarBarComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(setScalarBarVisible(int)));
   connect(m_Ui->invertColorScaleBtn, &QPushButton::clicked, this, &VSColorMappingWidget::invertScalarBar);
   connect(m_Ui->alphaSlider, &QSlider::valueChanged, this, &VSColorMappingWidget::alphaSliderMoved);
@@ -72,6 +73,7 @@ void VSColorMappingWidget::updateViewSettingInfo()
   {
     m_Ui->showScalarBarComboBox->setCurrentIndex(static_cast<int>(VSFilterViewSettings::ScalarBarSetting::Never));
     m_Ui->mapScalarsComboBox->setCurrentIndex(static_cast<int>(VSFilterViewSettings::ColorMapping::None));
+    m_Ui->lookupTableComboBox->setCurrentIndex(static_cast<int>(VSFilterViewSettings::LookupTableMode::Automatic));
 
     this->setEnabled(false);
     return;
@@ -81,6 +83,7 @@ void VSColorMappingWidget::updateViewSettingInfo()
 
   m_Ui->showScalarBarComboBox->setCurrentIndex(static_cast<int>(m_ViewSettings->getScalarBarSetting()));
   m_Ui->mapScalarsComboBox->setCurrentIndex(static_cast<int>(m_ViewSettings->getMapColors()));
+  m_Ui->lookupTableComboBox->setCurrentIndex(static_cast<int>(m_ViewSettings->getLookupTableMode()));
   m_Ui->alphaSlider->setValue(m_ViewSettings->getAlpha() * 100);
 }
 
@@ -164,6 +167,7 @@ void VSColorMappingWidget::connectFilterViewSettings(VSFilterViewSettings* setti
 
   if(m_ViewSettings)
   {
+    m_ViewSettings->createResources();
     connect(settings, &VSFilterViewSettings::mapColorsChanged, this, &VSColorMappingWidget::listenMapColors);
     connect(settings, &VSFilterViewSettings::alphaChanged, this, &VSColorMappingWidget::listenAlpha);
     connect(settings, &VSFilterViewSettings::showScalarBarChanged, this, &VSColorMappingWidget::listenScalarBar);
@@ -183,6 +187,19 @@ void VSColorMappingWidget::setScalarsMapped(int colorMappingIndex)
   m_ViewSettings->setMapColors(static_cast<VSFilterViewSettings::ColorMapping>(colorMappingIndex));
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSColorMappingWidget::setLookupTableMode(int modeIndex)
+{
+  if(nullptr == m_ViewSettings)
+  {
+    return;
+  }
+
+  m_ViewSettings->setLookupTableMode(static_cast<VSFilterViewSettings::LookupTableMode>(modeIndex));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
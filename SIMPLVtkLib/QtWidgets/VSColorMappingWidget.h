@@ -75,6 +75,12 @@ protected slots:
    */
   void setScalarsMapped(int colorMappingIndex);
 
+  /**
+   * @brief Slot for handling user interaction with the lookupTableComboBox
+   * @param modeIndex
+   */
+  void setLookupTableMode(int modeIndex);
+
   /**
    * @brief Slot for handling user interaction with the showScalarBarCheckBox
    * @param checkState
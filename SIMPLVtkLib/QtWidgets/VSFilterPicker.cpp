@@ -0,0 +1,566 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSFilterPicker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <vtkActor.h>
+#include <vtkBox.h>
+#include <vtkCellLocator.h>
+#include <vtkIdList.h>
+#include <vtkMapper.h>
+#include <vtkMath.h>
+#include <vtkMatrix4x4.h>
+#include <vtkPolyData.h>
+#include <vtkVersion.h>
+
+// vtkStaticCellLocator was introduced in 8.1
+#if VTK_MAJOR_VERSION > 8 || (VTK_MAJOR_VERSION == 8 && VTK_MINOR_VERSION >= 1)
+#define VS_STATIC_CELL_LOCATOR
+#include <vtkStaticCellLocator.h>
+#endif
+
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSTransform.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterPicker::PickResult VSFilterPicker::pick(vtkRenderer* renderer, int pos[2], const PropFilterMap& props)
+{
+  PickResult result;
+  if(nullptr == renderer || props.empty())
+  {
+    return result;
+  }
+
+  double nearPoint[3];
+  double farPoint[3];
+  if(false == computePickRay(renderer, pos, nearPoint, farPoint))
+  {
+    return result;
+  }
+
+  std::vector<Candidate> candidates = findCandidates(props, nearPoint, farPoint);
+
+  // Test the nearest bounds first and stop once the remaining bounds start behind the current hit
+  for(const Candidate& candidate : candidates)
+  {
+    if(candidate.first > result.m_Distance)
+    {
+      break;
+    }
+
+    if(intersectProp(candidate.second, nearPoint, farPoint, candidate.first, result))
+    {
+      result.m_Filter = props.at(candidate.second);
+    }
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterPicker::ProbeResult VSFilterPicker::probe(vtkRenderer* renderer, int pos[2], const PropFilterMap& props)
+{
+  ProbeResult result;
+  if(nullptr == renderer || props.empty())
+  {
+    return result;
+  }
+
+  double nearPoint[3];
+  double farPoint[3];
+  if(false == computePickRay(renderer, pos, nearPoint, farPoint))
+  {
+    return result;
+  }
+
+  std::vector<Candidate> candidates = findCandidates(props, nearPoint, farPoint);
+  for(const Candidate& candidate : candidates)
+  {
+    if(candidate.first > result.m_Distance)
+    {
+      break;
+    }
+
+    probeFilter(candidate.second, props.at(candidate.second), nearPoint, farPoint, result);
+  }
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VSFilterPicker::Candidate> VSFilterPicker::findCandidates(const PropFilterMap& props, const double nearPoint[3], const double farPoint[3])
+{
+  double origin[3] = {nearPoint[0], nearPoint[1], nearPoint[2]};
+  double direction[3];
+  for(int i = 0; i < 3; i++)
+  {
+    direction[i] = farPoint[i] - nearPoint[i];
+  }
+
+  std::vector<Candidate> candidates;
+  for(const std::pair<vtkProp3D*, VSAbstractFilter*>& propPair : props)
+  {
+    vtkProp3D* prop = propPair.first;
+    if(nullptr == prop || false == prop->GetVisibility() || false == prop->GetPickable())
+    {
+      continue;
+    }
+
+    double* bounds = prop->GetBounds();
+    if(nullptr == bounds)
+    {
+      continue;
+    }
+
+    double coord[3];
+    double t = 0.0;
+    if(vtkBox::IntersectBox(bounds, origin, direction, coord, t))
+    {
+      candidates.push_back(std::make_pair(t, prop));
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) { return a.first < b.first; });
+  return candidates;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterPicker::computePickRay(vtkRenderer* renderer, int pos[2], double nearPoint[3], double farPoint[3])
+{
+  double worldPoint[4];
+
+  renderer->SetDisplayPoint(pos[0], pos[1], 0.0);
+  renderer->DisplayToWorld();
+  renderer->GetWorldPoint(worldPoint);
+  if(0.0 == worldPoint[3])
+  {
+    return false;
+  }
+  for(int i = 0; i < 3; i++)
+  {
+    nearPoint[i] = worldPoint[i] / worldPoint[3];
+  }
+
+  renderer->SetDisplayPoint(pos[0], pos[1], 1.0);
+  renderer->DisplayToWorld();
+  renderer->GetWorldPoint(worldPoint);
+  if(0.0 == worldPoint[3])
+  {
+    return false;
+  }
+  for(int i = 0; i < 3; i++)
+  {
+    farPoint[i] = worldPoint[i] / worldPoint[3];
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterPicker::intersectProp(vtkProp3D* prop, const double nearPoint[3], const double farPoint[3], double boundsDistance, PickResult& result)
+{
+  vtkDataSet* dataSet = getRenderedDataSet(prop);
+
+  // Image slices and outlines fill their bounds closely enough that the bounds hit is used
+  vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataSet);
+  bool hasSurface = polyData ? (polyData->GetNumberOfPolys() + polyData->GetNumberOfStrips() > 0) : (nullptr != dataSet);
+  if(false == hasSurface)
+  {
+    if(boundsDistance >= result.m_Distance)
+    {
+      return false;
+    }
+
+    result.m_Prop = prop;
+    result.m_DataSet = dataSet;
+    result.m_CellId = -1;
+    result.m_Distance = boundsDistance;
+    for(int i = 0; i < 3; i++)
+    {
+      result.m_Position[i] = nearPoint[i] + boundsDistance * (farPoint[i] - nearPoint[i]);
+    }
+    return true;
+  }
+
+  vtkAbstractCellLocator* locator = getLocator(prop, dataSet);
+  if(nullptr == locator)
+  {
+    return false;
+  }
+
+  // Move the ray into the prop's coordinate system.  The parametric distance along
+  // the ray is unchanged by the affine transform so it can be compared across props.
+  VTK_NEW(vtkMatrix4x4, inverse);
+  vtkMatrix4x4::Invert(prop->GetMatrix(), inverse);
+
+  double localNear[4] = {nearPoint[0], nearPoint[1], nearPoint[2], 1.0};
+  double localFar[4] = {farPoint[0], farPoint[1], farPoint[2], 1.0};
+  inverse->MultiplyPoint(localNear, localNear);
+  inverse->MultiplyPoint(localFar, localFar);
+  for(int i = 0; i < 3; i++)
+  {
+    localNear[i] /= localNear[3];
+    localFar[i] /= localFar[3];
+  }
+
+  double t = 0.0;
+  double hitPoint[4] = {0.0, 0.0, 0.0, 1.0};
+  double pcoords[3];
+  int subId = 0;
+  vtkIdType cellId = -1;
+  if(0 == locator->IntersectWithLine(localNear, localFar, 0.0, t, hitPoint, pcoords, subId, cellId))
+  {
+    return false;
+  }
+  if(t >= result.m_Distance)
+  {
+    return false;
+  }
+
+  prop->GetMatrix()->MultiplyPoint(hitPoint, hitPoint);
+
+  result.m_Prop = prop;
+  result.m_DataSet = dataSet;
+  result.m_CellId = cellId;
+  result.m_Distance = t;
+  for(int i = 0; i < 3; i++)
+  {
+    result.m_Position[i] = hitPoint[i] / hitPoint[3];
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataSet* VSFilterPicker::getRenderedDataSet(vtkProp3D* prop)
+{
+  vtkActor* actor = vtkActor::SafeDownCast(prop);
+  if(nullptr == actor || nullptr == actor->GetMapper())
+  {
+    return nullptr;
+  }
+
+  return actor->GetMapper()->GetInputAsDataSet();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAbstractCellLocator* VSFilterPicker::getLocator(vtkProp3D* prop, vtkDataSet* dataSet)
+{
+  if(nullptr == dataSet || 0 == dataSet->GetNumberOfCells())
+  {
+    return nullptr;
+  }
+
+  CachedLocator& cache = m_Locators[prop];
+  if(cache.m_Locator && cache.m_DataSet == dataSet && cache.m_MTime == dataSet->GetMTime())
+  {
+    return cache.m_Locator;
+  }
+
+  VTK_PTR(vtkAbstractCellLocator) locator = createLocator(dataSet, false);
+
+  cache.m_Locator = locator;
+  cache.m_DataSet = dataSet;
+  cache.m_MTime = dataSet->GetMTime();
+  return locator;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterPicker::probeFilter(vtkProp3D* prop, VSAbstractFilter* filter, const double nearPoint[3], const double farPoint[3], ProbeResult& result)
+{
+  if(nullptr == filter)
+  {
+    return false;
+  }
+
+  VTK_PTR(vtkDataSet) dataSet = filter->getOutput();
+  if(nullptr == dataSet || 0 == dataSet->GetNumberOfCells())
+  {
+    return false;
+  }
+
+  // The filter output is untransformed, so the ray is moved into the filter's local space.
+  // The parametric distance along the ray is unchanged by the affine transform.
+  double localNear[3] = {nearPoint[0], nearPoint[1], nearPoint[2]};
+  double localFar[3] = {farPoint[0], farPoint[1], farPoint[2]};
+  VSTransform* transform = filter->getTransform();
+  if(transform)
+  {
+    transform->localizePoint(localNear);
+    transform->localizePoint(localFar);
+  }
+
+  double t = 0.0;
+  double localPos[3];
+  vtkIdType cellId = -1;
+  vtkImageData* image = vtkImageData::SafeDownCast(dataSet);
+  if(image)
+  {
+    cellId = traverseImage(image, localNear, localFar, t);
+  }
+  else
+  {
+    vtkAbstractCellLocator* locator = getProbeLocator(prop, dataSet);
+    if(nullptr == locator)
+    {
+      return false;
+    }
+
+    double pcoords[3];
+    int subId = 0;
+    double tolerance = std::sqrt(dataSet->GetLength2()) * 1.0e-4;
+    if(0 == locator->IntersectWithLine(localNear, localFar, tolerance, t, localPos, pcoords, subId, cellId))
+    {
+      cellId = -1;
+    }
+  }
+
+  if(cellId < 0 || t >= result.m_Distance)
+  {
+    return false;
+  }
+
+  for(int i = 0; i < 3; i++)
+  {
+    localPos[i] = localNear[i] + t * (localFar[i] - localNear[i]);
+  }
+
+  // Find the cell point closest to the probed position
+  vtkIdType pointId = -1;
+  double minDist2 = VTK_DOUBLE_MAX;
+  VTK_NEW(vtkIdList, pointIds);
+  dataSet->GetCellPoints(cellId, pointIds);
+  for(vtkIdType i = 0; i < pointIds->GetNumberOfIds(); i++)
+  {
+    double point[3];
+    dataSet->GetPoint(pointIds->GetId(i), point);
+    double dist2 = vtkMath::Distance2BetweenPoints(point, localPos);
+    if(dist2 < minDist2)
+    {
+      minDist2 = dist2;
+      pointId = pointIds->GetId(i);
+    }
+  }
+
+  result.m_Filter = filter;
+  result.m_DataSet = dataSet;
+  result.m_CellId = cellId;
+  result.m_PointId = pointId;
+  result.m_Distance = t;
+  for(int i = 0; i < 3; i++)
+  {
+    result.m_Position[i] = nearPoint[i] + t * (farPoint[i] - nearPoint[i]);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSFilterPicker::traverseImage(vtkImageData* image, const double nearPoint[3], const double farPoint[3], double& t)
+{
+  int* extent = image->GetExtent();
+  double* origin = image->GetOrigin();
+  double* spacing = image->GetSpacing();
+
+  double bounds[6];
+  double direction[3];
+  double start[3] = {nearPoint[0], nearPoint[1], nearPoint[2]};
+  for(int i = 0; i < 3; i++)
+  {
+    double first = origin[i] + extent[2 * i] * spacing[i];
+    double last = origin[i] + extent[2 * i + 1] * spacing[i];
+    bounds[2 * i] = std::min(first, last);
+    bounds[2 * i + 1] = std::max(first, last);
+    direction[i] = farPoint[i] - nearPoint[i];
+  }
+
+  double entry[3];
+  if(0 == vtkBox::IntersectBox(bounds, start, direction, entry, t))
+  {
+    return -1;
+  }
+
+  // Set up a 3D DDA walk through the voxels starting at the voxel containing the entry point
+  int ijk[3];
+  int cellMin[3];
+  int cellMax[3];
+  int step[3];
+  double tMax[3];
+  double tDelta[3];
+  for(int i = 0; i < 3; i++)
+  {
+    cellMin[i] = extent[2 * i];
+    cellMax[i] = std::max(extent[2 * i], extent[2 * i + 1] - 1);
+
+    if(0.0 == spacing[i] || extent[2 * i] == extent[2 * i + 1])
+    {
+      // Flat dimension: the ray never crosses a voxel boundary along this axis
+      ijk[i] = cellMin[i];
+      step[i] = 0;
+      tMax[i] = VTK_DOUBLE_MAX;
+      tDelta[i] = VTK_DOUBLE_MAX;
+      continue;
+    }
+
+    double index = (entry[i] - origin[i]) / spacing[i];
+    ijk[i] = std::min(std::max(static_cast<int>(std::floor(index)), cellMin[i]), cellMax[i]);
+
+    double indexDirection = direction[i] / spacing[i];
+    if(0.0 == indexDirection)
+    {
+      step[i] = 0;
+      tMax[i] = VTK_DOUBLE_MAX;
+      tDelta[i] = VTK_DOUBLE_MAX;
+    }
+    else
+    {
+      step[i] = indexDirection > 0.0 ? 1 : -1;
+      int nextBoundary = step[i] > 0 ? ijk[i] + 1 : ijk[i];
+      tMax[i] = t + (nextBoundary - index) / indexDirection;
+      tDelta[i] = std::abs(1.0 / indexDirection);
+    }
+  }
+
+  while(t <= 1.0)
+  {
+    vtkIdType cellId = image->ComputeCellId(ijk);
+    if(image->IsCellVisible(cellId))
+    {
+      return cellId;
+    }
+
+    // Advance to the next voxel along the axis with the nearest boundary
+    int axis = 0;
+    if(tMax[1] < tMax[axis])
+    {
+      axis = 1;
+    }
+    if(tMax[2] < tMax[axis])
+    {
+      axis = 2;
+    }
+    if(0 == step[axis])
+    {
+      break;
+    }
+
+    t = tMax[axis];
+    tMax[axis] += tDelta[axis];
+    ijk[axis] += step[axis];
+    if(ijk[axis] < cellMin[axis] || ijk[axis] > cellMax[axis])
+    {
+      break;
+    }
+  }
+
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAbstractCellLocator* VSFilterPicker::getProbeLocator(vtkProp3D* prop, vtkDataSet* dataSet)
+{
+  CachedLocator& cache = m_ProbeLocators[prop];
+  if(cache.m_Locator && cache.m_DataSet == dataSet && cache.m_MTime == dataSet->GetMTime())
+  {
+    return cache.m_Locator;
+  }
+
+  VTK_PTR(vtkAbstractCellLocator) locator = createLocator(dataSet, true);
+
+  cache.m_Locator = locator;
+  cache.m_DataSet = dataSet;
+  cache.m_MTime = dataSet->GetMTime();
+  return locator;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkAbstractCellLocator) VSFilterPicker::createLocator(vtkDataSet* dataSet, bool staticLocator)
+{
+  VTK_PTR(vtkAbstractCellLocator) locator;
+#ifdef VS_STATIC_CELL_LOCATOR
+  if(staticLocator)
+  {
+    locator.TakeReference(vtkStaticCellLocator::New());
+  }
+#endif
+  if(nullptr == locator)
+  {
+    locator.TakeReference(vtkCellLocator::New());
+  }
+
+  locator->SetDataSet(dataSet);
+  locator->BuildLocator();
+  return locator;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterPicker::releaseProp(vtkProp3D* prop)
+{
+  m_Locators.erase(prop);
+  m_ProbeLocators.erase(prop);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterPicker::clear()
+{
+  m_Locators.clear();
+  m_ProbeLocators.clear();
+}
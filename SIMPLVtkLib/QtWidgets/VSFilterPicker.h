@@ -0,0 +1,235 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vtkAbstractCellLocator.h>
+#include <vtkDataSet.h>
+#include <vtkImageData.h>
+#include <vtkProp3D.h>
+#include <vtkRenderer.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSFilterPicker VSFilterPicker.h SIMPLVtkLib/QtWidgets/VSFilterPicker.h
+ * @brief This class finds the visual filter rendered at a given screen position
+ * without reading back from the frame buffer.  A ray is cast through the scene
+ * and tested against the world bounds of each visible prop.  Props whose bounds
+ * are hit are then tested against their rendered geometry using a cell locator
+ * that is built the first time the prop is picked and cached until its geometry
+ * changes.
+ *
+ * The picker can also probe the filter output under the cursor for the cell and
+ * point being displayed.  vtkImageData is probed with an analytic ray-voxel
+ * traversal while other data sets use a lazily built static cell locator.
+ */
+class SIMPLVtkLib_EXPORT VSFilterPicker
+{
+public:
+  using PropFilterMap = std::unordered_map<vtkProp3D*, VSAbstractFilter*>;
+
+  struct PickResult
+  {
+    vtkProp3D* m_Prop = nullptr;
+    VSAbstractFilter* m_Filter = nullptr;
+    vtkDataSet* m_DataSet = nullptr;
+    vtkIdType m_CellId = -1;
+    double m_Position[3] = {0.0, 0.0, 0.0};
+    double m_Distance = VTK_DOUBLE_MAX;
+  };
+
+  struct ProbeResult
+  {
+    VSAbstractFilter* m_Filter = nullptr;
+    VTK_PTR(vtkDataSet) m_DataSet = nullptr;
+    vtkIdType m_CellId = -1;
+    vtkIdType m_PointId = -1;
+    double m_Position[3] = {0.0, 0.0, 0.0};
+    double m_Distance = VTK_DOUBLE_MAX;
+  };
+
+  /**
+   * @brief Constructor
+   */
+  VSFilterPicker() = default;
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSFilterPicker() = default;
+
+  /**
+   * @brief Returns the nearest prop and filter rendered at the given display coordinates.
+   * Only props included in the given map are considered.
+   * @param renderer
+   * @param pos
+   * @param props
+   * @return
+   */
+  PickResult pick(vtkRenderer* renderer, int pos[2], const PropFilterMap& props);
+
+  /**
+   * @brief Returns the cell and point of the nearest visible filter output found at the
+   * given display coordinates.  Only props included in the given map are considered.
+   * @param renderer
+   * @param pos
+   * @param props
+   * @return
+   */
+  ProbeResult probe(vtkRenderer* renderer, int pos[2], const PropFilterMap& props);
+
+  /**
+   * @brief Releases any cached locator for the given prop
+   * @param prop
+   */
+  void releaseProp(vtkProp3D* prop);
+
+  /**
+   * @brief Releases all cached locators
+   */
+  void clear();
+
+protected:
+  using Candidate = std::pair<double, vtkProp3D*>;
+
+  /**
+   * @brief Returns the visible props whose bounds are crossed by the ray sorted
+   * by the distance along the ray to their bounds.
+   * @param props
+   * @param nearPoint
+   * @param farPoint
+   * @return
+   */
+  std::vector<Candidate> findCandidates(const PropFilterMap& props, const double nearPoint[3], const double farPoint[3]);
+
+  /**
+   * @brief Intersects the ray with the given filter's output and updates the result if
+   * the intersection is closer than the current value.  Returns true if the result was updated.
+   * @param prop
+   * @param filter
+   * @param nearPoint
+   * @param farPoint
+   * @param result
+   * @return
+   */
+  bool probeFilter(vtkProp3D* prop, VSAbstractFilter* filter, const double nearPoint[3], const double farPoint[3], ProbeResult& result);
+
+  /**
+   * @brief Walks the voxels of the image along the ray and returns the first visible cell.
+   * The distance along the ray to the cell is stored in t.  Returns -1 if no visible cell is crossed.
+   * @param image
+   * @param nearPoint
+   * @param farPoint
+   * @param t
+   * @return
+   */
+  vtkIdType traverseImage(vtkImageData* image, const double nearPoint[3], const double farPoint[3], double& t);
+
+  /**
+   * @brief Returns the cached probe locator for the given prop's filter output, building
+   * a new one if the output has changed since it was last used.
+   * @param prop
+   * @param dataSet
+   * @return
+   */
+  vtkAbstractCellLocator* getProbeLocator(vtkProp3D* prop, vtkDataSet* dataSet);
+
+  /**
+   * @brief Builds a cell locator for the given data set
+   * @param dataSet
+   * @param staticLocator
+   * @return
+   */
+  VTK_PTR(vtkAbstractCellLocator) createLocator(vtkDataSet* dataSet, bool staticLocator);
+
+  /**
+   * @brief Calculates the world coordinates of the pick ray between the near
+   * and far clipping planes.  Returns false if the ray could not be found.
+   * @param renderer
+   * @param pos
+   * @param nearPoint
+   * @param farPoint
+   * @return
+   */
+  bool computePickRay(vtkRenderer* renderer, int pos[2], double nearPoint[3], double farPoint[3]);
+
+  /**
+   * @brief Intersects the ray with the given prop's rendered geometry and updates the
+   * result if the intersection is closer than the current value.  Returns true if the
+   * result was updated.
+   * @param prop
+   * @param nearPoint
+   * @param farPoint
+   * @param boundsDistance
+   * @param result
+   * @return
+   */
+  bool intersectProp(vtkProp3D* prop, const double nearPoint[3], const double farPoint[3], double boundsDistance, PickResult& result);
+
+  /**
+   * @brief Returns the rendered vtkDataSet for the given prop if one is available
+   * @param prop
+   * @return
+   */
+  vtkDataSet* getRenderedDataSet(vtkProp3D* prop);
+
+  /**
+   * @brief Returns the cached locator for the given prop, building a new one if the
+   * prop's geometry has changed since it was last used.
+   * @param prop
+   * @param dataSet
+   * @return
+   */
+  vtkAbstractCellLocator* getLocator(vtkProp3D* prop, vtkDataSet* dataSet);
+
+private:
+  struct CachedLocator
+  {
+    VTK_PTR(vtkAbstractCellLocator) m_Locator;
+    VTK_PTR(vtkDataSet) m_DataSet;
+    vtkMTimeType m_MTime = 0;
+  };
+
+  std::unordered_map<vtkProp3D*, CachedLocator> m_Locators;
+  std::unordered_map<vtkProp3D*, CachedLocator> m_ProbeLocators;
+};
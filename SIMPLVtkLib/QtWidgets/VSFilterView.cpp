@@ -36,11 +36,14 @@
 #include "VSFilterView.h"
 
 #include <QtWidgets/QMenu>
+#include <QtWidgets/QMessageBox>
 
 #include "SIMPLVtkLib/QtWidgets/VSFilterViewDelegate.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSMemoryManager.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -149,6 +152,14 @@ void VSFilterView::requestContextMenu(const QPoint& pos)
         connect(reloadAction, &QAction::triggered, [=] { emit reloadFilterRequested(dataFilter); });
         menu.addAction(reloadAction);
 
+        VSSIMPLDataContainerFilter* simplFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(dataFilter);
+        if(simplFilter && simplFilter->hasImageRegion())
+        {
+          QAction* expandAction = new QAction("Expand Region of Interest...");
+          connect(expandAction, &QAction::triggered, [=] { emit expandRegionRequested(simplFilter); });
+          menu.addAction(expandAction);
+        }
+
         {
           QAction* separator = new QAction(this);
           separator->setSeparator(true);
@@ -168,6 +179,16 @@ void VSFilterView::requestContextMenu(const QPoint& pos)
         }
       }
 
+      QAction* memoryAction = new QAction("Memory Usage...");
+      connect(memoryAction, &QAction::triggered, [=] { QMessageBox::information(this, "Memory Usage", VSMemoryManager::Instance()->createReport()); });
+      menu.addAction(memoryAction);
+
+      {
+        QAction* separator = new QAction(this);
+        separator->setSeparator(true);
+        menu.addAction(separator);
+      }
+
       QAction* deleteAction = new QAction("Delete");
       connect(deleteAction, &QAction::triggered, [=] {
         VSAbstractFilter* filter = getFilterFromIndex(index);
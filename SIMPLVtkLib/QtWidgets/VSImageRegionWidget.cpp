@@ -0,0 +1,190 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageRegionWidget.h"
+
+#include <algorithm>
+#include <climits>
+
+#include <QtCore/QLocale>
+#include <QtWidgets/QGridLayout>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegionWidget::VSImageRegionWidget(QWidget* parent)
+: QWidget(parent)
+{
+  QGridLayout* layout = new QGridLayout(this);
+  layout->setContentsMargins(0, 0, 0, 0);
+  layout->addWidget(new QLabel("Min", this), 0, 1);
+  layout->addWidget(new QLabel("Max", this), 0, 2);
+  layout->addWidget(new QLabel("Stride", this), 0, 3);
+
+  const QStringList axisNames = {"X", "Y", "Z"};
+  for(int axis = 0; axis < 3; axis++)
+  {
+    m_MinBoxes[axis] = new QSpinBox(this);
+    m_MaxBoxes[axis] = new QSpinBox(this);
+    m_StrideBoxes[axis] = new QSpinBox(this);
+    m_StrideBoxes[axis]->setMinimum(1);
+
+    layout->addWidget(new QLabel(axisNames[axis], this), axis + 1, 0);
+    layout->addWidget(m_MinBoxes[axis], axis + 1, 1);
+    layout->addWidget(m_MaxBoxes[axis], axis + 1, 2);
+    layout->addWidget(m_StrideBoxes[axis], axis + 1, 3);
+
+    connect(m_MinBoxes[axis], SIGNAL(valueChanged(int)), this, SLOT(updateRegion()));
+    connect(m_MaxBoxes[axis], SIGNAL(valueChanged(int)), this, SLOT(updateRegion()));
+    connect(m_StrideBoxes[axis], SIGNAL(valueChanged(int)), this, SLOT(updateRegion()));
+  }
+
+  m_VoxelLabel = new QLabel(this);
+  layout->addWidget(m_VoxelLabel, 4, 0, 1, 4);
+
+  size_t dims[3] = {1, 1, 1};
+  setDimensions(dims);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionWidget::setDimensions(const size_t dims[3])
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    const int last = static_cast<int>(std::min<size_t>(std::max<size_t>(dims[axis], 1) - 1, INT_MAX));
+    m_MinBoxes[axis]->blockSignals(true);
+    m_MaxBoxes[axis]->blockSignals(true);
+    m_StrideBoxes[axis]->blockSignals(true);
+
+    m_MinBoxes[axis]->setRange(0, last);
+    m_MaxBoxes[axis]->setRange(0, last);
+    m_StrideBoxes[axis]->setRange(1, std::max(last, 1));
+    m_MinBoxes[axis]->setValue(0);
+    m_MaxBoxes[axis]->setValue(last);
+    m_StrideBoxes[axis]->setValue(1);
+    m_StrideBoxes[axis]->setEnabled(true);
+
+    m_MinBoxes[axis]->blockSignals(false);
+    m_MaxBoxes[axis]->blockSignals(false);
+    m_StrideBoxes[axis]->blockSignals(false);
+  }
+
+  updateRegion();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionWidget::setBytesPerVoxel(size_t bytes)
+{
+  m_BytesPerVoxel = bytes;
+  updateRegion();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegion VSImageRegionWidget::getRegion() const
+{
+  VSImageRegion region;
+  for(int axis = 0; axis < 3; axis++)
+  {
+    region.m_Min[axis] = static_cast<size_t>(m_MinBoxes[axis]->value());
+    region.m_Max[axis] = static_cast<size_t>(m_MaxBoxes[axis]->value());
+    region.m_Stride[axis] = static_cast<size_t>(m_StrideBoxes[axis]->value());
+  }
+
+  return region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionWidget::setRegion(const VSImageRegion& region)
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    m_MinBoxes[axis]->setValue(static_cast<int>(std::min<size_t>(region.m_Min[axis], INT_MAX)));
+    m_MaxBoxes[axis]->setValue(static_cast<int>(std::min<size_t>(region.m_Max[axis], INT_MAX)));
+    m_StrideBoxes[axis]->setValue(static_cast<int>(std::min<size_t>(region.m_Stride[axis], INT_MAX)));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionWidget::setContainedRegion(const VSImageRegion& region)
+{
+  setRegion(region);
+  for(int axis = 0; axis < 3; axis++)
+  {
+    // Keeping the stride lets the expanded region reuse every voxel already in memory
+    m_MinBoxes[axis]->setSingleStep(m_StrideBoxes[axis]->value());
+    m_MaxBoxes[axis]->setSingleStep(m_StrideBoxes[axis]->value());
+    m_MinBoxes[axis]->setMaximum(m_MinBoxes[axis]->value());
+    m_MaxBoxes[axis]->setMinimum(m_MaxBoxes[axis]->value());
+    m_StrideBoxes[axis]->setEnabled(false);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionWidget::updateRegion()
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    if(m_MaxBoxes[axis]->value() < m_MinBoxes[axis]->value())
+    {
+      m_MaxBoxes[axis]->blockSignals(true);
+      m_MaxBoxes[axis]->setValue(m_MinBoxes[axis]->value());
+      m_MaxBoxes[axis]->blockSignals(false);
+    }
+  }
+
+  QLocale locale;
+  size_t voxelCount = getRegion().getNumberOfVoxels();
+  QString text = tr("%1 voxels").arg(locale.toString(static_cast<qulonglong>(voxelCount)));
+  if(m_BytesPerVoxel > 0)
+  {
+    double megabytes = static_cast<double>(voxelCount * m_BytesPerVoxel) / (1024.0 * 1024.0);
+    text += tr(" (%1 MB)").arg(locale.toString(megabytes, 'f', 1));
+  }
+  m_VoxelLabel->setText(text);
+
+  emit regionChanged();
+}
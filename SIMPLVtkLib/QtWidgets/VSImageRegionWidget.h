@@ -0,0 +1,114 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QLabel>
+#include <QtWidgets/QSpinBox>
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImageRegionWidget VSImageRegionWidget.h SIMPLVtkLib/QtWidgets/VSImageRegionWidget.h
+ * @brief This widget lets the user pick the first and last voxel and the stride along each
+ * axis of an ImageGeom region of interest.  The number of voxels and memory the region reads
+ * are shown below the inputs.
+ */
+class SIMPLVtkLib_EXPORT VSImageRegionWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSImageRegionWidget(QWidget* parent = nullptr);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSImageRegionWidget() = default;
+
+  /**
+   * @brief Sets the dimensions of the full volume and resets the region to cover it
+   * @param dims
+   */
+  void setDimensions(const size_t dims[3]);
+
+  /**
+   * @brief Sets the number of bytes read for each voxel used to estimate the region's memory
+   * @param bytes
+   */
+  void setBytesPerVoxel(size_t bytes);
+
+  /**
+   * @brief Returns the region of interest
+   * @return
+   */
+  VSImageRegion getRegion() const;
+
+  /**
+   * @brief Sets the region of interest
+   * @param region
+   */
+  void setRegion(const VSImageRegion& region);
+
+  /**
+   * @brief Limits the region so that it always contains the given region.  The stride is
+   * locked to the given region's stride so that the voxels already read can be kept.
+   * @param region
+   */
+  void setContainedRegion(const VSImageRegion& region);
+
+signals:
+  void regionChanged();
+
+protected slots:
+  /**
+   * @brief Keeps each axis' minimum and maximum in order and updates the voxel count
+   */
+  void updateRegion();
+
+private:
+  QSpinBox* m_MinBoxes[3];
+  QSpinBox* m_MaxBoxes[3];
+  QSpinBox* m_StrideBoxes[3];
+  QLabel* m_VoxelLabel = nullptr;
+  size_t m_BytesPerVoxel = 0;
+};
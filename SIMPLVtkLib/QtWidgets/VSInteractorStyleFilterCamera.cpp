@@ -38,7 +38,6 @@
 #include <string>
 
 #include <vtkCamera.h>
-#include <vtkPropPicker.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 
@@ -105,6 +104,44 @@ void VSInteractorStyleFilterCamera::OnMouseMove()
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::OnMouseWheelForward()
+{
+  vtkInteractorStyleTrackballCamera::OnMouseWheelForward();
+  endWheelGesture();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::OnMouseWheelBackward()
+{
+  vtkInteractorStyleTrackballCamera::OnMouseWheelBackward();
+  endWheelGesture();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSInteractorStyleFilterCamera::endWheelGesture()
+{
+  if(nullptr == m_ViewWidget || nullptr == m_ViewWidget->getVisualizationWidget())
+  {
+    return;
+  }
+
+  // Each wheel step is a complete gesture, so linked views only need to wait
+  // for the throttle timer when one is running.
+  VSVisualizationWidget* visualizationWidget = m_ViewWidget->getVisualizationWidget();
+  visualizationWidget->requestLinkedRender();
+  if(visualizationWidget->getLinkedRenderRate() <= 0.0)
+  {
+    visualizationWidget->flushLinkedRenderWindows();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -119,11 +156,7 @@ void VSInteractorStyleFilterCamera::updateLinkedRenderWindows()
     return;
   }
 
-  VSVisualizationWidget::LinkedRenderWindowType linkedRenderWindows = m_ViewWidget->getVisualizationWidget()->getLinkedRenderWindows();
-  for(VTK_PTR(vtkRenderWindow) renderWindow : linkedRenderWindows)
-  {
-    renderWindow->Render();
-  }
+  m_ViewWidget->getVisualizationWidget()->requestLinkedRender();
 }
 
 // -----------------------------------------------------------------------------
@@ -198,18 +231,33 @@ bool VSInteractorStyleFilterCamera::dragFilterKey()
 // -----------------------------------------------------------------------------
 VSInteractorStyleFilterCamera::FilterProp VSInteractorStyleFilterCamera::getFilterFromScreenCoords(int pos[2])
 {
-  vtkRenderer* renderer = this->GetDefaultRenderer();
+  FilterProp filterProp(nullptr, nullptr);
+  if(nullptr == m_ViewWidget)
+  {
+    return filterProp;
+  }
 
-  FilterProp filterProp;
+  // Picking is performed on the CPU so the scene does not need to be rendered again
+  vtkRenderer* renderer = this->GetDefaultRenderer();
+  VSFilterPicker::PickResult result = m_ViewWidget->getFilterPicker()->pick(renderer, pos, m_ViewWidget->getVisiblePropFilters());
+  filterProp.first = result.m_Prop;
+  filterProp.second = result.m_Filter;
 
-  VTK_NEW(vtkPropPicker, picker);
-  picker->Pick(pos[0], pos[1], 0, renderer);
-  filterProp.first = picker->GetProp3D();
-  filterProp.second = m_ViewWidget->getFilterFromProp(filterProp.first);
+  return filterProp;
+}
 
-  renderer->GetRenderWindow()->Render();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterPicker::ProbeResult VSInteractorStyleFilterCamera::probeScreenCoords(int pos[2])
+{
+  if(nullptr == m_ViewWidget)
+  {
+    return VSFilterPicker::ProbeResult();
+  }
 
-  return filterProp;
+  vtkRenderer* renderer = this->GetDefaultRenderer();
+  return m_ViewWidget->getFilterPicker()->probe(renderer, pos, m_ViewWidget->getVisiblePropFilters());
 }
 
 // -----------------------------------------------------------------------------
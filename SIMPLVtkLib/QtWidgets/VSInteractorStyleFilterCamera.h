@@ -38,6 +38,7 @@
 #include <vtkInteractorStyleTrackballCamera.h>
 #include <vtkProp3D.h>
 
+#include "SIMPLVtkLib/QtWidgets/VSFilterPicker.h"
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
 
@@ -72,6 +73,16 @@ public:
    */
   void OnMouseMove() override;
 
+  /**
+   * @brief Zooms the camera in and requests linked views to update
+   */
+  void OnMouseWheelForward() override;
+
+  /**
+   * @brief Zooms the camera out and requests linked views to update
+   */
+  void OnMouseWheelBackward() override;
+
   /**
    * @brief Checks if the ActionType needs to be set
    */
@@ -95,6 +106,13 @@ public:
    */
   FilterProp getFilterFromScreenCoords(int pos[2]);
 
+  /**
+   * @brief Returns the cell and point of the topmost visible filter output rendered at the given screen coordinates
+   * @param pos
+   * @return
+   */
+  VSFilterPicker::ProbeResult probeScreenCoords(int pos[2]);
+
 protected:
   enum class ActionType
   {
@@ -247,10 +265,17 @@ protected:
   bool dragFilterKey();
 
   /**
-   * @brief Updates any linked vtkRenderWindows for the current view widget
+   * @brief Requests that any linked vtkRenderWindows for the current view widget be updated.
+   * Linked windows are rendered at a throttled rate while interacting and are brought
+   * up to date when the gesture ends.
    */
   void updateLinkedRenderWindows();
 
+  /**
+   * @brief Updates linked vtkRenderWindows after a mouse wheel step
+   */
+  void endWheelGesture();
+
 private:
   VSAbstractFilter* m_ActiveFilter = nullptr;
   vtkProp3D* m_ActiveProp = nullptr;
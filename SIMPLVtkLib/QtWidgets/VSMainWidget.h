@@ -159,5 +159,8 @@ private:
   QAction* m_ActionAddCrop = nullptr;
   QAction* m_ActionAddSlice = nullptr;
   QAction* m_ActionAddMask = nullptr;
+  QAction* m_ActionAddGrainBoundary = nullptr;
+  QAction* m_ActionAddContour = nullptr;
+  QAction* m_ActionAddCalculator = nullptr;
   QAction* m_ActionAddThreshold = nullptr;
 };
@@ -35,8 +35,11 @@
 
 #include "VSMainWidget2.h"
 
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCalculatorFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSContourFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSGrainBoundaryFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSliceFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSTextFilter.h"
@@ -195,6 +198,18 @@ void VSMainWidget2::setCurrentFilter(VSAbstractFilter* filter)
   bool enableMask = VSMaskFilter::compatibleWithParent(filter);
   m_ActionAddMask->setEnabled(enableMask);
 
+  // Grain Boundary
+  bool enableGrainBoundary = VSGrainBoundaryFilter::compatibleWithParent(filter);
+  m_ActionAddGrainBoundary->setEnabled(enableGrainBoundary);
+
+  // Contour
+  bool enableContour = VSContourFilter::compatibleWithParent(filter);
+  m_ActionAddContour->setEnabled(enableContour);
+
+  // Calculator
+  bool enableCalculator = VSCalculatorFilter::compatibleWithParent(filter);
+  m_ActionAddCalculator->setEnabled(enableCalculator);
+
   // Threshold
   bool enableThreshold = VSThresholdFilter::compatibleWithParent(filter);
   m_Internals->thresholdBtn->setEnabled(enableThreshold);
@@ -312,6 +327,15 @@ void VSMainWidget2::createFilterMenu()
   m_ActionAddMask = new QAction("Mask Filter");
   connect(m_ActionAddMask, SIGNAL(triggered()), this, SLOT(createMaskFilter()));
 
+  m_ActionAddGrainBoundary = new QAction("Grain Boundary Filter");
+  connect(m_ActionAddGrainBoundary, SIGNAL(triggered()), this, SLOT(createGrainBoundaryFilter()));
+
+  m_ActionAddContour = new QAction("Contour Filter");
+  connect(m_ActionAddContour, SIGNAL(triggered()), this, SLOT(createContourFilter()));
+
+  m_ActionAddCalculator = new QAction("Calculator Filter");
+  connect(m_ActionAddCalculator, SIGNAL(triggered()), this, SLOT(createCalculatorFilter()));
+
   m_ActionAddText = new QAction("Text Filter");
   connect(m_ActionAddText, SIGNAL(triggered()), this, SLOT(createTextFilter()));
 
@@ -322,6 +346,9 @@ void VSMainWidget2::createFilterMenu()
   m_FilterMenu->addAction(m_ActionAddCrop);
   m_FilterMenu->addAction(m_ActionAddThreshold);
   m_FilterMenu->addAction(m_ActionAddMask);
+  m_FilterMenu->addAction(m_ActionAddGrainBoundary);
+  m_FilterMenu->addAction(m_ActionAddContour);
+  m_FilterMenu->addAction(m_ActionAddCalculator);
 
   m_FilterMenu->addSeparator();
 
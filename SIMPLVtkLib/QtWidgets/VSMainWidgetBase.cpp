@@ -40,12 +40,15 @@
 #include <QtCore/QFile>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QThread>
 #include <QtCore/QUuid>
 #include <QtGui/QKeySequence>
 #include <QtWidgets/QShortcut>
 
+#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QMessageBox>
+#include <QtWidgets/QVBoxLayout>
 
 #include <QVTKInteractor.h>
 
@@ -53,19 +56,27 @@
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
 #include "SIMPLVtkLib/Dialogs/LoadHDF5FileDialog.h"
+#include "SIMPLVtkLib/QtWidgets/VSImageRegionWidget.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
 
+#include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSCalculatorFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSClipFilterWidget.h"
+#include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSContourFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSCropFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSDataSetFilterWidget.h"
+#include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSGrainBoundaryFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSMaskFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSParentFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSSIMPLDataContainerFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSSliceFilterWidget.h"
 #include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSThresholdFilterWidget.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCalculatorFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSContourFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSGrainBoundaryFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSPipelineFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
@@ -176,6 +187,7 @@ void VSMainWidgetBase::setFilterView(VSFilterView* view)
     disconnect(m_FilterView, &VSFilterView::deleteFilterRequested, this, &VSMainWidgetBase::deleteFilter);
     disconnect(m_FilterView, &VSFilterView::reloadFilterRequested, this, &VSMainWidgetBase::reloadDataFilter);
     disconnect(m_FilterView, &VSFilterView::reloadFileFilterRequested, this, &VSMainWidgetBase::reloadFileFilter);
+    disconnect(m_FilterView, &VSFilterView::expandRegionRequested, this, &VSMainWidgetBase::expandImageRegion);
     disconnect(m_FilterView, &VSFilterView::filterClicked, this, &VSMainWidgetBase::setCurrentFilter);
     disconnect(this, &VSMainWidgetBase::changedActiveView, m_FilterView, &VSFilterView::setViewWidget);
   }
@@ -184,6 +196,7 @@ void VSMainWidgetBase::setFilterView(VSFilterView* view)
   connect(view, &VSFilterView::deleteFilterRequested, this, &VSMainWidgetBase::deleteFilter);
   connect(view, &VSFilterView::reloadFilterRequested, this, &VSMainWidgetBase::reloadDataFilter);
   connect(view, &VSFilterView::reloadFileFilterRequested, this, &VSMainWidgetBase::reloadFileFilter);
+  connect(view, &VSFilterView::expandRegionRequested, this, &VSMainWidgetBase::expandImageRegion);
   connect(view, &VSFilterView::filterClicked, this, &VSMainWidgetBase::setCurrentFilter);
   connect(this, &VSMainWidgetBase::changedActiveView, view, &VSFilterView::setViewWidget);
 
@@ -397,11 +410,26 @@ void VSMainWidgetBase::filterAdded(VSAbstractFilter* filter, bool currentFilter)
     VSClipFilter* vsFilter = dynamic_cast<VSClipFilter*>(filter);
     fw = new VSClipFilterWidget(vsFilter, interactor, this);
   }
+  else if(dynamic_cast<VSCalculatorFilter*>(filter) != nullptr)
+  {
+    VSCalculatorFilter* vsFilter = dynamic_cast<VSCalculatorFilter*>(filter);
+    fw = new VSCalculatorFilterWidget(vsFilter, interactor, this);
+  }
+  else if(dynamic_cast<VSContourFilter*>(filter) != nullptr)
+  {
+    VSContourFilter* vsFilter = dynamic_cast<VSContourFilter*>(filter);
+    fw = new VSContourFilterWidget(vsFilter, interactor, this);
+  }
   else if(dynamic_cast<VSCropFilter*>(filter) != nullptr)
   {
     VSCropFilter* vsFilter = dynamic_cast<VSCropFilter*>(filter);
     fw = new VSCropFilterWidget(vsFilter, interactor, this);
   }
+  else if(dynamic_cast<VSGrainBoundaryFilter*>(filter) != nullptr)
+  {
+    VSGrainBoundaryFilter* vsFilter = dynamic_cast<VSGrainBoundaryFilter*>(filter);
+    fw = new VSGrainBoundaryFilterWidget(vsFilter, interactor, this);
+  }
   else if(dynamic_cast<VSMaskFilter*>(filter) != nullptr)
   {
     VSMaskFilter* vsFilter = dynamic_cast<VSMaskFilter*>(filter);
@@ -514,15 +542,25 @@ void VSMainWidgetBase::openDREAM3DFile(const QString& filePath)
 {
   QFileInfo fi(filePath);
 
-  SIMPLH5DataReader reader;
-  connect(&reader, SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SLOT(generateError(const QString&, const QString&, const int&)));
+  // The file is closed before the selection dialog opens so its previews can take the HDF5 lock
+  bool success = false;
+  DataContainerArrayProxy proxy;
+  {
+    QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
+    SIMPLH5DataReader reader;
+    connect(&reader, SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SLOT(generateError(const QString&, const QString&, const int&)));
+
+    success = reader.openFile(filePath);
+    if(success)
+    {
+      int err = 0;
+      SIMPLH5DataReaderRequirements req(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Any, IGeometry::Type::Any);
+      proxy = reader.readDataContainerArrayStructure(&req, err);
+    }
+  }
 
-  bool success = reader.openFile(filePath);
   if(success)
   {
-    int err = 0;
-    SIMPLH5DataReaderRequirements req(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Any, IGeometry::Type::Any);
-    DataContainerArrayProxy proxy = reader.readDataContainerArrayStructure(&req, err);
     if(proxy.dataContainers.isEmpty())
     {
       return;
@@ -577,11 +615,45 @@ void VSMainWidgetBase::openDREAM3DFile(const QString& filePath)
 void VSMainWidgetBase::launchSIMPLSelectionDialog(DataContainerArrayProxy proxy, const QString& filePath)
 {
   QSharedPointer<LoadHDF5FileDialog> dialog = QSharedPointer<LoadHDF5FileDialog>(new LoadHDF5FileDialog());
+  dialog->setFilePath(filePath);
   dialog->setProxy(proxy);
   int ret = dialog->exec();
 
-  if(ret == QDialog::Accepted)
+  if(ret == QDialog::Accepted && dialog->useSliceOnlyImport())
+  {
+    // ImageGeom cell arrays stay in the file and are read one slab at a time by slices
+    QString errorMessage;
+    if(false == m_Controller->importDataContainerArraySliceOnly(filePath, dialog->getDataStructureProxy(), errorMessage))
+    {
+      generateError("Data Import Error", errorMessage, -3007);
+    }
+  }
+  else if(ret == QDialog::Accepted && dialog->useProgressiveImport())
   {
+    // The coarse level is imported right away and refined in the background
+    QString errorMessage;
+    if(false == m_Controller->importDataContainerArrayProgressively(filePath, dialog->getDataStructureProxy(), dialog->getImageRegion(), dialog->useImageRegion(), errorMessage))
+    {
+      generateError("Data Import Error", errorMessage, -3005);
+    }
+  }
+  else if(ret == QDialog::Accepted && dialog->useImageRegion())
+  {
+    // Only the region of interest is read from ImageGeom Data Containers
+    QString errorMessage;
+    VSImageRegion region = dialog->getImageRegion();
+    DataContainerArray::Pointer dca = VSImageRegionReader::ReadDataContainerArray(filePath, dialog->getDataStructureProxy(), region, errorMessage);
+    if(nullptr == dca)
+    {
+      generateError("Data Import Error", errorMessage, -3005);
+      return;
+    }
+
+    m_Controller->importDataContainerArray(filePath, dca, region);
+  }
+  else if(ret == QDialog::Accepted)
+  {
+    QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
     SIMPLH5DataReader reader;
 
     bool success = reader.openFile(filePath);
@@ -793,16 +865,67 @@ void VSMainWidgetBase::reloadFileFilter(VSFileNameFilter* filter)
   QtConcurrent::run(this, &VSMainWidgetBase::reloadFilters, filters);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMainWidgetBase::expandImageRegion(VSSIMPLDataContainerFilter* filter)
+{
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(filter->getParentFilter());
+  if(nullptr == fileFilter || false == filter->hasImageRegion())
+  {
+    return;
+  }
+
+  ImageGeom::Pointer geom = VSImageRegionReader::ReadImageGeometry(fileFilter->getFilePath(), filter->getFilterName());
+  if(nullptr == geom)
+  {
+    QString ss = QObject::tr("The ImageGeom of Data Container '%1' could not be read from '%2'.").arg(filter->getFilterName()).arg(fileFilter->getFilePath());
+    generateError("Data Reload Error", ss, -3005);
+    return;
+  }
+
+  std::tuple<size_t, size_t, size_t> geomDims = geom->getDimensions();
+  size_t dims[3] = {std::get<0>(geomDims), std::get<1>(geomDims), std::get<2>(geomDims)};
+
+  QDialog dialog(this);
+  dialog.setWindowTitle(tr("Expand Region of Interest"));
+  QVBoxLayout* layout = new QVBoxLayout(&dialog);
+  VSImageRegionWidget* regionWidget = new VSImageRegionWidget(&dialog);
+  regionWidget->setDimensions(dims);
+  regionWidget->setContainedRegion(filter->getImageRegion().clamped(dims));
+  layout->addWidget(regionWidget);
+
+  QDialogButtonBox* buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, &dialog);
+  connect(buttonBox, &QDialogButtonBox::accepted, &dialog, &QDialog::accept);
+  connect(buttonBox, &QDialogButtonBox::rejected, &dialog, &QDialog::reject);
+  layout->addWidget(buttonBox);
+
+  if(dialog.exec() == QDialog::Accepted)
+  {
+    filter->expandImageRegion(regionWidget->getRegion());
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void VSMainWidgetBase::reloadFilters(std::vector<VSAbstractDataFilter*> filters)
 {
-  if(filters.size() == 1)
+  // Regions of interest can differ between Data Containers after being expanded
+  bool hasImageRegion = false;
+  for(VSAbstractDataFilter* filter : filters)
   {
-    // This is a single filter, so do a simple reload
-    VSAbstractDataFilter* filter = filters[0];
-    filter->reloadData();
+    VSSIMPLDataContainerFilter* simplFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(filter);
+    hasImageRegion = hasImageRegion || (simplFilter && simplFilter->hasImageRegion());
+  }
+
+  if(filters.size() == 1 || hasImageRegion)
+  {
+    // Each filter is reloaded separately
+    for(VSAbstractDataFilter* filter : filters)
+    {
+      filter->reloadData();
+    }
   }
   else if(filters.size() > 1 && dynamic_cast<VSSIMPLDataContainerFilter*>(filters[0]) != nullptr)
   {
@@ -916,6 +1039,57 @@ void VSMainWidgetBase::createMaskFilter(VSAbstractFilter* parent)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMainWidgetBase::createGrainBoundaryFilter(VSAbstractFilter* parent)
+{
+  if(nullptr == parent)
+  {
+    parent = getCurrentFilter();
+  }
+
+  if(parent && VSGrainBoundaryFilter::compatibleWithParent(parent))
+  {
+    VSGrainBoundaryFilter* filter = new VSGrainBoundaryFilter(parent);
+    finishAddingFilter(filter, parent);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMainWidgetBase::createContourFilter(VSAbstractFilter* parent)
+{
+  if(nullptr == parent)
+  {
+    parent = getCurrentFilter();
+  }
+
+  if(parent && VSContourFilter::compatibleWithParent(parent))
+  {
+    VSContourFilter* filter = new VSContourFilter(parent);
+    finishAddingFilter(filter, parent);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMainWidgetBase::createCalculatorFilter(VSAbstractFilter* parent)
+{
+  if(nullptr == parent)
+  {
+    parent = getCurrentFilter();
+  }
+
+  if(parent && VSCalculatorFilter::compatibleWithParent(parent))
+  {
+    VSCalculatorFilter* filter = new VSCalculatorFilter(parent);
+    finishAddingFilter(filter, parent);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
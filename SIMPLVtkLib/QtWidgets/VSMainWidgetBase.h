@@ -211,6 +211,27 @@ public slots:
    */
   void createMaskFilter(VSAbstractFilter* parent = nullptr);
 
+  /**
+   * @brief Create a grain boundary filter and set the given filter as its parent.  If no filter is provided,
+   * the current filter is used instead.
+   * @param parent
+   */
+  void createGrainBoundaryFilter(VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Create a contour filter and set the given filter as its parent.  If no filter is provided,
+   * the current filter is used instead.
+   * @param parent
+   */
+  void createContourFilter(VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Create a calculator filter and set the given filter as its parent.  If no filter is provided,
+   * the current filter is used instead.
+   * @param parent
+   */
+  void createCalculatorFilter(VSAbstractFilter* parent = nullptr);
+
   /**
    * @brief Create a threshold filter and set the given filter as its parent.  If no filter is provided,
    * the current filter is used instead.
@@ -327,6 +348,12 @@ protected slots:
    */
   virtual void reloadFileFilter(VSFileNameFilter* filter);
 
+  /**
+   * @brief Asks the user for a larger region of interest and expands the filter's ImageGeom to it
+   * @param filter
+   */
+  virtual void expandImageRegion(VSSIMPLDataContainerFilter* filter);
+
   /**
    * @brief Connects a new VSAbstractViewWidget to the main widget
    */
@@ -208,6 +208,12 @@ QMenu* VSViewWidget::getContextMenu(VSAbstractFilter* filter)
       // Color By Array menu
       menu->addMenu(settings->getColorByMenu());
 
+      // Color by orientation menu
+      if(settings->hasOrientationData())
+      {
+        menu->addMenu(settings->getIPFColorMenu());
+      }
+
       // Color by Component menu
       if(settings->hasMulipleComponents())
       {
@@ -288,6 +294,12 @@ void VSViewWidget::showVisualizationContextMenu(const QPoint& point)
       // Color By Array menu
       menu.addMenu(settings->getColorByMenu());
 
+      // Color by orientation menu
+      if(settings->hasOrientationData())
+      {
+        menu.addMenu(settings->getIPFColorMenu());
+      }
+
       // Color by Component menu
       if(settings->hasMulipleComponents())
       {
@@ -377,6 +389,9 @@ void VSViewWidget::showOnlyFilter(VSFilterViewSettings* settings)
 // -----------------------------------------------------------------------------
 void VSViewWidget::showAllFilters()
 {
+  // Filters that only exist in the shared view values need to take the new setting too
+  getFilterViewModel()->createAllFilterViewSettings();
+
   VSFilterViewSettings::Map settingsMap = getAllFilterViewSettings();
   for(auto iter = settingsMap.begin(); iter != settingsMap.end(); iter++)
   {
@@ -389,6 +404,8 @@ void VSViewWidget::showAllFilters()
 // -----------------------------------------------------------------------------
 void VSViewWidget::showOnlyScalarBar(VSFilterViewSettings* settings)
 {
+  getFilterViewModel()->createAllFilterViewSettings();
+
   VSFilterViewSettings::Map settingsMap = getAllFilterViewSettings();
   for(auto iter = settingsMap.begin(); iter != settingsMap.end(); iter++)
   {
@@ -412,6 +429,8 @@ void VSViewWidget::showOnlyScalarBar(VSFilterViewSettings* settings)
 // -----------------------------------------------------------------------------
 void VSViewWidget::hideAllScalarBars()
 {
+  getFilterViewModel()->createAllFilterViewSettings();
+
   VSFilterViewSettings::Map settingsMap = getAllFilterViewSettings();
   for(auto iter = settingsMap.begin(); iter != settingsMap.end(); iter++)
   {
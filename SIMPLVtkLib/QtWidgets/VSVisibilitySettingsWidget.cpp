@@ -130,6 +130,8 @@ void VSVisibilitySettingsWidget::connectFilterViewSettings(VSFilterViewSettings*
 
   if(m_ViewSettings)
   {
+    // Editing requires the rendering resources even while the filter is hidden
+    m_ViewSettings->createResources();
     connect(settings, &VSFilterViewSettings::representationChanged, this, &VSVisibilitySettingsWidget::listenRepresentationType);
     connect(settings, &VSFilterViewSettings::activeArrayNameChanged, this, &VSVisibilitySettingsWidget::listenArrayName);
     connect(settings, &VSFilterViewSettings::activeComponentIndexChanged, this, &VSVisibilitySettingsWidget::listenComponentIndex);
@@ -35,10 +35,15 @@
 
 #include "VSVisualizationWidget.h"
 
+#include <algorithm>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QStringList>
 #include <QtGui/QMouseEvent>
 #include <QtWidgets/QAction>
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QMenu>
+#include <QtWidgets/QToolTip>
 
 #include <vtkAutoInit.h>
 #include <vtkInteractionStyleModule.h>
@@ -49,7 +54,9 @@ VTK_MODULE_INIT(vtkInteractionStyle)
 #include <vtkAxesActor.h>
 #include <vtkBMPWriter.h>
 #include <vtkCamera.h>
+#include <vtkCellData.h>
 #include <vtkCellPicker.h>
+#include <vtkDataArray.h>
 #include <vtkFollower.h>
 #include <vtkGenericOpenGLRenderWindow.h>
 #include <vtkInteractorStyle.h>
@@ -57,6 +64,7 @@ VTK_MODULE_INIT(vtkInteractionStyle)
 #include <vtkJPEGWriter.h>
 #include <vtkOrientationMarkerWidget.h>
 #include <vtkPNGWriter.h>
+#include <vtkPointData.h>
 #include <vtkPointPicker.h>
 #include <vtkPropPicker.h>
 #include <vtkProperty.h>
@@ -68,6 +76,12 @@ VTK_MODULE_INIT(vtkInteractionStyle)
 
 VSVisualizationWidget* VSVisualizationWidget::m_LinkingWidget = nullptr;
 
+namespace
+{
+// Weight given to the newest render measurement when smoothing render costs
+const double RenderCostSmoothing = 0.25;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -75,6 +89,9 @@ VSVisualizationWidget::VSVisualizationWidget(QWidget* parent, unsigned int numLa
 : QVTKOpenGLWidget(parent)
 , m_NumRenderLayers(numLayers)
 {
+  m_LinkedRenderTimer.setSingleShot(true);
+  connect(&m_LinkedRenderTimer, SIGNAL(timeout()), this, SLOT(renderLinkedWindows()));
+
   setupGui();
 }
 
@@ -461,6 +478,11 @@ void VSVisualizationWidget::mousePressEvent(QMouseEvent* event)
 {
   QVTKOpenGLWidget::mousePressEvent(event);
 
+  if(m_ProbeEnabled && event->button() == Qt::LeftButton)
+  {
+    updateProbe(event->globalPos());
+  }
+
   if(event->button() == Qt::RightButton)
   {
     m_CheckContextMenu = true;
@@ -480,6 +502,9 @@ void VSVisualizationWidget::mouseReleaseEvent(QMouseEvent* event)
 {
   QVTKOpenGLWidget::mouseReleaseEvent(event);
 
+  // The camera gesture has ended so linked views should catch up with the final state
+  flushLinkedRenderWindows();
+
   if(m_CheckContextMenu)
   {
     emit customContextMenuRequested(event->pos());
@@ -494,6 +519,12 @@ void VSVisualizationWidget::mouseMoveEvent(QMouseEvent* event)
   QVTKOpenGLWidget::mouseMoveEvent(event);
 
   m_CheckContextMenu = false;
+
+  // Only follow the cursor while hovering so camera gestures are not slowed down
+  if(m_ProbeEnabled && Qt::NoButton == event->buttons())
+  {
+    updateProbe(event->globalPos());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -544,6 +575,7 @@ void VSVisualizationWidget::showContextMenu(const QPoint& pos)
 
   QMenu contextMenu("Visualization", this);
   contextMenu.addAction(getLinkCamerasAction());
+  contextMenu.addAction(getProbeAction());
 
   contextMenu.exec(mapToGlobal(pos));
 }
@@ -581,6 +613,116 @@ VSVisualizationWidget::LinkedRenderWindowType VSVisualizationWidget::getLinkedRe
   return m_LinkedRenderWindows;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVisualizationWidget::requestLinkedRender()
+{
+  if(m_LinkedRenderWindows.empty())
+  {
+    return;
+  }
+
+  m_LinkedRenderPending = true;
+  if(m_LinkedRenderRate <= 0.0 || m_LinkedRenderTimer.isActive())
+  {
+    return;
+  }
+
+  // Never schedule linked renders faster than the linked windows can be drawn
+  // so that the driving view stays responsive.
+  double interval = 1000.0 / m_LinkedRenderRate;
+  double linkedCost = 0.0;
+  for(VTK_PTR(vtkRenderWindow) renderWindow : m_LinkedRenderWindows)
+  {
+    double cost = getRenderCost(renderWindow);
+    if(renderWindow != GetRenderWindow() && cost > 0.0)
+    {
+      linkedCost += cost;
+    }
+  }
+
+  m_LinkedRenderTimer.start(static_cast<int>(std::max(interval, linkedCost)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVisualizationWidget::flushLinkedRenderWindows()
+{
+  m_LinkedRenderTimer.stop();
+  renderLinkedWindows();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVisualizationWidget::renderLinkedWindows()
+{
+  if(false == m_LinkedRenderPending)
+  {
+    return;
+  }
+
+  m_LinkedRenderPending = false;
+
+  QElapsedTimer timer;
+  for(VTK_PTR(vtkRenderWindow) renderWindow : m_LinkedRenderWindows)
+  {
+    // The driving window is rendered by its own interactor
+    if(renderWindow == GetRenderWindow())
+    {
+      continue;
+    }
+
+    timer.start();
+    renderWindow->Render();
+    double milliseconds = timer.nsecsElapsed() / 1.0e6;
+
+    RenderCostMapType::iterator iter = m_RenderCosts.find(renderWindow);
+    if(iter == m_RenderCosts.end())
+    {
+      m_RenderCosts[renderWindow] = milliseconds;
+    }
+    else
+    {
+      iter->second += RenderCostSmoothing * (milliseconds - iter->second);
+    }
+
+    emit renderCostMeasured(renderWindow, milliseconds);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVisualizationWidget::setLinkedRenderRate(double framesPerSecond)
+{
+  m_LinkedRenderRate = framesPerSecond;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSVisualizationWidget::getLinkedRenderRate() const
+{
+  return m_LinkedRenderRate;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSVisualizationWidget::getRenderCost(vtkRenderWindow* renderWindow) const
+{
+  RenderCostMapType::const_iterator iter = m_RenderCosts.find(renderWindow);
+  if(iter == m_RenderCosts.end())
+  {
+    return -1.0;
+  }
+
+  return iter->second;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -595,6 +737,144 @@ QAction* VSVisualizationWidget::getLinkCamerasAction()
   return m_LinkCameraAction;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QAction* VSVisualizationWidget::getProbeAction()
+{
+  if(nullptr == m_ProbeAction)
+  {
+    m_ProbeAction = new QAction("Probe Values", this);
+    m_ProbeAction->setCheckable(true);
+    m_ProbeAction->setChecked(m_ProbeEnabled);
+    connect(m_ProbeAction, SIGNAL(toggled(bool)), this, SLOT(setProbeEnabled(bool)));
+  }
+
+  return m_ProbeAction;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSVisualizationWidget::isProbeEnabled() const
+{
+  return m_ProbeEnabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVisualizationWidget::setProbeEnabled(bool enabled)
+{
+  m_ProbeEnabled = enabled;
+  if(m_ProbeAction)
+  {
+    m_ProbeAction->setChecked(enabled);
+  }
+
+  // Hover events are required for the readout to follow the cursor
+  if(enabled)
+  {
+    setMouseTracking(true);
+  }
+  else
+  {
+    QToolTip::hideText();
+    emit probeUpdated(nullptr, QString());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSVisualizationWidget::updateProbe(const QPoint& globalPos)
+{
+  if(nullptr == GetInteractor())
+  {
+    return;
+  }
+
+  int* eventPos = GetInteractor()->GetEventPosition();
+  int pos[2] = {eventPos[0], eventPos[1]};
+  VSFilterPicker::ProbeResult result = probeScreenCoords(pos);
+
+  QString text = CreateProbeText(result);
+  if(text.isEmpty())
+  {
+    QToolTip::hideText();
+  }
+  else
+  {
+    QToolTip::showText(globalPos, text, this);
+  }
+
+  emit probeUpdated(result.m_Filter, text);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterPicker::ProbeResult VSVisualizationWidget::probeScreenCoords(int pos[2])
+{
+  vtkInteractorObserver* obs = GetRenderWindow()->GetInteractor()->GetInteractorStyle();
+  VSInteractorStyleFilterCamera* style = VSInteractorStyleFilterCamera::SafeDownCast(obs);
+  if(nullptr == style)
+  {
+    return VSFilterPicker::ProbeResult();
+  }
+
+  return style->probeScreenCoords(pos);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSVisualizationWidget::CreateProbeText(const VSFilterPicker::ProbeResult& result)
+{
+  if(nullptr == result.m_Filter || nullptr == result.m_DataSet)
+  {
+    return QString();
+  }
+
+  auto appendArrayValues = [](QStringList& lines, vtkFieldData* fieldData, vtkIdType tupleId) {
+    for(int i = 0; i < fieldData->GetNumberOfArrays(); i++)
+    {
+      vtkDataArray* array = fieldData->GetArray(i);
+      if(nullptr == array || tupleId >= array->GetNumberOfTuples())
+      {
+        continue;
+      }
+
+      QStringList values;
+      int numComps = array->GetNumberOfComponents();
+      for(int comp = 0; comp < numComps; comp++)
+      {
+        values.push_back(QString::number(array->GetComponent(tupleId, comp), 'g', 6));
+      }
+
+      QString name = array->GetName() ? QString(array->GetName()) : QString("Array %1").arg(i);
+      lines.push_back(QString("  %1: %2").arg(name).arg(values.join(", ")));
+    }
+  };
+
+  QStringList lines;
+  lines.push_back(result.m_Filter->getFilterName());
+  lines.push_back(QString("Position: %1, %2, %3").arg(result.m_Position[0], 0, 'g', 6).arg(result.m_Position[1], 0, 'g', 6).arg(result.m_Position[2], 0, 'g', 6));
+
+  if(result.m_CellId >= 0 && result.m_DataSet->GetCellData()->GetNumberOfArrays() > 0)
+  {
+    lines.push_back(QString("Cell %1").arg(result.m_CellId));
+    appendArrayValues(lines, result.m_DataSet->GetCellData(), result.m_CellId);
+  }
+  if(result.m_PointId >= 0 && result.m_DataSet->GetPointData()->GetNumberOfArrays() > 0)
+  {
+    lines.push_back(QString("Point %1").arg(result.m_PointId));
+    appendArrayValues(lines, result.m_DataSet->GetPointData(), result.m_PointId);
+  }
+
+  return lines.join("\n");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -611,6 +891,5 @@ VSAbstractFilter* VSVisualizationWidget::getFilterFromScreenCoords(int pos[2])
   VSAbstractFilter* filter = nullptr;
   std::tie(prop, filter) = style->getFilterFromScreenCoords(pos);
 
-  render();
   return filter;
 }
@@ -35,13 +35,17 @@
 
 #pragma once
 
+#include <map>
 #include <set>
 
+#include <QtCore/QTimer>
+
 #include <QVTKOpenGLWidget.h>
 #include <vtkInteractorStyle.h>
 #include <vtkOrientationMarkerWidget.h>
 #include <vtkRenderer.h>
 
+#include "SIMPLVtkLib/QtWidgets/VSFilterPicker.h"
 #include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
@@ -58,6 +62,7 @@ class SIMPLVtkLib_EXPORT VSVisualizationWidget : public QVTKOpenGLWidget
 
 public:
   using LinkedRenderWindowType = std::set<VTK_PTR(vtkRenderWindow)>;
+  using RenderCostMapType = std::map<vtkRenderWindow*, double>;
 
   /**
    * @brief Constructor
@@ -101,6 +106,43 @@ public:
    */
   LinkedRenderWindowType getLinkedRenderWindows();
 
+  /**
+   * @brief Requests that the linked vtkRenderWindows be rendered.  This widget's own
+   * render window is driven by the interactor and is skipped.  Requests are coalesced
+   * and serviced at most once per linked render interval.  If the linked render rate
+   * is 0, linked windows are only rendered when flushLinkedRenderWindows is called.
+   */
+  void requestLinkedRender();
+
+  /**
+   * @brief Immediately renders any linked vtkRenderWindows with a pending render request.
+   * This is called when a camera gesture ends so that linked views display the final state.
+   */
+  void flushLinkedRenderWindows();
+
+  /**
+   * @brief Sets the maximum number of times per second linked vtkRenderWindows are
+   * rendered while this widget is being interacted with.  A value of 0 or less only
+   * renders linked windows at the end of each gesture.
+   * @param framesPerSecond
+   */
+  void setLinkedRenderRate(double framesPerSecond);
+
+  /**
+   * @brief Returns the maximum linked render rate in frames per second
+   * @return
+   */
+  double getLinkedRenderRate() const;
+
+  /**
+   * @brief Returns the smoothed time in milliseconds taken to render the given
+   * vtkRenderWindow the last time it was rendered as a linked window.  Returns -1
+   * if the window has not been measured.
+   * @param renderWindow
+   * @return
+   */
+  double getRenderCost(vtkRenderWindow* renderWindow) const;
+
   /**
    * @brief Returns the QAction for linking this widget's camera with another.
    * @return
@@ -120,9 +162,51 @@ public:
    */
   void useOwnContextMenu(bool own);
 
+  /**
+   * @brief Returns the checkable QAction for toggling the value probe
+   * @return
+   */
+  QAction* getProbeAction();
+
+  /**
+   * @brief Returns true if array values are probed under the cursor.  Returns false otherwise.
+   * @return
+   */
+  bool isProbeEnabled() const;
+
+  /**
+   * @brief Returns the array values for the topmost visible filter at the given screen coordinates
+   * @param pos
+   * @return
+   */
+  VSFilterPicker::ProbeResult probeScreenCoords(int pos[2]);
+
+  /**
+   * @brief Creates a readout of all array values for the probed cell and point
+   * @param result
+   * @return
+   */
+  static QString CreateProbeText(const VSFilterPicker::ProbeResult& result);
+
 signals:
   void mousePressed();
 
+  /**
+   * @brief Emitted whenever a linked vtkRenderWindow is rendered with the time
+   * in milliseconds that the render took.
+   * @param renderWindow
+   * @param milliseconds
+   */
+  void renderCostMeasured(vtkRenderWindow* renderWindow, double milliseconds);
+
+  /**
+   * @brief Emitted when the value probe is updated with the readout for the cursor position.
+   * The text is empty when there is no visible filter under the cursor.
+   * @param filter
+   * @param text
+   */
+  void probeUpdated(VSAbstractFilter* filter, const QString& text);
+
 public slots:
   /**
    * @brief Renders the VTK context
@@ -174,6 +258,12 @@ public slots:
    */
   virtual void clearRenderWindow();
 
+  /**
+   * @brief Sets whether array values are probed under the cursor
+   * @param enabled
+   */
+  void setProbeEnabled(bool enabled);
+
 protected:
   /**
    * @brief Sets up the GUI as well as initializes the Renderer and Axes
@@ -227,15 +317,33 @@ protected:
    */
   void linkCameraWith(VSVisualizationWidget* widget);
 
+  /**
+   * @brief Probes the data under the current interactor event position and displays the result
+   * @param globalPos
+   */
+  void updateProbe(const QPoint& globalPos);
+
 protected slots:
   virtual void showContextMenu(const QPoint&);
   virtual void startLinkCameras();
 
+  /**
+   * @brief Renders the linked vtkRenderWindows with pending render requests
+   * and measures the time spent rendering each one.
+   */
+  void renderLinkedWindows();
+
 private:
   VTK_PTR(vtkOrientationMarkerWidget) m_OrientationWidget = nullptr;
   VTK_PTR(vtkRenderer) m_Renderer = nullptr;
   LinkedRenderWindowType m_LinkedRenderWindows;
+  QTimer m_LinkedRenderTimer;
+  bool m_LinkedRenderPending = false;
+  double m_LinkedRenderRate = 30.0;
+  RenderCostMapType m_RenderCosts;
   QAction* m_LinkCameraAction = nullptr;
+  QAction* m_ProbeAction = nullptr;
+  bool m_ProbeEnabled = false;
   bool m_OwnContextMenu = true;
   bool m_CheckContextMenu = false;
 
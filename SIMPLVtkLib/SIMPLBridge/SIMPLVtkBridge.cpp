@@ -42,6 +42,7 @@
 #include <vtkDataArray.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkImageData.h>
 #include <vtkIntArray.h>
 #include <vtkLine.h>
@@ -54,22 +55,24 @@
 #include <vtkPolyData.h>
 #include <vtkPolygon.h>
 #include <vtkRectilinearGrid.h>
+#include <vtkSMPTools.h>
 #include <vtkScalarBarActor.h>
 #include <vtkScalarBarWidget.h>
 #include <vtkShortArray.h>
 #include <vtkStructuredPoints.h>
 #include <vtkTextProperty.h>
+#include <vtkTypeInt64Array.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkUnsignedIntArray.h>
 #include <vtkUnsignedLongLongArray.h>
 #include <vtkUnsignedShortArray.h>
 #include <vtkUnstructuredGrid.h>
+#include <vtkVersion.h>
 #include <vtkVertexGlyphFilter.h>
 
 #include "SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.h"
-#include "SIMPLVtkLib/SIMPLBridge/VSQuadGeom.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp"
 #include "SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h"
-#include "SIMPLVtkLib/SIMPLBridge/VSTriangleGeom.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSVertexGeom.h"
 
 #define AM_COLLISIONS 1
@@ -221,6 +224,14 @@ SIMPLVtkBridge::WrappedDataContainerPtr SIMPLVtkBridge::WrapDataContainerAsStruc
       }
     }
 
+    // Feature arrays are added after the point data is created so they are never copied
+    size_t numCellArrays = wrappedDcStruct->m_CellData.size();
+    WrapIndexedAttrMatrixData(dc, wrappedDcStruct->m_CellData);
+    for(size_t i = numCellArrays; i < wrappedDcStruct->m_CellData.size(); i++)
+    {
+      dataSet->GetCellData()->AddArray(wrappedDcStruct->m_CellData[i]->m_VtkArray);
+    }
+
     return wrappedDcStruct;
   }
 
@@ -384,6 +395,89 @@ bool SIMPLVtkBridge::WrapAttrMatrixData(AttributeMatrix::Pointer attrMat, Wrappe
   return false;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLVtkBridge::WrapIndexedAttrMatrixData(DataContainer::Pointer dc, WrappedDataArrayPtrCollection& cellCollection)
+{
+  if(nullptr == dc)
+  {
+    return;
+  }
+
+  // Single component integer cell arrays are the candidates for indexing features or ensembles
+  std::vector<VTK_PTR(vtkDataArray)> indexArrays;
+  for(WrappedDataArrayPtr wrappedArray : cellCollection)
+  {
+    vtkDataArray* array = wrappedArray->m_VtkArray;
+    if(nullptr == array || array->GetNumberOfComponents() != 1)
+    {
+      continue;
+    }
+    if(array->GetDataType() == VTK_INT || array->GetDataType() == VTK_ID_TYPE)
+    {
+      indexArrays.push_back(array);
+    }
+  }
+
+  if(indexArrays.empty())
+  {
+    return;
+  }
+
+  DataContainer::AttributeMatrixMap_t amMap = dc->getAttributeMatrices();
+  for(DataContainer::AttributeMatrixMap_t::Iterator amIter = amMap.begin(); amIter != amMap.end(); ++amIter)
+  {
+    AttributeMatrix::Pointer attrMat = (*amIter);
+    if(!attrMat)
+    {
+      continue;
+    }
+
+    if(AttributeMatrix::Type::CellFeature != attrMat->getType() && AttributeMatrix::Type::CellEnsemble != attrMat->getType())
+    {
+      continue;
+    }
+
+    // The index array is the only candidate whose values cover exactly the matrix's tuples.
+    // Matrices matched by several arrays are ambiguous and left unwrapped.
+    const double numTuples = static_cast<double>(attrMat->getNumberOfTuples());
+    VTK_PTR(vtkDataArray) indices = nullptr;
+    int numMatches = 0;
+    for(const VTK_PTR(vtkDataArray)& indexArray : indexArrays)
+    {
+      double range[2];
+      indexArray->GetRange(range, 0);
+      if(range[0] >= 0.0 && range[1] == numTuples - 1.0)
+      {
+        indices = indexArray;
+        numMatches++;
+      }
+    }
+    if(1 != numMatches)
+    {
+      continue;
+    }
+
+    WrappedDataArrayPtrCollection indexedCollection;
+    WrappedDataArrayPtrCollection sourceCollection = WrapAttributeMatrixAsStructs(attrMat);
+    for(WrappedDataArrayPtr wrappedArray : sourceCollection)
+    {
+      VTK_PTR(vtkDataArray) indexedArray = VSIndexedDataArrays::Create(wrappedArray->m_VtkArray, indices);
+      if(nullptr == indexedArray)
+      {
+        continue;
+      }
+
+      wrappedArray->m_VtkArray = indexedArray;
+      indexedCollection.push_back(wrappedArray);
+    }
+
+    AppendAttrMatrixToNames(indexedCollection);
+    cellCollection.insert(cellCollection.end(), indexedCollection.begin(), indexedCollection.end());
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -433,6 +527,9 @@ void SIMPLVtkBridge::FinishWrappingDataContainerStruct(WrappedDataContainerPtr w
   // Handle Array Collisons before adding them to the vtkDataSet
   HandleArrayNameCollisions(wrappedDcStruct->m_CellData, wrappedDcStruct->m_PointData);
 
+  // Feature and ensemble arrays already carry their AttributeMatrix name
+  WrapIndexedAttrMatrixData(wrappedDcStruct->m_DataContainer, wrappedDcStruct->m_CellData);
+
   // Add CellData to the vtkDataSet
   vtkCellData* cellData = dataSet->GetCellData();
   for(WrappedDataArrayPtr wrappedCellData : wrappedDcStruct->m_CellData)
@@ -576,6 +673,64 @@ VTK_PTR(vtkDataArray) SIMPLVtkBridge::WrapVertices(SharedVertexList::Pointer ver
   return vtkArray;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkCellArray) SIMPLVtkBridge::WrapPolygons(SharedFaceList::Pointer faceList)
+{
+  VTK_NEW(vtkCellArray, polys);
+  if(nullptr == faceList)
+  {
+    return polys;
+  }
+
+  const vtkIdType numFaces = static_cast<vtkIdType>(faceList->getNumberOfTuples());
+  const vtkIdType numVerts = static_cast<vtkIdType>(faceList->getNumberOfComponents());
+
+#if VTK_MAJOR_VERSION >= 9
+  // The face list is used as the connectivity array without copying.  Only the
+  // offsets need to be generated since every face has the same number of vertices.
+  VTK_NEW(vtkTypeInt64Array, connectivity);
+  connectivity->SetVoidArray(faceList->getVoidPointer(0), faceList->getSize(), 1);
+
+  VTK_NEW(vtkTypeInt64Array, offsets);
+  offsets->SetNumberOfValues(numFaces + 1);
+  vtkTypeInt64* offsetPtr = offsets->GetPointer(0);
+  vtkSMPTools::For(0, numFaces + 1, [offsetPtr, numVerts](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      offsetPtr[i] = i * numVerts;
+    }
+  });
+
+  polys->SetData(offsets, connectivity);
+#else
+  // The legacy layout prefixes each face with its vertex count
+  const int64_t* facePtr = faceList->getPointer(0);
+  const vtkIdType cellSize = numVerts + 1;
+
+  VTK_NEW(vtkIdTypeArray, cells);
+  cells->SetNumberOfValues(numFaces * cellSize);
+  vtkIdType* cellPtr = cells->GetPointer(0);
+  vtkSMPTools::For(0, numFaces, [facePtr, cellPtr, numVerts, cellSize](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      vtkIdType* cell = cellPtr + i * cellSize;
+      const int64_t* face = facePtr + i * numVerts;
+      cell[0] = numVerts;
+      for(vtkIdType j = 0; j < numVerts; j++)
+      {
+        cell[j + 1] = static_cast<vtkIdType>(face[j]);
+      }
+    }
+  });
+
+  polys->SetCells(numFaces, cells);
+#endif
+
+  return polys;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -599,15 +754,16 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(EdgeGeom::Pointer geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(QuadGeom::Pointer geom)
 {
-  VTK_NEW(VSQuadGrid, dataSet);
-  VSQuadGeom* quadGeom = dataSet->GetImplementation();
-  quadGeom->SetGeometry(geom);
+  // Quads are already a surface so they are wrapped as vtkPolyData instead of a
+  // mapped unstructured grid that would need to be passed through a surface filter.
+  VTK_NEW(vtkPolyData, dataSet);
 
   VTK_NEW(vtkPoints, points);
   VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
   points->SetDataTypeToFloat();
   points->SetData(vertexArray);
   dataSet->SetPoints(points);
+  dataSet->SetPolys(WrapPolygons(geom->getQuads()));
 
   return dataSet;
 }
@@ -660,15 +816,14 @@ VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(TetrahedralGeom::Pointer geom)
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) SIMPLVtkBridge::WrapGeometry(TriangleGeom::Pointer geom)
 {
-  VTK_NEW(VtkTriangleGrid, dataSet);
-  VSTriangleGeom* triGeom = dataSet->GetImplementation();
-  triGeom->SetGeometry(geom);
+  VTK_NEW(vtkPolyData, dataSet);
 
   VTK_NEW(vtkPoints, points);
   VTK_PTR(vtkDataArray) vertexArray = WrapVertices(geom->getVertices());
   points->SetDataTypeToFloat();
   points->SetData(vertexArray);
   dataSet->SetPoints(points);
+  dataSet->SetPolys(WrapPolygons(geom->getTriangles()));
 
   return dataSet;
 }
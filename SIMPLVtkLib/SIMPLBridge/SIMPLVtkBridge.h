@@ -41,6 +41,7 @@
 
 #include <string>
 
+#include <vtkCellArray.h>
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
 
@@ -169,7 +170,8 @@ public:
   static VTK_PTR(vtkDataSet) WrapGeometry(ImageGeom::Pointer geom);
 
   /**
-   * @brief Creates and returns a vtkDataSet from SIMPLib's QuadGeom
+   * @brief Creates and returns a vtkPolyData from SIMPLib's QuadGeom.  The vertices and,
+   * where supported by VTK, the quad connectivity are shared with the QuadGeom.
    * @param geom
    * @return
    */
@@ -190,7 +192,8 @@ public:
   static VTK_PTR(vtkDataSet) WrapGeometry(TetrahedralGeom::Pointer geom);
 
   /**
-   * @brief Creates and returns a vtkDataSet from SIMPLib's TriangleGeom
+   * @brief Creates and returns a vtkPolyData from SIMPLib's TriangleGeom.  The vertices and,
+   * where supported by VTK, the triangle connectivity are shared with the TriangleGeom.
    * @param geom
    * @return
    */
@@ -217,6 +220,15 @@ public:
    */
   static VTK_PTR(vtkDataArray) WrapVertices(SharedVertexList::Pointer vertexArray);
 
+  /**
+   * @brief Creates and returns a vtkCellArray of polygons from SIMPLib's SharedFaceList.
+   * VTK 9 and newer reference the face list directly as the connectivity array.  Older
+   * versions require the legacy cell layout, which is built in a single parallel pass.
+   * @param faceList
+   * @return
+   */
+  static VTK_PTR(vtkCellArray) WrapPolygons(SharedFaceList::Pointer faceList);
+
   /**
    * @brief Creates and returns a vtkDataArray from SIMPLib's IDataArray
    * @param array
@@ -297,6 +309,16 @@ protected:
    */
   static bool WrapAttrMatrixData(AttributeMatrix::Pointer am, WrappedDataArrayPtrCollection& wrappedCollection, const int tuplesReq);
 
+  /**
+   * @brief Wraps the DataContainer's CellFeature and CellEnsemble AttributeMatrices as cell arrays
+   * that look up each cell's value through the single component integer cell array whose values
+   * range over the AttributeMatrix's tuples.  Values are never copied per cell.  The
+   * AttributeMatrix name is appended to the array names.
+   * @param dc
+   * @param cellCollection
+   */
+  static void WrapIndexedAttrMatrixData(DataContainer::Pointer dc, WrappedDataArrayPtrCollection& cellCollection);
+
 private:
   SIMPLVtkBridge(const SIMPLVtkBridge&); // Copy Constructor Not Implemented
   void operator=(const SIMPLVtkBridge&); // Operator '=' Not Implemented
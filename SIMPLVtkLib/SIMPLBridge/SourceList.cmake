@@ -1,20 +1,40 @@
 
 set(VS_SIMPLBridge_SRCS
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSAppendArrayFilter.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayCalculator.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayExpression.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSDataSetSnapshot.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.cpp
-	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSQuadGeom.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSFeatureBoundaryFilter.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImageContourFilter.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImageExtentFilter.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImagePointMarker.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImageSurfaceFilter.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSIPFColorGenerator.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.cpp
-	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTriangleGeom.cpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralSurfaceFilter.cpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSVertexGeom.cpp
 )
 
 set(VS_SIMPLBridge_HDRS
 	#${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkArray.hpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSAppendArrayFilter.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayCalculator.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSArrayExpression.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSDataSetSnapshot.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSEdgeGeom.h
-	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSQuadGeom.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSExtentDataArray.hpp
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSFeatureBoundaryFilter.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImageContourFilter.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImageExtentFilter.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImagePointMarker.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSImageSurfaceFilter.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSIPFColorGenerator.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h
-	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTriangleGeom.h
+	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSTetrahedralSurfaceFilter.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VSVertexGeom.h
 	${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/SIMPLBridge/VtkMacros.h
 )
@@ -0,0 +1,109 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkDataArray.h>
+#include <vtkPassInputTypeAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSAppendArrayFilter VSAppendArrayFilter.h SIMPLVtkLib/SIMPLBridge/VSAppendArrayFilter.h
+ * @brief This class passes a shallow copy of its input through with one additional point or
+ * cell array.  The input is never modified, so arrays generated for a single view can be
+ * shown without changing a filter output that other views and filters share.  The array is
+ * skipped if its number of tuples does not match the input.
+ */
+class SIMPLVtkLib_EXPORT VSAppendArrayFilter : public vtkPassInputTypeAlgorithm
+{
+public:
+  static VSAppendArrayFilter* New();
+  vtkTypeMacro(VSAppendArrayFilter, vtkPassInputTypeAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets the array added to the output.  Passing nullptr passes the input through unchanged.
+   * @param array
+   */
+  void SetArray(vtkDataArray* array);
+
+  /**
+   * @brief Returns the array added to the output
+   * @return
+   */
+  vtkDataArray* GetArray() const;
+
+  /**
+   * @brief Sets whether the array is added to the point data or the cell data
+   * @param pointData
+   */
+  void SetPointData(bool pointData);
+
+  /**
+   * @brief Returns true if the array is added to the point data
+   * @return
+   */
+  bool GetPointData() const;
+
+protected:
+  VSAppendArrayFilter();
+  ~VSAppendArrayFilter() override;
+
+  /**
+   * @brief Only accepts vtkDataSet inputs
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Shallow copies the input and adds the array
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+private:
+  VTK_PTR(vtkDataArray) m_Array = nullptr;
+  bool m_PointData = false;
+
+  VSAppendArrayFilter(const VSAppendArrayFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSAppendArrayFilter&) = delete;      // Operator '=' Not Implemented
+};
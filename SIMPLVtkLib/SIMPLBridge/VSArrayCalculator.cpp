@@ -1,5 +1,5 @@
 /* ============================================================================
- * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
  *
  * Redistribution and use in source and binary forms, with or without modification,
  * are permitted provided that the following conditions are met:
@@ -33,199 +33,158 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
-#include "VSQuadGeom.h"
+#include "VSArrayCalculator.h"
 
-#include <cmath>
+#include <vtkCellData.h>
+#include <vtkDataSet.h>
+#include <vtkDataArray.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkPointData.h>
 
-#include <vtkCellType.h>
-#include <vtkCellTypes.h>
-#include <vtkIdTypeArray.h>
-#include <vtkPoints.h>
-
-const int CELL_TYPE = VTK_QUAD;
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayExpression.h"
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-VSQuadGrid* VSQuadGrid::New()
+VSArrayCalculator* VSArrayCalculator::New()
 {
-  return new VSQuadGrid();
+  return new VSArrayCalculator();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-VSQuadGeom* VSQuadGeom::New()
+VSArrayCalculator::VSArrayCalculator()
+: vtkPassInputTypeAlgorithm()
 {
-  return new VSQuadGeom();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSQuadGeom::PrintSelf(ostream& os, vtkIndent indent)
-{
-  this->Superclass::PrintSelf(os, indent);
-  os << indent << "Elements: " << GetNumberOfCells() << endl;
-  os << indent << "CellType: " << vtkCellTypes::GetClassNameFromTypeId(CELL_TYPE) << endl;
-  os << indent << "CellSize: " << GetMaxCellSize() << endl;
-  os << indent << "NumberOfCells: " << GetNumberOfCells() << endl;
-}
+VSArrayCalculator::~VSArrayCalculator() = default;
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-VSQuadGeom::VSQuadGeom()
-: vtkObject()
+void VSArrayCalculator::PrintSelf(ostream& os, vtkIndent indent)
 {
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Expression: " << m_Expression << endl;
+  os << indent << "Result Array Name: " << m_ResultArrayName << endl;
+  os << indent << "Attribute Type: " << m_AttributeType << endl;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSQuadGeom::SetGeometry(QuadGeom::Pointer geom)
-{
-  m_Geom = geom;
-  m_Geom->findElementsContainingVert();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VSQuadGeom::GetNumberOfCells()
-{
-  if(nullptr == m_Geom)
-  {
-    vtkErrorMacro("Wrapper Geometry missing a Geometry object");
-    return -1;
-  }
-
-  return m_Geom->getNumberOfElements();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-int VSQuadGeom::GetCellType(vtkIdType cellId)
+void VSArrayCalculator::SetExpression(const std::string& expression)
 {
-  if(0 == GetNumberOfCells())
+  if(expression != m_Expression)
   {
-    return VTK_EMPTY_CELL;
+    m_Expression = expression;
+    Modified();
   }
-
-  return CELL_TYPE;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSQuadGeom::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
+std::string VSArrayCalculator::GetExpression() const
 {
-  const int numVerts = 4;
-
-  int64_t verts[numVerts];
-  m_Geom->getVertsAtQuad(cellId, verts);
-
-  ptIds->SetNumberOfIds(numVerts);
-  for(int i = 0; i < numVerts; i++)
-  {
-    ptIds->SetId(i, verts[i]);
-  }
+  return m_Expression;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSQuadGeom::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
+void VSArrayCalculator::SetResultArrayName(const std::string& name)
 {
-  ElementDynamicList::Pointer elementsContainingList = m_Geom->getElementsContainingVert();
-
-  DynamicListArray<uint16_t, int64_t>::ElementList listArray = elementsContainingList->getElementList(ptId);
-
-  cellIds->SetNumberOfIds(listArray.ncells);
-  for(int i = 0; i < listArray.ncells; i++)
+  if(name != m_ResultArrayName)
   {
-    cellIds->SetId(i, listArray.cells[i]);
+    m_ResultArrayName = name;
+    Modified();
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int VSQuadGeom::GetMaxCellSize()
+std::string VSArrayCalculator::GetResultArrayName() const
 {
-  return std::ceil(m_MaxCellSize);
+  return m_ResultArrayName;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSQuadGeom::GetIdsOfCellsOfType(int type, vtkIdTypeArray* array)
+void VSArrayCalculator::SetAttributeType(int association)
 {
-  if(CELL_TYPE == type)
+  if(association != m_AttributeType)
   {
-    int numValues = GetNumberOfCells();
-
-    array = vtkIdTypeArray::New();
-    array->SetNumberOfTuples(numValues);
-    array->SetNumberOfComponents(1);
-
-    vtkIdType* arrayValues = new vtkIdType[numValues];
-    for(int i = 0; i < numValues; i++)
-    {
-      arrayValues[i] = i;
-    }
-
-    array->SetVoidArray(arrayValues, numValues, 0);
+    m_AttributeType = association;
+    Modified();
   }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-int VSQuadGeom::IsHomogeneous()
+int VSArrayCalculator::GetAttributeType() const
 {
-  return 1;
+  return m_AttributeType;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void VSQuadGeom::Allocate(vtkIdType numCells, int extSize)
+std::string VSArrayCalculator::GetErrorMessage() const
 {
-  vtkErrorMacro("Read only container.");
+  return m_ErrorMessage;
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-vtkIdType VSQuadGeom::InsertNextCell(int type, const vtkIdList ptIds[])
+int VSArrayCalculator::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
+  vtkDataSet* input = vtkDataSet::GetData(inputVector[0], 0);
+  vtkDataSet* output = vtkDataSet::GetData(outputVector, 0);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VSQuadGeom::InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[])
-{
-  vtkErrorMacro("Read only container.");
-  return -1;
-}
+  output->ShallowCopy(input);
+  m_ErrorMessage.clear();
+  if(m_Expression.empty())
+  {
+    return 1;
+  }
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-vtkIdType VSQuadGeom::InsertNextCell(int type, vtkIdType npts, const vtkIdType ptIds[], vtkIdType nfaces, const vtkIdType faces[])
-{
-  return -1;
-}
+  const bool pointData = (vtkDataObject::FIELD_ASSOCIATION_POINTS == m_AttributeType);
+  vtkDataSetAttributes* attributes = pointData ? static_cast<vtkDataSetAttributes*>(output->GetPointData()) : output->GetCellData();
+  const vtkIdType numTuples = pointData ? output->GetNumberOfPoints() : output->GetNumberOfCells();
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void VSQuadGeom::ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
-{
-  vtkErrorMacro("Read only container.");
+  // Errors leave the input unchanged so the pipeline below keeps working
+  VSArrayExpression expression;
+  if(false == expression.compile(m_Expression, attributes))
+  {
+    m_ErrorMessage = expression.getErrorMessage();
+    vtkWarningMacro(<< m_ErrorMessage);
+    return 1;
+  }
+
+  VTK_PTR(vtkDataArray) result = expression.evaluate(numTuples, m_ResultArrayName);
+  if(nullptr == result)
+  {
+    m_ErrorMessage = "The arrays used do not match the number of " + std::string(pointData ? "points" : "cells");
+    vtkWarningMacro(<< m_ErrorMessage);
+    return 1;
+  }
+
+  attributes->AddArray(result);
+  attributes->SetActiveScalars(m_ResultArrayName.c_str());
+  return 1;
 }
@@ -0,0 +1,124 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <string>
+
+#include <vtkDataObject.h>
+#include <vtkPassInputTypeAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSArrayCalculator VSArrayCalculator.h SIMPLVtkLib/SIMPLBridge/VSArrayCalculator.h
+ * @brief This class passes its input through with an additional array calculated from an
+ * expression over the input's cell or point arrays.  The expression is compiled once per
+ * update with VSArrayExpression and the result becomes the active scalars.  Input arrays
+ * are shared with the output rather than copied.
+ */
+class SIMPLVtkLib_EXPORT VSArrayCalculator : public vtkPassInputTypeAlgorithm
+{
+public:
+  static VSArrayCalculator* New();
+  vtkTypeMacro(VSArrayCalculator, vtkPassInputTypeAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets the expression to evaluate
+   * @param expression
+   */
+  void SetExpression(const std::string& expression);
+
+  /**
+   * @brief Returns the expression to evaluate
+   * @return
+   */
+  std::string GetExpression() const;
+
+  /**
+   * @brief Sets the name of the calculated array
+   * @param name
+   */
+  void SetResultArrayName(const std::string& name);
+
+  /**
+   * @brief Returns the name of the calculated array
+   * @return
+   */
+  std::string GetResultArrayName() const;
+
+  /**
+   * @brief Sets whether cell or point arrays are used.  The association should be either
+   * vtkDataObject::FIELD_ASSOCIATION_CELLS or vtkDataObject::FIELD_ASSOCIATION_POINTS.
+   * @param association
+   */
+  void SetAttributeType(int association);
+
+  /**
+   * @brief Returns whether cell or point arrays are used
+   * @return
+   */
+  int GetAttributeType() const;
+
+  /**
+   * @brief Returns the error message from the last update or an empty string if the
+   * expression was evaluated
+   * @return
+   */
+  std::string GetErrorMessage() const;
+
+protected:
+  VSArrayCalculator();
+  ~VSArrayCalculator() override;
+
+  /**
+   * @brief Evaluates the expression and adds the result to the output
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+private:
+  std::string m_Expression;
+  std::string m_ResultArrayName = "Result";
+  int m_AttributeType = vtkDataObject::FIELD_ASSOCIATION_CELLS;
+  std::string m_ErrorMessage;
+
+  VSArrayCalculator(const VSArrayCalculator&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSArrayCalculator&) = delete;    // Operator '=' Not Implemented
+};
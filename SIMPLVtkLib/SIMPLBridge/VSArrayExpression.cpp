@@ -0,0 +1,962 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSArrayExpression.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+
+#include <vtkArrayDispatch.h>
+#include <vtkDataArrayAccessor.h>
+#include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
+#include <vtkFloatArray.h>
+#include <vtkMath.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+
+namespace
+{
+// Large enough to hide the cost of dispatching each instruction while a block of every stack entry fits in cache
+const vtkIdType BlockSize = 1024;
+
+/**
+ * @brief Loads a component of the given tuples as doubles through the array's typed
+ * accessor.  A negative component loads the magnitude of every component instead.
+ * @param array
+ * @param numComps
+ * @param component
+ * @param begin
+ * @param count
+ * @param values
+ */
+template <typename ArrayT>
+void LoadValues(vtkDataArray* array, int numComps, int component, vtkIdType begin, vtkIdType count, double* values)
+{
+  const vtkDataArrayAccessor<ArrayT> accessor(static_cast<ArrayT*>(array));
+  if(component >= 0)
+  {
+    for(vtkIdType i = 0; i < count; i++)
+    {
+      values[i] = static_cast<double>(accessor.Get(begin + i, component));
+    }
+    return;
+  }
+
+  for(vtkIdType i = 0; i < count; i++)
+  {
+    double sum = 0.0;
+    for(int c = 0; c < numComps; c++)
+    {
+      const double value = static_cast<double>(accessor.Get(begin + i, c));
+      sum += value * value;
+    }
+    values[i] = std::sqrt(sum);
+  }
+}
+
+/**
+ * @brief Selects the LoadValues instantiation for the array's concrete type
+ */
+struct SelectLoadValues
+{
+  void (*m_Load)(vtkDataArray*, int, int, vtkIdType, vtkIdType, double*) = nullptr;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    m_Load = &LoadValues<ArrayT>;
+  }
+};
+
+/**
+ * @brief Applies the operation to every value and writes the results to the output, which
+ * may be the input itself
+ */
+template <typename OutT, typename Op>
+void ApplyUnary(const double* values, OutT* output, vtkIdType count, Op op)
+{
+  for(vtkIdType i = 0; i < count; i++)
+  {
+    output[i] = static_cast<OutT>(op(values[i]));
+  }
+}
+
+/**
+ * @brief Applies the operation to every pair of values and writes the results to the
+ * output, which may be the left hand side itself
+ */
+template <typename OutT, typename Op>
+void ApplyBinary(const double* lhs, const double* rhs, OutT* output, vtkIdType count, Op op)
+{
+  for(vtkIdType i = 0; i < count; i++)
+  {
+    output[i] = static_cast<OutT>(op(lhs[i], rhs[i]));
+  }
+}
+} // namespace
+
+/**
+ * @class VSArrayExpression::Parser
+ * @brief Recursive descent parser that writes the postfix instructions and array inputs
+ * for an expression into a VSArrayExpression.
+ */
+class VSArrayExpression::Parser
+{
+public:
+  Parser(VSArrayExpression& expression, const std::string& text, vtkFieldData* fieldData)
+  : m_Expression(expression)
+  , m_Text(text)
+  , m_FieldData(fieldData)
+  {
+  }
+
+  /**
+   * @brief Parses the whole expression.  Returns false and sets the error message if it is invalid.
+   * @return
+   */
+  bool parse()
+  {
+    if(false == parseOr())
+    {
+      return false;
+    }
+
+    skipWhitespace();
+    if(m_Pos < m_Text.size())
+    {
+      return fail("Unexpected '" + m_Text.substr(m_Pos, 1) + "'");
+    }
+
+    return true;
+  }
+
+private:
+  struct Function
+  {
+    const char* m_Name;
+    OpCode m_Op;
+    int m_NumArgs;
+  };
+
+  void skipWhitespace()
+  {
+    while(m_Pos < m_Text.size() && std::isspace(static_cast<unsigned char>(m_Text[m_Pos])))
+    {
+      m_Pos++;
+    }
+  }
+
+  bool match(const char* token)
+  {
+    skipWhitespace();
+    const size_t length = std::strlen(token);
+    if(m_Text.compare(m_Pos, length, token) != 0)
+    {
+      return false;
+    }
+
+    m_Pos += length;
+    return true;
+  }
+
+  bool fail(const std::string& message)
+  {
+    if(m_Expression.m_ErrorMessage.empty())
+    {
+      m_Expression.m_ErrorMessage = message + " at position " + std::to_string(m_Pos + 1);
+    }
+    return false;
+  }
+
+  void push(OpCode op, double value = 0.0, int input = -1)
+  {
+    m_Expression.m_Instructions.push_back({op, value, input});
+  }
+
+  bool parseOr()
+  {
+    if(false == parseAnd())
+    {
+      return false;
+    }
+    while(match("||"))
+    {
+      if(false == parseAnd())
+      {
+        return false;
+      }
+      push(OpCode::Or);
+    }
+    return true;
+  }
+
+  bool parseAnd()
+  {
+    if(false == parseComparison())
+    {
+      return false;
+    }
+    while(match("&&"))
+    {
+      if(false == parseComparison())
+      {
+        return false;
+      }
+      push(OpCode::And);
+    }
+    return true;
+  }
+
+  bool parseComparison()
+  {
+    if(false == parseAdditive())
+    {
+      return false;
+    }
+
+    // Two character operators are matched first so "<=" is not read as "<"
+    const std::pair<const char*, OpCode> operators[] = {{"<=", OpCode::LessEqual}, {">=", OpCode::GreaterEqual}, {"==", OpCode::Equal},
+                                                        {"!=", OpCode::NotEqual},  {"<", OpCode::Less},          {">", OpCode::Greater}};
+    bool matched = true;
+    while(matched)
+    {
+      matched = false;
+      for(const auto& op : operators)
+      {
+        if(match(op.first))
+        {
+          if(false == parseAdditive())
+          {
+            return false;
+          }
+          push(op.second);
+          matched = true;
+          break;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool parseAdditive()
+  {
+    if(false == parseMultiplicative())
+    {
+      return false;
+    }
+    while(true)
+    {
+      OpCode op;
+      if(match("+"))
+      {
+        op = OpCode::Add;
+      }
+      else if(match("-"))
+      {
+        op = OpCode::Subtract;
+      }
+      else
+      {
+        return true;
+      }
+
+      if(false == parseMultiplicative())
+      {
+        return false;
+      }
+      push(op);
+    }
+  }
+
+  bool parseMultiplicative()
+  {
+    if(false == parseUnary())
+    {
+      return false;
+    }
+    while(true)
+    {
+      OpCode op;
+      if(match("*"))
+      {
+        op = OpCode::Multiply;
+      }
+      else if(match("/"))
+      {
+        op = OpCode::Divide;
+      }
+      else
+      {
+        return true;
+      }
+
+      if(false == parseUnary())
+      {
+        return false;
+      }
+      push(op);
+    }
+  }
+
+  bool parseUnary()
+  {
+    if(match("-"))
+    {
+      if(false == parseUnary())
+      {
+        return false;
+      }
+      push(OpCode::Negate);
+      return true;
+    }
+    if(match("+"))
+    {
+      return parseUnary();
+    }
+
+    skipWhitespace();
+    if(m_Text.compare(m_Pos, 1, "!") == 0 && m_Text.compare(m_Pos, 2, "!=") != 0)
+    {
+      m_Pos++;
+      if(false == parseUnary())
+      {
+        return false;
+      }
+      push(OpCode::Not);
+      return true;
+    }
+
+    return parsePower();
+  }
+
+  bool parsePower()
+  {
+    if(false == parsePrimary())
+    {
+      return false;
+    }
+
+    // Exponents are right associative and bind tighter than a leading minus
+    if(match("^"))
+    {
+      if(false == parseUnary())
+      {
+        return false;
+      }
+      push(OpCode::Power);
+    }
+    return true;
+  }
+
+  bool parsePrimary()
+  {
+    skipWhitespace();
+    if(m_Pos >= m_Text.size())
+    {
+      return fail("Unexpected end of expression");
+    }
+
+    const char c = m_Text[m_Pos];
+    if(c == '(')
+    {
+      m_Pos++;
+      if(false == parseOr())
+      {
+        return false;
+      }
+      if(false == match(")"))
+      {
+        return fail("Expected ')'");
+      }
+      return true;
+    }
+
+    if(std::isdigit(static_cast<unsigned char>(c)) || c == '.')
+    {
+      const char* start = m_Text.c_str() + m_Pos;
+      char* end = nullptr;
+      const double value = std::strtod(start, &end);
+      if(end == start)
+      {
+        return fail("Invalid number");
+      }
+      m_Pos += end - start;
+      push(OpCode::Constant, value);
+      return true;
+    }
+
+    std::string name;
+    if(false == parseName(name))
+    {
+      return fail("Expected a number, array, or function");
+    }
+
+    if(false == match("("))
+    {
+      if(name == "pi")
+      {
+        push(OpCode::Constant, vtkMath::Pi());
+        return true;
+      }
+      return parseArray(name);
+    }
+
+    if(name == "mag")
+    {
+      std::string arrayName;
+      skipWhitespace();
+      if(false == parseName(arrayName))
+      {
+        return fail("Expected an array name");
+      }
+      if(false == addArray(arrayName, -1))
+      {
+        return false;
+      }
+      if(false == match(")"))
+      {
+        return fail("Expected ')'");
+      }
+      return true;
+    }
+
+    return parseFunction(name);
+  }
+
+  bool parseName(std::string& name)
+  {
+    skipWhitespace();
+    if(m_Pos >= m_Text.size())
+    {
+      return false;
+    }
+
+    if(m_Text[m_Pos] == '"')
+    {
+      const size_t close = m_Text.find('"', m_Pos + 1);
+      if(close == std::string::npos)
+      {
+        return false;
+      }
+      name = m_Text.substr(m_Pos + 1, close - m_Pos - 1);
+      m_Pos = close + 1;
+      return true;
+    }
+
+    const size_t start = m_Pos;
+    while(m_Pos < m_Text.size() && (std::isalnum(static_cast<unsigned char>(m_Text[m_Pos])) || m_Text[m_Pos] == '_'))
+    {
+      m_Pos++;
+    }
+    name = m_Text.substr(start, m_Pos - start);
+    return false == name.empty() && false == std::isdigit(static_cast<unsigned char>(name[0]));
+  }
+
+  bool parseArray(const std::string& name)
+  {
+    int component = 0;
+    vtkDataArray* array = m_FieldData ? m_FieldData->GetArray(name.c_str()) : nullptr;
+    if(match("["))
+    {
+      skipWhitespace();
+      const char* start = m_Text.c_str() + m_Pos;
+      char* end = nullptr;
+      component = static_cast<int>(std::strtol(start, &end, 10));
+      if(end == start)
+      {
+        return fail("Expected a component index");
+      }
+      // Negative components are reserved for the magnitude computed by mag()
+      if(component < 0)
+      {
+        return fail("Array \"" + name + "\" has no component " + std::to_string(component));
+      }
+      m_Pos += end - start;
+      if(false == match("]"))
+      {
+        return fail("Expected ']'");
+      }
+    }
+    else if(array && array->GetNumberOfComponents() > 1)
+    {
+      return fail("Array \"" + name + "\" has " + std::to_string(array->GetNumberOfComponents()) + " components, select one with \"" + name + "\"[i] or use mag()");
+    }
+
+    return addArray(name, component);
+  }
+
+  bool parseFunction(const std::string& name)
+  {
+    static const Function functions[] = {{"abs", OpCode::Abs, 1},   {"sqrt", OpCode::Sqrt, 1}, {"exp", OpCode::Exp, 1},     {"log", OpCode::Log, 1},   {"log10", OpCode::Log10, 1},
+                                         {"sin", OpCode::Sin, 1},   {"cos", OpCode::Cos, 1},   {"tan", OpCode::Tan, 1},     {"asin", OpCode::Asin, 1}, {"acos", OpCode::Acos, 1},
+                                         {"atan", OpCode::Atan, 1}, {"floor", OpCode::Floor, 1}, {"ceil", OpCode::Ceil, 1}, {"min", OpCode::Min, 2},   {"max", OpCode::Max, 2},
+                                         {"pow", OpCode::Power, 2}, {"atan2", OpCode::Atan2, 2}};
+
+    const Function* function = nullptr;
+    for(const Function& candidate : functions)
+    {
+      if(name == candidate.m_Name)
+      {
+        function = &candidate;
+        break;
+      }
+    }
+    if(nullptr == function)
+    {
+      return fail("Unknown function \"" + name + "\"");
+    }
+
+    for(int arg = 0; arg < function->m_NumArgs; arg++)
+    {
+      if(arg > 0 && false == match(","))
+      {
+        return fail("Function \"" + name + "\" requires " + std::to_string(function->m_NumArgs) + " arguments");
+      }
+      if(false == parseOr())
+      {
+        return false;
+      }
+    }
+    if(false == match(")"))
+    {
+      return fail("Expected ')'");
+    }
+
+    push(function->m_Op);
+    return true;
+  }
+
+  bool addArray(const std::string& name, int component)
+  {
+    vtkDataArray* array = m_FieldData ? m_FieldData->GetArray(name.c_str()) : nullptr;
+    if(nullptr == array)
+    {
+      return fail("Unknown array \"" + name + "\"");
+    }
+    if(component >= array->GetNumberOfComponents())
+    {
+      return fail("Array \"" + name + "\" has no component " + std::to_string(component));
+    }
+
+    std::vector<ArrayInput>& inputs = m_Expression.m_Inputs;
+    for(size_t i = 0; i < inputs.size(); i++)
+    {
+      if(inputs[i].m_Name == name && inputs[i].m_Component == component)
+      {
+        push(OpCode::Array, 0.0, static_cast<int>(i));
+        return true;
+      }
+    }
+
+    ArrayInput input;
+    input.m_Name = name;
+    input.m_Array = array;
+    input.m_NumComponents = array->GetNumberOfComponents();
+    input.m_Component = component;
+
+    // Arrays outside the dispatch list such as indexed or extent arrays are read in place
+    // through the vtkDataArray API rather than copied
+    SelectLoadValues selectLoad;
+    if(false == vtkArrayDispatch::Dispatch::Execute(array, selectLoad))
+    {
+      selectLoad(array);
+    }
+    input.m_Load = selectLoad.m_Load;
+
+    inputs.push_back(input);
+    push(OpCode::Array, 0.0, static_cast<int>(inputs.size() - 1));
+    return true;
+  }
+
+  VSArrayExpression& m_Expression;
+  const std::string& m_Text;
+  vtkFieldData* m_FieldData;
+  size_t m_Pos = 0;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayExpression::VSArrayExpression() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSArrayExpression::~VSArrayExpression() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSArrayExpression::compile(const std::string& expression, vtkFieldData* fieldData)
+{
+  m_Instructions.clear();
+  m_Inputs.clear();
+  m_StackDepth = 0;
+  m_ErrorMessage.clear();
+
+  Parser parser(*this, expression, fieldData);
+  if(false == parser.parse())
+  {
+    m_Instructions.clear();
+    m_Inputs.clear();
+    return false;
+  }
+
+  // Every instruction pushes a value, leaves it in place, or combines the top two values
+  int depth = 0;
+  for(const Instruction& instruction : m_Instructions)
+  {
+    depth += StackEffect(instruction.m_Op);
+    m_StackDepth = std::max(m_StackDepth, depth);
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSArrayExpression::isValid() const
+{
+  return false == m_Instructions.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::string VSArrayExpression::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<std::string> VSArrayExpression::getArrayNames() const
+{
+  std::vector<std::string> names;
+  for(const ArrayInput& input : m_Inputs)
+  {
+    if(std::find(names.begin(), names.end(), input.m_Name) == names.end())
+    {
+      names.push_back(input.m_Name);
+    }
+  }
+
+  return names;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataArray) VSArrayExpression::evaluate(vtkIdType numTuples, const std::string& resultName) const
+{
+  if(false == isValid())
+  {
+    return nullptr;
+  }
+
+  for(const ArrayInput& input : m_Inputs)
+  {
+    if(input.m_Array->GetNumberOfTuples() < numTuples)
+    {
+      return nullptr;
+    }
+  }
+
+  VTK_PTR(vtkDataArray) result;
+  switch(getResultType())
+  {
+  case VTK_UNSIGNED_CHAR:
+    result = evaluateArray<vtkUnsignedCharArray>(numTuples);
+    break;
+  case VTK_FLOAT:
+    result = evaluateArray<vtkFloatArray>(numTuples);
+    break;
+  default:
+    result = evaluateArray<vtkDoubleArray>(numTuples);
+    break;
+  }
+
+  result->SetName(resultName.c_str());
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSArrayExpression::getResultType() const
+{
+  switch(m_Instructions.back().m_Op)
+  {
+  case OpCode::Not:
+  case OpCode::Less:
+  case OpCode::LessEqual:
+  case OpCode::Greater:
+  case OpCode::GreaterEqual:
+  case OpCode::Equal:
+  case OpCode::NotEqual:
+  case OpCode::And:
+  case OpCode::Or:
+    return VTK_UNSIGNED_CHAR;
+  default:
+    break;
+  }
+
+  // Float inputs keep float precision while constants alone are evaluated as doubles
+  if(m_Inputs.empty())
+  {
+    return VTK_DOUBLE;
+  }
+  for(const ArrayInput& input : m_Inputs)
+  {
+    if(VTK_FLOAT != input.m_Array->GetDataType())
+    {
+      return VTK_DOUBLE;
+    }
+  }
+  return VTK_FLOAT;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSArrayExpression::StackEffect(OpCode op)
+{
+  switch(op)
+  {
+  case OpCode::Constant:
+  case OpCode::Array:
+    return 1;
+  case OpCode::Negate:
+  case OpCode::Not:
+  case OpCode::Abs:
+  case OpCode::Sqrt:
+  case OpCode::Exp:
+  case OpCode::Log:
+  case OpCode::Log10:
+  case OpCode::Sin:
+  case OpCode::Cos:
+  case OpCode::Tan:
+  case OpCode::Asin:
+  case OpCode::Acos:
+  case OpCode::Atan:
+  case OpCode::Floor:
+  case OpCode::Ceil:
+    return 0;
+  default:
+    return -1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSArrayExpression::LoadInput(const ArrayInput& input, vtkIdType begin, vtkIdType count, double* scratch, double* output)
+{
+  input.m_Load(input.m_Array, input.m_NumComponents, input.m_Component, begin, count, output);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename OutT>
+void VSArrayExpression::LoadInput(const ArrayInput& input, vtkIdType begin, vtkIdType count, double* scratch, OutT* output)
+{
+  input.m_Load(input.m_Array, input.m_NumComponents, input.m_Component, begin, count, scratch);
+  std::transform(scratch, scratch + count, output, [](double x) { return static_cast<OutT>(x); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename ResultArrayT>
+VTK_PTR(ResultArrayT) VSArrayExpression::evaluateArray(vtkIdType numTuples) const
+{
+  using ValueType = typename ResultArrayT::ValueType;
+
+  VTK_NEW(ResultArrayT, result);
+  result->SetNumberOfValues(numTuples);
+  ValueType* resultPtr = result->GetPointer(0);
+
+  const vtkIdType numBlocks = (numTuples + BlockSize - 1) / BlockSize;
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType beginBlock, vtkIdType endBlock) {
+    std::vector<double> stack(m_StackDepth * BlockSize);
+    for(vtkIdType block = beginBlock; block < endBlock; block++)
+    {
+      const vtkIdType begin = block * BlockSize;
+      const vtkIdType count = std::min(BlockSize, numTuples - begin);
+      evaluateBlock(begin, count, stack.data(), resultPtr + begin);
+    }
+  });
+
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename OutT>
+void VSArrayExpression::evaluateBlock(vtkIdType begin, vtkIdType count, double* stack, OutT* result) const
+{
+  // Index of the block on top of the stack.  The last instruction writes straight into the result.
+  const size_t last = m_Instructions.size() - 1;
+  int top = -1;
+  for(size_t i = 0; i < last; i++)
+  {
+    const int next = top + StackEffect(m_Instructions[i].m_Op);
+    applyInstruction(m_Instructions[i], begin, count, stack, top, stack + next * BlockSize);
+    top = next;
+  }
+  applyInstruction(m_Instructions[last], begin, count, stack, top, result);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename OutT>
+void VSArrayExpression::applyInstruction(const Instruction& instruction, vtkIdType begin, vtkIdType count, double* stack, int top, OutT* output) const
+{
+  const double* values = stack + std::max(top, 0) * BlockSize;
+  const double* lhs = stack + std::max(top - 1, 0) * BlockSize;
+  switch(instruction.m_Op)
+  {
+  case OpCode::Constant:
+    std::fill(output, output + count, static_cast<OutT>(instruction.m_Value));
+    break;
+  case OpCode::Array:
+    // The block above the top of the stack is free for values that have to be converted
+    LoadInput(m_Inputs[instruction.m_Input], begin, count, stack + (top + 1) * BlockSize, output);
+    break;
+  case OpCode::Negate:
+    ApplyUnary(values, output, count, [](double x) { return -x; });
+    break;
+  case OpCode::Not:
+    ApplyUnary(values, output, count, [](double x) { return x == 0.0 ? 1.0 : 0.0; });
+    break;
+  case OpCode::Abs:
+    ApplyUnary(values, output, count, [](double x) { return std::abs(x); });
+    break;
+  case OpCode::Sqrt:
+    ApplyUnary(values, output, count, [](double x) { return std::sqrt(x); });
+    break;
+  case OpCode::Exp:
+    ApplyUnary(values, output, count, [](double x) { return std::exp(x); });
+    break;
+  case OpCode::Log:
+    ApplyUnary(values, output, count, [](double x) { return std::log(x); });
+    break;
+  case OpCode::Log10:
+    ApplyUnary(values, output, count, [](double x) { return std::log10(x); });
+    break;
+  case OpCode::Sin:
+    ApplyUnary(values, output, count, [](double x) { return std::sin(x); });
+    break;
+  case OpCode::Cos:
+    ApplyUnary(values, output, count, [](double x) { return std::cos(x); });
+    break;
+  case OpCode::Tan:
+    ApplyUnary(values, output, count, [](double x) { return std::tan(x); });
+    break;
+  case OpCode::Asin:
+    ApplyUnary(values, output, count, [](double x) { return std::asin(x); });
+    break;
+  case OpCode::Acos:
+    ApplyUnary(values, output, count, [](double x) { return std::acos(x); });
+    break;
+  case OpCode::Atan:
+    ApplyUnary(values, output, count, [](double x) { return std::atan(x); });
+    break;
+  case OpCode::Floor:
+    ApplyUnary(values, output, count, [](double x) { return std::floor(x); });
+    break;
+  case OpCode::Ceil:
+    ApplyUnary(values, output, count, [](double x) { return std::ceil(x); });
+    break;
+  case OpCode::Add:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a + b; });
+    break;
+  case OpCode::Subtract:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a - b; });
+    break;
+  case OpCode::Multiply:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a * b; });
+    break;
+  case OpCode::Divide:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a / b; });
+    break;
+  case OpCode::Power:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return std::pow(a, b); });
+    break;
+  case OpCode::Less:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a < b ? 1.0 : 0.0; });
+    break;
+  case OpCode::LessEqual:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a <= b ? 1.0 : 0.0; });
+    break;
+  case OpCode::Greater:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a > b ? 1.0 : 0.0; });
+    break;
+  case OpCode::GreaterEqual:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a >= b ? 1.0 : 0.0; });
+    break;
+  case OpCode::Equal:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a == b ? 1.0 : 0.0; });
+    break;
+  case OpCode::NotEqual:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return a != b ? 1.0 : 0.0; });
+    break;
+  case OpCode::And:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return (a != 0.0 && b != 0.0) ? 1.0 : 0.0; });
+    break;
+  case OpCode::Or:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return (a != 0.0 || b != 0.0) ? 1.0 : 0.0; });
+    break;
+  case OpCode::Min:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return std::min(a, b); });
+    break;
+  case OpCode::Max:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return std::max(a, b); });
+    break;
+  case OpCode::Atan2:
+    ApplyBinary(lhs, values, output, count, [](double a, double b) { return std::atan2(a, b); });
+    break;
+  }
+}
@@ -0,0 +1,238 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <vtkDataArray.h>
+#include <vtkType.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkFieldData;
+
+/**
+ * @class VSArrayExpression VSArrayExpression.h SIMPLVtkLib/SIMPLBridge/VSArrayExpression.h
+ * @brief This class compiles an arithmetic or logical expression over the arrays of a
+ * vtkFieldData into postfix instructions and evaluates it for every tuple.  Instructions
+ * are applied to blocks of tuples at a time so dispatching an instruction costs once per
+ * block instead of once per value, and each instruction is a simple loop the compiler can
+ * vectorize.  Blocks are evaluated in parallel.
+ *
+ * Arrays are referenced by name, and names that are not identifiers are quoted such as
+ * "Confidence Index".  Components are selected with EulerAngles[0] and mag(EulerAngles)
+ * returns the magnitude of every component.  Single component arrays need no index.
+ * Supported operators are + - * / ^, the comparisons < <= > >= == !=, and the logical
+ * operators && || !.  Comparisons and logical operators return 1 or 0.  The functions
+ * abs, sqrt, exp, log, log10, sin, cos, tan, asin, acos, atan, floor, ceil, min, max,
+ * pow, and atan2 are available along with the constant pi.
+ */
+class SIMPLVtkLib_EXPORT VSArrayExpression
+{
+public:
+  VSArrayExpression();
+  virtual ~VSArrayExpression();
+
+  /**
+   * @brief Compiles the expression against the arrays in the given field data.
+   * Returns false and sets the error message if the expression is invalid.
+   * @param expression
+   * @param fieldData
+   * @return
+   */
+  bool compile(const std::string& expression, vtkFieldData* fieldData);
+
+  /**
+   * @brief Returns true if the last expression compiled successfully
+   * @return
+   */
+  bool isValid() const;
+
+  /**
+   * @brief Returns the error message for the last expression compiled
+   * @return
+   */
+  std::string getErrorMessage() const;
+
+  /**
+   * @brief Returns the names of the arrays referenced by the compiled expression
+   * @return
+   */
+  std::vector<std::string> getArrayNames() const;
+
+  /**
+   * @brief Evaluates the compiled expression for the given number of tuples.  Comparisons and
+   * logical expressions return an unsigned char array, expressions over float arrays alone
+   * return a float array, and everything else returns a double array.  Values are computed
+   * as doubles either way.  Returns nullptr if the expression is invalid or an array has
+   * fewer tuples.
+   * @param numTuples
+   * @param resultName
+   * @return
+   */
+  VTK_PTR(vtkDataArray) evaluate(vtkIdType numTuples, const std::string& resultName) const;
+
+private:
+  class Parser;
+
+  enum class OpCode : unsigned char
+  {
+    Constant,
+    Array,
+    Negate,
+    Not,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Power,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Equal,
+    NotEqual,
+    And,
+    Or,
+    Abs,
+    Sqrt,
+    Exp,
+    Log,
+    Log10,
+    Sin,
+    Cos,
+    Tan,
+    Asin,
+    Acos,
+    Atan,
+    Floor,
+    Ceil,
+    Min,
+    Max,
+    Atan2
+  };
+
+  using LoadFunction = void (*)(vtkDataArray* array, int numComps, int component, vtkIdType begin, vtkIdType count, double* values);
+
+  struct Instruction
+  {
+    OpCode m_Op;
+    double m_Value;
+    int m_Input;
+  };
+
+  struct ArrayInput
+  {
+    std::string m_Name;
+    VTK_PTR(vtkDataArray) m_Array;
+    int m_NumComponents;
+    int m_Component;
+    LoadFunction m_Load;
+  };
+
+  /**
+   * @brief Returns the number of values the instruction adds to or removes from the stack
+   * @param op
+   * @return
+   */
+  static int StackEffect(OpCode op);
+
+  /**
+   * @brief Loads the input's values for a block of tuples into a double output
+   * @param input
+   * @param begin
+   * @param count
+   * @param scratch Unused since the values are loaded in place
+   * @param output
+   */
+  static void LoadInput(const ArrayInput& input, vtkIdType begin, vtkIdType count, double* scratch, double* output);
+
+  /**
+   * @brief Loads the input's values for a block of tuples into the scratch block and converts them to the output type
+   * @param input
+   * @param begin
+   * @param count
+   * @param scratch
+   * @param output
+   */
+  template <typename OutT>
+  static void LoadInput(const ArrayInput& input, vtkIdType begin, vtkIdType count, double* scratch, OutT* output);
+
+  /**
+   * @brief Returns the VTK data type of the evaluated array
+   * @return
+   */
+  int getResultType() const;
+
+  /**
+   * @brief Evaluates every block of tuples into an array of the given type
+   * @param numTuples
+   * @return
+   */
+  template <typename ResultArrayT>
+  VTK_PTR(ResultArrayT) evaluateArray(vtkIdType numTuples) const;
+
+  /**
+   * @brief Evaluates the instructions for a block of tuples using the given stack.  The last
+   * instruction writes to the result block instead of the stack.
+   * @param begin
+   * @param count
+   * @param stack
+   * @param result
+   */
+  template <typename OutT>
+  void evaluateBlock(vtkIdType begin, vtkIdType count, double* stack, OutT* result) const;
+
+  /**
+   * @brief Applies a single instruction to a block of tuples with the given stack entry on top
+   * and writes its values to the output block
+   * @param instruction
+   * @param begin
+   * @param count
+   * @param stack
+   * @param top
+   * @param output
+   */
+  template <typename OutT>
+  void applyInstruction(const Instruction& instruction, vtkIdType begin, vtkIdType count, double* stack, int top, OutT* output) const;
+
+  std::vector<Instruction> m_Instructions;
+  std::vector<ArrayInput> m_Inputs;
+  int m_StackDepth = 0;
+  std::string m_ErrorMessage;
+};
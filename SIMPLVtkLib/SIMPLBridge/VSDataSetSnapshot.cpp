@@ -0,0 +1,1212 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSDataSetSnapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <vtkArrayDispatch.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
+#include <vtkDataArrayAccessor.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkFieldData.h>
+#include <vtkIdList.h>
+#include <vtkIdTypeArray.h>
+#include <vtkImageData.h>
+#include <vtkPointData.h>
+#include <vtkPointSet.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkRectilinearGrid.h>
+#include <vtkSMPTools.h>
+#include <vtkStringArray.h>
+#include <vtkStructuredGrid.h>
+#include <vtkTypeTraits.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkUnstructuredGridBase.h>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp"
+
+namespace
+{
+// Bytes of contiguous array memory hashed by each parallel task
+const size_t HashBlockBytes = 1 << 20;
+
+// Tuples or cells gathered and hashed by each parallel task
+const vtkIdType HashBlockItems = 1 << 15;
+
+// Identifies raw snapshots and the layout their values were written with
+const quint32 SnapshotMagic = 0x56534453;
+const quint32 SnapshotVersion = 2;
+const quint32 ByteOrderMark = 0x01020304;
+
+// Array blocks start on this boundary so they can be used in place from a mapped snapshot
+const qint64 BlockAlignment = 64;
+
+enum class ArrayRecord : qint32
+{
+  None = 0,
+  Data = 1,
+  String = 2,
+  Indexed = 3
+};
+
+/**
+ * @brief Returns a 64-bit hash of the given bytes.  Words are mixed with multiply and
+ * rotate steps so every input bit affects the result without the cost of a cryptographic hash.
+ * @param data
+ * @param size
+ * @return
+ */
+uint64_t HashBytes(const unsigned char* data, size_t size)
+{
+  uint64_t hash = 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(size);
+
+  const size_t numWords = size / sizeof(uint64_t);
+  for(size_t i = 0; i < numWords; i++)
+  {
+    uint64_t word;
+    std::memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash ^= word * 0xBF58476D1CE4E5B9ull;
+    hash = (hash << 27) | (hash >> 37);
+    hash *= 0x94D049BB133111EBull;
+  }
+  for(size_t i = numWords * sizeof(uint64_t); i < size; i++)
+  {
+    hash = (hash ^ data[i]) * 0x100000001B3ull;
+  }
+
+  hash ^= hash >> 31;
+  hash *= 0xBF58476D1CE4E5B9ull;
+  hash ^= hash >> 29;
+  return hash;
+}
+
+/**
+ * @brief Adds the bytes of a single value to the hash
+ * @param hash
+ * @param value
+ */
+template <typename T> void AddValue(QCryptographicHash& hash, const T& value)
+{
+  hash.addData(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * @brief Adds the block hashes to the hash in order
+ * @param hash
+ * @param blockHashes
+ */
+void AddBlockHashes(QCryptographicHash& hash, const std::vector<uint64_t>& blockHashes)
+{
+  if(blockHashes.size() > 0)
+  {
+    hash.addData(reinterpret_cast<const char*>(blockHashes.data()), static_cast<int>(blockHashes.size() * sizeof(uint64_t)));
+  }
+}
+
+/**
+ * @brief Hashes blocks of tuples gathered through the array's typed accessor.  Used for
+ * arrays without contiguous memory so their values are never copied in full.
+ */
+struct HashBlocksWorker
+{
+  std::vector<uint64_t>* m_BlockHashes = nullptr;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    using ValueType = typename vtkDataArrayAccessor<ArrayT>::APIType;
+    const vtkDataArrayAccessor<ArrayT> accessor(array);
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const int numComps = array->GetNumberOfComponents();
+
+    const vtkIdType numBlocks = (numTuples + HashBlockItems - 1) / HashBlockItems;
+    m_BlockHashes->resize(numBlocks);
+    uint64_t* blockPtr = m_BlockHashes->data();
+    vtkSMPTools::For(0, numBlocks, [=](vtkIdType begin, vtkIdType end) {
+      std::vector<ValueType> values;
+      for(vtkIdType b = begin; b < end; b++)
+      {
+        const vtkIdType first = b * HashBlockItems;
+        const vtkIdType last = std::min(first + HashBlockItems, numTuples);
+        values.resize(static_cast<size_t>(last - first) * numComps);
+        for(vtkIdType t = first; t < last; t++)
+        {
+          for(int c = 0; c < numComps; c++)
+          {
+            values[(t - first) * numComps + c] = accessor.Get(t, c);
+          }
+        }
+        blockPtr[b] = HashBytes(reinterpret_cast<const unsigned char*>(values.data()), values.size() * sizeof(ValueType));
+      }
+    });
+  }
+};
+
+/**
+ * @brief Adds an array's description and values to the hash.  Contiguous arrays are
+ * hashed straight from memory while other layouts are gathered block by block.
+ * @param hash
+ * @param array
+ */
+void AddArray(QCryptographicHash& hash, vtkAbstractArray* abstractArray)
+{
+  if(nullptr == abstractArray)
+  {
+    AddValue<int>(hash, -1);
+    return;
+  }
+
+  if(abstractArray->GetName())
+  {
+    hash.addData(abstractArray->GetName());
+  }
+  AddValue<int>(hash, abstractArray->GetDataType());
+  AddValue<int>(hash, abstractArray->GetNumberOfComponents());
+  AddValue<vtkIdType>(hash, abstractArray->GetNumberOfTuples());
+
+  // String and variant arrays do not render, so only their description is used
+  vtkDataArray* array = vtkDataArray::SafeDownCast(abstractArray);
+  if(nullptr == array)
+  {
+    return;
+  }
+
+  // Indexed values are determined by the much smaller source array and the indices
+  VSIndexedArray* indexedArray = dynamic_cast<VSIndexedArray*>(array);
+  if(indexedArray)
+  {
+    AddArray(hash, indexedArray->GetSource());
+    AddArray(hash, indexedArray->GetIndices());
+    return;
+  }
+
+  const vtkIdType numTuples = array->GetNumberOfTuples();
+  const int numComps = array->GetNumberOfComponents();
+  std::vector<uint64_t> blockHashes;
+
+  if(array->HasStandardMemoryLayout())
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(array->GetVoidPointer(0));
+    const size_t numBytes = static_cast<size_t>(numTuples) * numComps * array->GetDataTypeSize();
+    if(nullptr == bytes || 0 == numBytes)
+    {
+      return;
+    }
+
+    const vtkIdType numBlocks = static_cast<vtkIdType>((numBytes + HashBlockBytes - 1) / HashBlockBytes);
+    blockHashes.resize(numBlocks);
+    uint64_t* blockPtr = blockHashes.data();
+    vtkSMPTools::For(0, numBlocks, [=](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType b = begin; b < end; b++)
+      {
+        const size_t offset = static_cast<size_t>(b) * HashBlockBytes;
+        blockPtr[b] = HashBytes(bytes + offset, std::min(HashBlockBytes, numBytes - offset));
+      }
+    });
+  }
+  else
+  {
+    HashBlocksWorker worker;
+    worker.m_BlockHashes = &blockHashes;
+    if(false == vtkArrayDispatch::Dispatch::Execute(array, worker))
+    {
+      worker(array);
+    }
+  }
+
+  AddBlockHashes(hash, blockHashes);
+}
+
+/**
+ * @brief Adds every array in the field data to the hash
+ * @param hash
+ * @param fieldData
+ */
+void AddFieldData(QCryptographicHash& hash, vtkFieldData* fieldData)
+{
+  if(nullptr == fieldData)
+  {
+    AddValue<int>(hash, -1);
+    return;
+  }
+
+  const int numArrays = fieldData->GetNumberOfArrays();
+  AddValue<int>(hash, numArrays);
+  for(int i = 0; i < numArrays; i++)
+  {
+    AddArray(hash, fieldData->GetAbstractArray(i));
+  }
+}
+
+/**
+ * @brief Adds the connectivity of a vtkCellArray to the hash
+ * @param hash
+ * @param cells
+ */
+void AddCellArray(QCryptographicHash& hash, vtkCellArray* cells)
+{
+  if(nullptr == cells)
+  {
+    AddValue<int>(hash, -1);
+    return;
+  }
+
+#if VTK_MAJOR_VERSION >= 9
+  AddArray(hash, cells->GetOffsetsArray());
+  AddArray(hash, cells->GetConnectivityArray());
+#else
+  AddArray(hash, cells->GetData());
+#endif
+}
+
+/**
+ * @brief Adds the cell types and points of a data set without an explicit vtkCellArray,
+ * such as the mapped SIMPL geometries, to the hash
+ * @param hash
+ * @param dataSet
+ */
+void AddMappedCells(QCryptographicHash& hash, vtkDataSet* dataSet)
+{
+  const vtkIdType numCells = dataSet->GetNumberOfCells();
+  AddValue<vtkIdType>(hash, numCells);
+  if(numCells <= 0)
+  {
+    return;
+  }
+
+  // Data sets are only thread safe to query once a cell has been requested on a single thread
+  VTK_NEW(vtkIdList, firstIds);
+  dataSet->GetCellPoints(0, firstIds);
+
+  const vtkIdType numBlocks = (numCells + HashBlockItems - 1) / HashBlockItems;
+  std::vector<uint64_t> blockHashes(numBlocks);
+  uint64_t* blockPtr = blockHashes.data();
+  vtkSMPTools::For(0, numBlocks, [=](vtkIdType begin, vtkIdType end) {
+    VTK_NEW(vtkIdList, ptIds);
+    std::vector<vtkIdType> values;
+    for(vtkIdType b = begin; b < end; b++)
+    {
+      const vtkIdType first = b * HashBlockItems;
+      const vtkIdType last = std::min(first + HashBlockItems, numCells);
+      values.clear();
+      for(vtkIdType c = first; c < last; c++)
+      {
+        dataSet->GetCellPoints(c, ptIds);
+        values.push_back(dataSet->GetCellType(c));
+        values.push_back(ptIds->GetNumberOfIds());
+        for(vtkIdType i = 0; i < ptIds->GetNumberOfIds(); i++)
+        {
+          values.push_back(ptIds->GetId(i));
+        }
+      }
+      blockPtr[b] = HashBytes(reinterpret_cast<const unsigned char*>(values.data()), values.size() * sizeof(vtkIdType));
+    }
+  });
+
+  AddBlockHashes(hash, blockHashes);
+}
+
+/**
+ * @brief Returns the owners of snapshot memory keyed by the first value of each array
+ * wrapped around it.  The map is never destroyed so arrays freed during shutdown can
+ * still release their entry.
+ * @return
+ */
+std::multimap<const void*, std::shared_ptr<const void>>& SnapshotOwners()
+{
+  static std::multimap<const void*, std::shared_ptr<const void>>* owners = new std::multimap<const void*, std::shared_ptr<const void>>();
+  return *owners;
+}
+
+/**
+ * @brief Returns the lock guarding SnapshotOwners
+ * @return
+ */
+QMutex& SnapshotOwnerLock()
+{
+  static QMutex* lock = new QMutex();
+  return *lock;
+}
+
+/**
+ * @brief Called by VTK when the buffer of a wrapped array is freed.  Buffers shared by
+ * shallow copies are only freed once, so the owner lives as long as any copy.
+ * @param data
+ */
+void ReleaseSnapshotMemory(void* data)
+{
+  QMutexLocker locker(&SnapshotOwnerLock());
+  auto iter = SnapshotOwners().find(data);
+  if(iter != SnapshotOwners().end())
+  {
+    SnapshotOwners().erase(iter);
+  }
+}
+
+/**
+ * @brief Writes snapshot values to a device and pads array blocks to the block alignment.
+ * Write errors are remembered so callers only check once at the end.
+ */
+class SnapshotWriter
+{
+public:
+  explicit SnapshotWriter(QIODevice* device)
+  : m_Device(device)
+  {
+  }
+
+  bool isOk() const
+  {
+    return m_Ok;
+  }
+
+  void writeBytes(const void* data, qint64 size)
+  {
+    if(m_Ok && size > 0)
+    {
+      m_Ok = m_Device->write(static_cast<const char*>(data), size) == size;
+      m_Size += size;
+    }
+  }
+
+  template <typename T> void writeValue(const T& value)
+  {
+    writeBytes(&value, sizeof(T));
+  }
+
+  void writeString(const char* string)
+  {
+    const qint64 length = string ? static_cast<qint64>(std::strlen(string)) : -1;
+    writeValue<qint64>(length);
+    writeBytes(string, length);
+  }
+
+  void align()
+  {
+    const char padding[BlockAlignment] = {0};
+    writeBytes(padding, (BlockAlignment - m_Size % BlockAlignment) % BlockAlignment);
+  }
+
+private:
+  QIODevice* m_Device;
+  qint64 m_Size = 0;
+  bool m_Ok = true;
+};
+
+/**
+ * @brief Reads snapshot values with bounds checks.  Array blocks are wrapped in place when
+ * the snapshot memory has an owner and copied otherwise.
+ */
+class SnapshotReader
+{
+public:
+  SnapshotReader(const char* data, qint64 size, std::shared_ptr<const void> owner)
+  : m_Data(data)
+  , m_Size(size)
+  , m_Owner(owner)
+  {
+  }
+
+  bool isOk() const
+  {
+    return m_Ok;
+  }
+
+  void setFailed()
+  {
+    m_Ok = false;
+  }
+
+  qint64 getRemainingSize() const
+  {
+    return m_Size - m_Pos;
+  }
+
+  const char* readBytes(qint64 size)
+  {
+    if(false == m_Ok || size < 0 || size > m_Size - m_Pos)
+    {
+      m_Ok = false;
+      return nullptr;
+    }
+
+    const char* bytes = m_Data + m_Pos;
+    m_Pos += size;
+    return bytes;
+  }
+
+  template <typename T> T readValue()
+  {
+    T value = T();
+    const char* bytes = readBytes(sizeof(T));
+    if(bytes)
+    {
+      std::memcpy(&value, bytes, sizeof(T));
+    }
+    return value;
+  }
+
+  bool readString(std::string& string, bool& isNull)
+  {
+    const qint64 length = readValue<qint64>();
+    isNull = length < 0;
+    const char* bytes = readBytes(std::max<qint64>(length, 0));
+    string = bytes ? std::string(bytes, static_cast<size_t>(std::max<qint64>(length, 0))) : std::string();
+    return m_Ok;
+  }
+
+  void align()
+  {
+    readBytes((BlockAlignment - m_Pos % BlockAlignment) % BlockAlignment);
+  }
+
+  /**
+   * @brief Points the array at the next block of values or copies them into it
+   * @param array
+   * @param numValues
+   * @return
+   */
+  bool readValues(vtkDataArray* array, qint64 numValues)
+  {
+    const qint64 typeSize = array->GetDataTypeSize();
+    align();
+    if(numValues < 0 || (typeSize > 0 && numValues > (m_Size - m_Pos) / typeSize))
+    {
+      m_Ok = false;
+    }
+    const char* block = readBytes(numValues * typeSize);
+    if(nullptr == block)
+    {
+      return false;
+    }
+
+    if(nullptr == m_Owner || 0 == numValues)
+    {
+      array->SetNumberOfValues(numValues);
+      if(numValues > 0)
+      {
+        std::memcpy(array->GetVoidPointer(0), block, static_cast<size_t>(numValues * typeSize));
+      }
+      return true;
+    }
+
+    {
+      QMutexLocker locker(&SnapshotOwnerLock());
+      SnapshotOwners().emplace(block, m_Owner);
+    }
+    array->SetVoidArray(const_cast<char*>(block), numValues, 0, vtkAbstractArray::VTK_DATA_ARRAY_USER_DEFINED);
+    array->SetArrayFreeFunction(ReleaseSnapshotMemory);
+    return true;
+  }
+
+private:
+  const char* m_Data;
+  qint64 m_Size;
+  qint64 m_Pos = 0;
+  std::shared_ptr<const void> m_Owner;
+  bool m_Ok = true;
+};
+
+/**
+ * @brief Writes the values of an array without contiguous memory in blocks gathered through
+ * its typed accessor.  Arrays outside the dispatch list are written as doubles.
+ */
+struct WriteValuesWorker
+{
+  SnapshotWriter* m_Writer = nullptr;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    using ValueType = typename vtkDataArrayAccessor<ArrayT>::APIType;
+    const vtkDataArrayAccessor<ArrayT> accessor(array);
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const int numComps = array->GetNumberOfComponents();
+
+    m_Writer->writeValue<qint32>(vtkTypeTraits<ValueType>::VTKTypeID());
+    m_Writer->writeValue<qint32>(numComps);
+    m_Writer->writeValue<qint64>(numTuples);
+    m_Writer->align();
+
+    std::vector<ValueType> values;
+    for(vtkIdType first = 0; first < numTuples && m_Writer->isOk(); first += HashBlockItems)
+    {
+      const vtkIdType last = std::min(first + HashBlockItems, numTuples);
+      values.resize(static_cast<size_t>(last - first) * numComps);
+      for(vtkIdType t = first; t < last; t++)
+      {
+        for(int c = 0; c < numComps; c++)
+        {
+          values[(t - first) * numComps + c] = accessor.Get(t, c);
+        }
+      }
+      m_Writer->writeBytes(values.data(), static_cast<qint64>(values.size() * sizeof(ValueType)));
+    }
+  }
+};
+
+/**
+ * @brief Writes an array record.  Indexed arrays are written as their source and indices so
+ * they are never expanded.  Arrays other than data and string arrays are written as empty records.
+ * @param writer
+ * @param abstractArray
+ */
+void WriteArray(SnapshotWriter& writer, vtkAbstractArray* abstractArray)
+{
+  vtkDataArray* array = vtkDataArray::SafeDownCast(abstractArray);
+  vtkStringArray* stringArray = vtkStringArray::SafeDownCast(abstractArray);
+  VSIndexedArray* indexedArray = dynamic_cast<VSIndexedArray*>(array);
+  if(indexedArray)
+  {
+    writer.writeValue<qint32>(static_cast<qint32>(ArrayRecord::Indexed));
+    writer.writeString(array->GetName());
+    WriteArray(writer, indexedArray->GetSource());
+    WriteArray(writer, indexedArray->GetIndices());
+  }
+  else if(array)
+  {
+    writer.writeValue<qint32>(static_cast<qint32>(ArrayRecord::Data));
+    writer.writeString(array->GetName());
+    if(array->HasStandardMemoryLayout())
+    {
+      const qint64 numValues = static_cast<qint64>(array->GetNumberOfTuples()) * array->GetNumberOfComponents();
+      writer.writeValue<qint32>(array->GetDataType());
+      writer.writeValue<qint32>(array->GetNumberOfComponents());
+      writer.writeValue<qint64>(array->GetNumberOfTuples());
+      writer.align();
+      writer.writeBytes(numValues > 0 ? array->GetVoidPointer(0) : nullptr, numValues * array->GetDataTypeSize());
+    }
+    else
+    {
+      WriteValuesWorker worker;
+      worker.m_Writer = &writer;
+      if(false == vtkArrayDispatch::Dispatch::Execute(array, worker))
+      {
+        worker(array);
+      }
+    }
+  }
+  else if(stringArray)
+  {
+    writer.writeValue<qint32>(static_cast<qint32>(ArrayRecord::String));
+    writer.writeString(stringArray->GetName());
+    writer.writeValue<qint32>(stringArray->GetNumberOfComponents());
+    writer.writeValue<qint64>(stringArray->GetNumberOfValues());
+    for(vtkIdType i = 0; i < stringArray->GetNumberOfValues(); i++)
+    {
+      const vtkStdString& value = stringArray->GetValue(i);
+      writer.writeValue<qint64>(static_cast<qint64>(value.size()));
+      writer.writeBytes(value.data(), static_cast<qint64>(value.size()));
+    }
+  }
+  else
+  {
+    writer.writeValue<qint32>(static_cast<qint32>(ArrayRecord::None));
+  }
+}
+
+/**
+ * @brief Reads an array record written by WriteArray.  Returns nullptr for empty records and
+ * sets the reader's error state if the record could not be read.
+ * @param reader
+ * @return
+ */
+VTK_PTR(vtkAbstractArray) ReadArray(SnapshotReader& reader)
+{
+  const ArrayRecord record = static_cast<ArrayRecord>(reader.readValue<qint32>());
+  if(false == reader.isOk() || ArrayRecord::None == record)
+  {
+    return nullptr;
+  }
+
+  std::string name;
+  bool nullName = true;
+  reader.readString(name, nullName);
+
+  VTK_PTR(vtkAbstractArray) array = nullptr;
+  switch(record)
+  {
+  case ArrayRecord::Data:
+  {
+    const qint32 dataType = reader.readValue<qint32>();
+    const qint32 numComps = reader.readValue<qint32>();
+    const qint64 numTuples = reader.readValue<qint64>();
+    if(false == reader.isOk() || 0 == vtkDataArray::GetDataTypeSize(dataType) || numComps < 1 || numTuples < 0 || numTuples > std::numeric_limits<qint64>::max() / numComps)
+    {
+      break;
+    }
+
+    VTK_PTR(vtkDataArray) dataArray;
+    dataArray.TakeReference(vtkDataArray::CreateDataArray(dataType));
+    if(nullptr == dataArray || dataArray->GetDataType() != dataType)
+    {
+      break;
+    }
+    dataArray->SetNumberOfComponents(numComps);
+    if(reader.readValues(dataArray, numTuples * numComps))
+    {
+      array = dataArray.GetPointer();
+    }
+    break;
+  }
+  case ArrayRecord::String:
+  {
+    const qint32 numComps = reader.readValue<qint32>();
+    const qint64 numValues = reader.readValue<qint64>();
+    if(false == reader.isOk() || numComps < 1 || numValues < 0 || numValues > reader.getRemainingSize())
+    {
+      break;
+    }
+
+    VTK_NEW(vtkStringArray, stringArray);
+    stringArray->SetNumberOfComponents(numComps);
+    stringArray->SetNumberOfValues(numValues);
+    for(vtkIdType i = 0; i < numValues && reader.isOk(); i++)
+    {
+      const qint64 length = reader.readValue<qint64>();
+      const char* bytes = reader.readBytes(length);
+      if(bytes)
+      {
+        stringArray->SetValue(i, vtkStdString(bytes, static_cast<size_t>(length)));
+      }
+    }
+    array = stringArray.GetPointer();
+    break;
+  }
+  case ArrayRecord::Indexed:
+  {
+    VTK_PTR(vtkAbstractArray) source = ReadArray(reader);
+    VTK_PTR(vtkAbstractArray) indices = ReadArray(reader);
+    VTK_PTR(vtkDataArray) indexedArray = VSIndexedDataArrays::Create(vtkDataArray::SafeDownCast(source), vtkDataArray::SafeDownCast(indices));
+    array = indexedArray.GetPointer();
+    break;
+  }
+  default:
+    break;
+  }
+
+  // Anything after an unreadable record would be misread, so the whole snapshot is rejected
+  if(nullptr == array || false == reader.isOk())
+  {
+    reader.setFailed();
+    return nullptr;
+  }
+
+  array->SetName(nullName ? nullptr : name.c_str());
+  return array;
+}
+
+/**
+ * @brief Writes the arrays of point, cell, or field data along with the attribute each is active as
+ * @param writer
+ * @param fieldData
+ */
+void WriteFieldData(SnapshotWriter& writer, vtkFieldData* fieldData)
+{
+  vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData);
+  const int numArrays = fieldData->GetNumberOfArrays();
+  writer.writeValue<qint32>(numArrays);
+  for(int i = 0; i < numArrays; i++)
+  {
+    writer.writeValue<qint32>(attributes ? attributes->IsArrayAnAttribute(i) : -1);
+    WriteArray(writer, fieldData->GetAbstractArray(i));
+  }
+}
+
+/**
+ * @brief Reads arrays written by WriteFieldData and restores the active attributes
+ * @param reader
+ * @param fieldData
+ */
+void ReadFieldData(SnapshotReader& reader, vtkFieldData* fieldData)
+{
+  vtkDataSetAttributes* attributes = vtkDataSetAttributes::SafeDownCast(fieldData);
+  const qint32 numArrays = reader.readValue<qint32>();
+  for(qint32 i = 0; i < numArrays && reader.isOk(); i++)
+  {
+    const qint32 attributeType = reader.readValue<qint32>();
+    VTK_PTR(vtkAbstractArray) array = ReadArray(reader);
+    if(nullptr == array)
+    {
+      continue;
+    }
+
+    const int index = fieldData->AddArray(array);
+    if(attributes && attributeType >= 0 && attributeType < vtkDataSetAttributes::NUM_ATTRIBUTES)
+    {
+      attributes->SetActiveAttribute(index, attributeType);
+    }
+  }
+}
+
+/**
+ * @brief Writes the arrays describing a vtkCellArray
+ * @param writer
+ * @param cells
+ */
+void WriteCellArray(SnapshotWriter& writer, vtkCellArray* cells)
+{
+#if VTK_MAJOR_VERSION >= 9
+  WriteArray(writer, cells ? cells->GetOffsetsArray() : nullptr);
+  WriteArray(writer, cells ? cells->GetConnectivityArray() : nullptr);
+#else
+  writer.writeValue<qint64>(cells ? cells->GetNumberOfCells() : 0);
+  WriteArray(writer, cells ? cells->GetData() : nullptr);
+#endif
+}
+
+/**
+ * @brief Reads a vtkCellArray written by WriteCellArray.  The cell arrays use the snapshot
+ * memory directly when they are stored in one of vtkCellArray's own layouts.
+ * @param reader
+ * @return
+ */
+VTK_PTR(vtkCellArray) ReadCellArray(SnapshotReader& reader)
+{
+  VTK_NEW(vtkCellArray, cells);
+#if VTK_MAJOR_VERSION >= 9
+  VTK_PTR(vtkAbstractArray) offsets = ReadArray(reader);
+  VTK_PTR(vtkAbstractArray) connectivity = ReadArray(reader);
+  vtkDataArray* offsetData = vtkDataArray::SafeDownCast(offsets);
+  vtkDataArray* connectivityData = vtkDataArray::SafeDownCast(connectivity);
+  if(offsetData && connectivityData)
+  {
+    cells->SetData(offsetData, connectivityData);
+  }
+#else
+  const qint64 numCells = reader.readValue<qint64>();
+  VTK_PTR(vtkAbstractArray) data = ReadArray(reader);
+  vtkIdTypeArray* idData = vtkIdTypeArray::SafeDownCast(data);
+  if(idData)
+  {
+    cells->SetCells(numCells, idData);
+  }
+#endif
+  return cells;
+}
+
+/**
+ * @brief Reads an array record that has to hold data values
+ * @param reader
+ * @return
+ */
+VTK_PTR(vtkDataArray) ReadDataArray(SnapshotReader& reader)
+{
+  VTK_PTR(vtkAbstractArray) array = ReadArray(reader);
+  return VTK_PTR(vtkDataArray)(vtkDataArray::SafeDownCast(array));
+}
+
+/**
+ * @brief Writes the structure of the data set.  Returns the data object type stored, or -1 if
+ * the data set type cannot be stored.  Unstructured grids without a vtkCellArray, such as the
+ * mapped SIMPL geometries, are stored as regular vtkUnstructuredGrids.
+ * @param writer
+ * @param dataSet
+ * @return
+ */
+int WriteStructure(SnapshotWriter& writer, vtkDataSet* dataSet)
+{
+  vtkImageData* image = vtkImageData::SafeDownCast(dataSet);
+  vtkRectilinearGrid* rectGrid = vtkRectilinearGrid::SafeDownCast(dataSet);
+  vtkStructuredGrid* structGrid = vtkStructuredGrid::SafeDownCast(dataSet);
+  vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataSet);
+  vtkUnstructuredGridBase* unstructGridBase = vtkUnstructuredGridBase::SafeDownCast(dataSet);
+
+  if(image)
+  {
+    int extent[6];
+    double origin[3];
+    double spacing[3];
+    image->GetExtent(extent);
+    image->GetOrigin(origin);
+    image->GetSpacing(spacing);
+    writer.writeValue<qint32>(VTK_IMAGE_DATA);
+    writer.writeBytes(extent, sizeof(extent));
+    writer.writeBytes(origin, sizeof(origin));
+    writer.writeBytes(spacing, sizeof(spacing));
+    return VTK_IMAGE_DATA;
+  }
+  if(rectGrid)
+  {
+    int extent[6];
+    rectGrid->GetExtent(extent);
+    writer.writeValue<qint32>(VTK_RECTILINEAR_GRID);
+    writer.writeBytes(extent, sizeof(extent));
+    WriteArray(writer, rectGrid->GetXCoordinates());
+    WriteArray(writer, rectGrid->GetYCoordinates());
+    WriteArray(writer, rectGrid->GetZCoordinates());
+    return VTK_RECTILINEAR_GRID;
+  }
+  if(structGrid)
+  {
+    int extent[6];
+    structGrid->GetExtent(extent);
+    writer.writeValue<qint32>(VTK_STRUCTURED_GRID);
+    writer.writeBytes(extent, sizeof(extent));
+    WriteArray(writer, structGrid->GetPoints() ? structGrid->GetPoints()->GetData() : nullptr);
+    return VTK_STRUCTURED_GRID;
+  }
+  if(polyData)
+  {
+    writer.writeValue<qint32>(VTK_POLY_DATA);
+    WriteArray(writer, polyData->GetPoints() ? polyData->GetPoints()->GetData() : nullptr);
+    WriteCellArray(writer, polyData->GetVerts());
+    WriteCellArray(writer, polyData->GetLines());
+    WriteCellArray(writer, polyData->GetPolys());
+    WriteCellArray(writer, polyData->GetStrips());
+    return VTK_POLY_DATA;
+  }
+  if(unstructGridBase)
+  {
+    VTK_PTR(vtkUnstructuredGrid) unstructGrid = vtkUnstructuredGrid::SafeDownCast(dataSet);
+    if(nullptr == unstructGrid)
+    {
+      unstructGrid = VTK_PTR(vtkUnstructuredGrid)::New();
+      unstructGrid->DeepCopy(unstructGridBase);
+    }
+
+    writer.writeValue<qint32>(VTK_UNSTRUCTURED_GRID);
+    WriteArray(writer, unstructGrid->GetPoints() ? unstructGrid->GetPoints()->GetData() : nullptr);
+    WriteCellArray(writer, unstructGrid->GetCells());
+    WriteArray(writer, unstructGrid->GetCellTypesArray());
+#if VTK_MAJOR_VERSION < 9
+    WriteArray(writer, unstructGrid->GetCellLocationsArray());
+#endif
+    return VTK_UNSTRUCTURED_GRID;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Creates a data set from the structure written by WriteStructure
+ * @param reader
+ * @return
+ */
+VTK_PTR(vtkDataSet) ReadStructure(SnapshotReader& reader)
+{
+  const qint32 dataType = reader.readValue<qint32>();
+  VTK_PTR(vtkDataSet) dataSet = nullptr;
+  switch(dataType)
+  {
+  case VTK_IMAGE_DATA:
+  {
+    int extent[6];
+    double origin[3];
+    double spacing[3];
+    const char* bytes = reader.readBytes(sizeof(extent) + sizeof(origin) + sizeof(spacing));
+    if(nullptr == bytes)
+    {
+      return nullptr;
+    }
+    std::memcpy(extent, bytes, sizeof(extent));
+    std::memcpy(origin, bytes + sizeof(extent), sizeof(origin));
+    std::memcpy(spacing, bytes + sizeof(extent) + sizeof(origin), sizeof(spacing));
+
+    VTK_NEW(vtkImageData, image);
+    image->SetExtent(extent);
+    image->SetOrigin(origin);
+    image->SetSpacing(spacing);
+    dataSet = image.GetPointer();
+    break;
+  }
+  case VTK_RECTILINEAR_GRID:
+  {
+    int extent[6];
+    const char* bytes = reader.readBytes(sizeof(extent));
+    if(nullptr == bytes)
+    {
+      return nullptr;
+    }
+    std::memcpy(extent, bytes, sizeof(extent));
+
+    VTK_NEW(vtkRectilinearGrid, rectGrid);
+    rectGrid->SetExtent(extent);
+    rectGrid->SetXCoordinates(ReadDataArray(reader));
+    rectGrid->SetYCoordinates(ReadDataArray(reader));
+    rectGrid->SetZCoordinates(ReadDataArray(reader));
+    dataSet = rectGrid.GetPointer();
+    break;
+  }
+  case VTK_STRUCTURED_GRID:
+  {
+    int extent[6];
+    const char* bytes = reader.readBytes(sizeof(extent));
+    if(nullptr == bytes)
+    {
+      return nullptr;
+    }
+    std::memcpy(extent, bytes, sizeof(extent));
+
+    VTK_NEW(vtkStructuredGrid, structGrid);
+    structGrid->SetExtent(extent);
+    VTK_PTR(vtkDataArray) coords = ReadDataArray(reader);
+    if(coords)
+    {
+      VTK_NEW(vtkPoints, points);
+      points->SetData(coords);
+      structGrid->SetPoints(points);
+    }
+    dataSet = structGrid.GetPointer();
+    break;
+  }
+  case VTK_POLY_DATA:
+  {
+    VTK_NEW(vtkPolyData, polyData);
+    VTK_PTR(vtkDataArray) coords = ReadDataArray(reader);
+    if(coords)
+    {
+      VTK_NEW(vtkPoints, points);
+      points->SetData(coords);
+      polyData->SetPoints(points);
+    }
+    polyData->SetVerts(ReadCellArray(reader));
+    polyData->SetLines(ReadCellArray(reader));
+    polyData->SetPolys(ReadCellArray(reader));
+    polyData->SetStrips(ReadCellArray(reader));
+    dataSet = polyData.GetPointer();
+    break;
+  }
+  case VTK_UNSTRUCTURED_GRID:
+  {
+    VTK_NEW(vtkUnstructuredGrid, unstructGrid);
+    VTK_PTR(vtkDataArray) coords = ReadDataArray(reader);
+    if(coords)
+    {
+      VTK_NEW(vtkPoints, points);
+      points->SetData(coords);
+      unstructGrid->SetPoints(points);
+    }
+    VTK_PTR(vtkCellArray) cells = ReadCellArray(reader);
+    VTK_PTR(vtkDataArray) types = ReadDataArray(reader);
+    vtkUnsignedCharArray* typeArray = vtkUnsignedCharArray::SafeDownCast(types);
+#if VTK_MAJOR_VERSION >= 9
+    if(typeArray)
+    {
+      unstructGrid->SetCells(typeArray, cells);
+    }
+#else
+    VTK_PTR(vtkDataArray) locations = ReadDataArray(reader);
+    vtkIdTypeArray* locationArray = vtkIdTypeArray::SafeDownCast(locations);
+    if(typeArray && locationArray)
+    {
+      unstructGrid->SetCells(typeArray, locationArray, cells);
+    }
+#endif
+    dataSet = unstructGrid.GetPointer();
+    break;
+  }
+  default:
+    return nullptr;
+  }
+
+  return reader.isOk() ? dataSet : nullptr;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray VSDataSetSnapshot::HashDataSet(vtkDataSet* dataSet)
+{
+  if(nullptr == dataSet)
+  {
+    return QByteArray();
+  }
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  AddValue<int>(hash, dataSet->GetDataObjectType());
+
+  vtkImageData* image = vtkImageData::SafeDownCast(dataSet);
+  vtkRectilinearGrid* rectGrid = vtkRectilinearGrid::SafeDownCast(dataSet);
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataSet);
+  if(image)
+  {
+    int extent[6];
+    double origin[3];
+    double spacing[3];
+    image->GetExtent(extent);
+    image->GetOrigin(origin);
+    image->GetSpacing(spacing);
+    hash.addData(reinterpret_cast<const char*>(extent), sizeof(extent));
+    hash.addData(reinterpret_cast<const char*>(origin), sizeof(origin));
+    hash.addData(reinterpret_cast<const char*>(spacing), sizeof(spacing));
+  }
+  else if(rectGrid)
+  {
+    int extent[6];
+    rectGrid->GetExtent(extent);
+    hash.addData(reinterpret_cast<const char*>(extent), sizeof(extent));
+    AddArray(hash, rectGrid->GetXCoordinates());
+    AddArray(hash, rectGrid->GetYCoordinates());
+    AddArray(hash, rectGrid->GetZCoordinates());
+  }
+  else if(pointSet)
+  {
+    vtkPoints* points = pointSet->GetPoints();
+    AddArray(hash, points ? points->GetData() : nullptr);
+
+    vtkStructuredGrid* structGrid = vtkStructuredGrid::SafeDownCast(dataSet);
+    vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataSet);
+    vtkUnstructuredGrid* unstructGrid = vtkUnstructuredGrid::SafeDownCast(dataSet);
+    if(structGrid)
+    {
+      int extent[6];
+      structGrid->GetExtent(extent);
+      hash.addData(reinterpret_cast<const char*>(extent), sizeof(extent));
+    }
+    else if(polyData)
+    {
+      AddCellArray(hash, polyData->GetVerts());
+      AddCellArray(hash, polyData->GetLines());
+      AddCellArray(hash, polyData->GetPolys());
+      AddCellArray(hash, polyData->GetStrips());
+    }
+    else if(unstructGrid)
+    {
+      AddCellArray(hash, unstructGrid->GetCells());
+      AddArray(hash, unstructGrid->GetCellTypesArray());
+    }
+    else
+    {
+      AddMappedCells(hash, dataSet);
+    }
+  }
+
+  AddFieldData(hash, dataSet->GetPointData());
+  AddFieldData(hash, dataSet->GetCellData());
+  AddFieldData(hash, dataSet->GetFieldData());
+
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSDataSetSnapshot::Serialize(vtkDataSet* dataSet, QIODevice* device)
+{
+  if(nullptr == dataSet || nullptr == device)
+  {
+    return false;
+  }
+
+  // Snapshots are only read back on machines with the same byte order and ID size
+  SnapshotWriter writer(device);
+  writer.writeValue<quint32>(SnapshotMagic);
+  writer.writeValue<quint32>(SnapshotVersion);
+  writer.writeValue<quint32>(ByteOrderMark);
+  writer.writeValue<quint32>(sizeof(vtkIdType));
+  if(WriteStructure(writer, dataSet) < 0)
+  {
+    return false;
+  }
+
+  WriteFieldData(writer, dataSet->GetPointData());
+  WriteFieldData(writer, dataSet->GetCellData());
+  WriteFieldData(writer, dataSet->GetFieldData());
+  return writer.isOk();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSDataSetSnapshot::Deserialize(const char* data, qint64 size, std::shared_ptr<const void> owner)
+{
+  if(nullptr == data)
+  {
+    return nullptr;
+  }
+
+  SnapshotReader reader(data, size, owner);
+  const quint32 magic = reader.readValue<quint32>();
+  const quint32 version = reader.readValue<quint32>();
+  const quint32 byteOrder = reader.readValue<quint32>();
+  const quint32 idSize = reader.readValue<quint32>();
+  if(false == reader.isOk() || SnapshotMagic != magic || SnapshotVersion != version || ByteOrderMark != byteOrder || sizeof(vtkIdType) != idSize)
+  {
+    return nullptr;
+  }
+
+  VTK_PTR(vtkDataSet) dataSet = ReadStructure(reader);
+  if(nullptr == dataSet)
+  {
+    return nullptr;
+  }
+
+  ReadFieldData(reader, dataSet->GetPointData());
+  ReadFieldData(reader, dataSet->GetCellData());
+  ReadFieldData(reader, dataSet->GetFieldData());
+  return reader.isOk() ? dataSet : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::shared_ptr<const char> VSDataSetSnapshot::MapFile(const QString& filePath, qint64& size)
+{
+  size = 0;
+  QFile* file = new QFile(filePath);
+  uchar* data = nullptr;
+  if(file->open(QIODevice::ReadOnly) && file->size() > 0)
+  {
+    data = file->map(0, file->size(), QFileDevice::MapPrivateOption);
+  }
+  if(nullptr == data)
+  {
+    delete file;
+    return nullptr;
+  }
+
+  // Closing the file would unmap it, so the file is kept open until the memory is released
+  size = file->size();
+  return std::shared_ptr<const char>(reinterpret_cast<const char*>(data), [file](const char* mappedData) {
+    file->unmap(reinterpret_cast<uchar*>(const_cast<char*>(mappedData)));
+    delete file;
+  });
+}
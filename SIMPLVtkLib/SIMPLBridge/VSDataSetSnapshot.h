@@ -0,0 +1,105 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <vtkDataSet.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QIODevice>
+#include <QtCore/QString>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSDataSetSnapshot VSDataSetSnapshot.h SIMPLVtkLib/SIMPLBridge/VSDataSetSnapshot.h
+ * @brief This class hashes vtkDataSet contents and converts vtkDataSets to and from
+ * self-contained byte snapshots.  Hashes cover the structure, geometry, cells and every
+ * point, cell and field array so two data sets only share a hash if they render the same.
+ * Array memory is hashed in blocks in parallel.  Snapshots store the structure followed
+ * by the raw memory of every array in aligned blocks, so a snapshot in a memory mapped
+ * file is used in place: its arrays are wrapped around the mapping and keep it alive
+ * until VTK frees them.  Snapshots are written straight to a device and use 64-bit sizes
+ * throughout.
+ */
+class SIMPLVtkLib_EXPORT VSDataSetSnapshot
+{
+public:
+  virtual ~VSDataSetSnapshot() = default;
+
+  /**
+   * @brief Returns a SHA-1 hash of the data set's contents.  Returns an empty
+   * QByteArray for a nullptr.
+   * @param dataSet
+   * @return
+   */
+  static QByteArray HashDataSet(vtkDataSet* dataSet);
+
+  /**
+   * @brief Writes a snapshot of the data set to the device.  Returns false if the data
+   * set type cannot be stored or the device could not be written.
+   * @param dataSet
+   * @param device
+   * @return
+   */
+  static bool Serialize(vtkDataSet* dataSet, QIODevice* device);
+
+  /**
+   * @brief Creates a data set from a snapshot written by Serialize.  If an owner is given,
+   * the data set's arrays point into the snapshot memory and hold the owner until they are
+   * freed.  Otherwise the values are copied.  Returns nullptr if the snapshot could not be read.
+   * @param data
+   * @param size
+   * @param owner
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) Deserialize(const char* data, qint64 size, std::shared_ptr<const void> owner = nullptr);
+
+  /**
+   * @brief Maps a file for reading with copy-on-write pages so snapshots in it can be
+   * deserialized in place.  The file stays mapped until the returned pointer and every
+   * array wrapped around it are released.  Returns nullptr if the file could not be mapped.
+   * @param filePath
+   * @param size
+   * @return
+   */
+  static std::shared_ptr<const char> MapFile(const QString& filePath, qint64& size);
+
+protected:
+  VSDataSetSnapshot() = default;
+};
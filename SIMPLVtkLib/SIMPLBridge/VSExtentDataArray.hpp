@@ -0,0 +1,691 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <typeinfo>
+#include <vector>
+
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkDataArray.h>
+#include <vtkGenericDataArray.h>
+#include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
+#include <vtkVersion.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+/**
+ * @class VSExtentMap VSExtentDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSExtentDataArray.hpp
+ * @brief This class maps tuples of a sampled sub-extent to tuples of the structured extent
+ * they were taken from.  Along each axis, index i of the sub-extent maps to the source index
+ * min(first + i * sampleRate, last) so the last sample always lands on the boundary.  Maps
+ * are shared between every array of the same attribute type.
+ */
+class VSExtentMap
+{
+public:
+  using Pointer = std::shared_ptr<const VSExtentMap>;
+
+  /**
+   * @brief Creates a map for the given source dimensions.  The first, last, dimensions and
+   * sample rate are given per axis in the source's index space.
+   * @param sourceDims
+   * @param first
+   * @param last
+   * @param dims
+   * @param sampleRate
+   * @return
+   */
+  static Pointer Create(const int sourceDims[3], const int first[3], const int last[3], const int dims[3], const int sampleRate[3])
+  {
+    std::shared_ptr<VSExtentMap> map(new VSExtentMap());
+
+    vtkIdType stride = 1;
+    for(int axis = 0; axis < 3; axis++)
+    {
+      map->m_SourceDims[axis] = std::max(sourceDims[axis], 1);
+      map->m_Strides[axis] = stride;
+      map->m_Dims[axis] = std::max(dims[axis], 1);
+      map->m_Offsets[axis].resize(map->m_Dims[axis]);
+      for(int i = 0; i < map->m_Dims[axis]; i++)
+      {
+        map->m_Offsets[axis][i] = std::min(first[axis] + i * sampleRate[axis], last[axis]) * stride;
+      }
+
+      stride *= map->m_SourceDims[axis];
+    }
+
+    map->updateContiguity();
+    return map;
+  }
+
+  /**
+   * @brief Creates a map from the outer map's sub-extent directly to the source of the inner
+   * map.  This is used when a view is taken of another view so that cropping a cropped image
+   * does not copy any values.  Returns nullptr if the outer map was not created for the inner
+   * map's sub-extent.
+   * @param inner
+   * @param outer
+   * @return
+   */
+  static Pointer Compose(const Pointer& inner, const Pointer& outer)
+  {
+    if(nullptr == inner || nullptr == outer)
+    {
+      return nullptr;
+    }
+    for(int axis = 0; axis < 3; axis++)
+    {
+      if(outer->m_SourceDims[axis] != inner->m_Dims[axis])
+      {
+        return nullptr;
+      }
+    }
+
+    // Each axis maps independently, so the composed offsets are the inner offsets of the outer indices
+    std::shared_ptr<VSExtentMap> map(new VSExtentMap());
+    for(int axis = 0; axis < 3; axis++)
+    {
+      map->m_SourceDims[axis] = inner->m_SourceDims[axis];
+      map->m_Strides[axis] = inner->m_Strides[axis];
+      map->m_Dims[axis] = outer->m_Dims[axis];
+      map->m_Offsets[axis].resize(map->m_Dims[axis]);
+      for(int i = 0; i < map->m_Dims[axis]; i++)
+      {
+        const vtkIdType innerIdx = outer->m_Offsets[axis][i] / outer->m_Strides[axis];
+        map->m_Offsets[axis][i] = inner->m_Offsets[axis][innerIdx];
+      }
+    }
+
+    map->updateContiguity();
+    return map;
+  }
+
+  /**
+   * @brief Returns the number of tuples in the sub-extent
+   * @return
+   */
+  vtkIdType getNumberOfTuples() const
+  {
+    return static_cast<vtkIdType>(m_Dims[0]) * m_Dims[1] * m_Dims[2];
+  }
+
+  /**
+   * @brief Returns the number of rows along the X axis
+   * @return
+   */
+  vtkIdType getNumberOfRows() const
+  {
+    return static_cast<vtkIdType>(m_Dims[1]) * m_Dims[2];
+  }
+
+  /**
+   * @brief Returns the number of tuples in each row
+   * @return
+   */
+  int getRowLength() const
+  {
+    return m_Dims[0];
+  }
+
+  /**
+   * @brief Returns the source tuple for the first tuple of the given row
+   * @param row
+   * @return
+   */
+  inline vtkIdType getRowStart(vtkIdType row) const
+  {
+    return m_Offsets[1][row % m_Dims[1]] + m_Offsets[2][row / m_Dims[1]];
+  }
+
+  /**
+   * @brief Returns the source tuple for the given tuple
+   * @param tupleIdx
+   * @return
+   */
+  inline vtkIdType getSourceTuple(vtkIdType tupleIdx) const
+  {
+    return m_Offsets[0][tupleIdx % m_Dims[0]] + getRowStart(tupleIdx / m_Dims[0]);
+  }
+
+  /**
+   * @brief Returns the source tuple offset along the X axis
+   * @param i
+   * @return
+   */
+  inline vtkIdType getColumnOffset(int i) const
+  {
+    return m_Offsets[0][i];
+  }
+
+  /**
+   * @brief Returns true if each row is a contiguous run of source tuples
+   * @return
+   */
+  bool areRowsContiguous() const
+  {
+    return m_RowsContiguous;
+  }
+
+  /**
+   * @brief Returns true if the whole sub-extent is a contiguous run of source tuples
+   * @return
+   */
+  bool isContiguous() const
+  {
+    return m_Contiguous;
+  }
+
+protected:
+  VSExtentMap() = default;
+
+  /**
+   * @brief Rows are contiguous when neighboring samples are neighboring source tuples.  The
+   * whole sub-extent is contiguous when each axis also spans the full source row or plane.
+   */
+  void updateContiguity()
+  {
+    m_RowsContiguous = IsConsecutive(m_Offsets[0], 1);
+    m_Contiguous = m_RowsContiguous;
+    if(m_Dims[1] > 1)
+    {
+      m_Contiguous = m_Contiguous && m_Dims[0] == m_SourceDims[0] && IsConsecutive(m_Offsets[1], m_Strides[1]);
+    }
+    if(m_Dims[2] > 1)
+    {
+      m_Contiguous = m_Contiguous && m_Dims[0] * m_Dims[1] == m_SourceDims[0] * m_SourceDims[1] && IsConsecutive(m_Offsets[2], m_Strides[2]);
+    }
+  }
+
+  /**
+   * @brief Returns true if each offset is the previous offset plus the given step
+   * @param offsets
+   * @param step
+   * @return
+   */
+  static bool IsConsecutive(const std::vector<vtkIdType>& offsets, vtkIdType step)
+  {
+    for(size_t i = 1; i < offsets.size(); i++)
+    {
+      if(offsets[i] != offsets[i - 1] + step)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  int m_Dims[3] = {1, 1, 1};
+  int m_SourceDims[3] = {1, 1, 1};
+  vtkIdType m_Strides[3] = {1, 1, 1};
+  std::vector<vtkIdType> m_Offsets[3];
+  bool m_RowsContiguous = false;
+  bool m_Contiguous = false;
+};
+
+/**
+ * @class VSExtentArray VSExtentDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSExtentDataArray.hpp
+ * @brief This class allows the source array and map of any VSExtentDataArray to be found
+ * without knowing its value type.
+ */
+class VSExtentArray
+{
+public:
+  virtual ~VSExtentArray() = default;
+
+  /**
+   * @brief Returns the source array
+   * @return
+   */
+  virtual vtkDataArray* GetSource() const = 0;
+
+  /**
+   * @brief Returns the map from the viewed sub-extent to the source array
+   * @return
+   */
+  virtual VSExtentMap::Pointer GetExtentMap() const = 0;
+};
+
+/**
+ * @class VSExtentDataArray VSExtentDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSExtentDataArray.hpp
+ * @brief This class is a read-only vtkDataArray viewing a sub-extent of a structured source
+ * array through a VSExtentMap.  Cropping an image only creates these views, no values are
+ * copied.  Values are gathered in parallel into a contiguous buffer the first time
+ * GetVoidPointer is requested, unless the sub-extent is already contiguous in the source in
+ * which case the source memory is returned directly.
+ *
+ * New instances are plain vtkAOSDataArrayTemplates so filters copying tuples into a new
+ * array of the same type get writable storage.  NewInstance is declared to return a
+ * vtkDataArray for the same reason.
+ */
+template <class ValueTypeT> class VSExtentDataArray : public vtkGenericDataArray<VSExtentDataArray<ValueTypeT>, ValueTypeT>, public VSExtentArray
+{
+  using GenericDataArrayType = vtkGenericDataArray<VSExtentDataArray<ValueTypeT>, ValueTypeT>;
+
+public:
+  using SelfType = VSExtentDataArray<ValueTypeT>;
+  // NewInstance returns a vtkDataArray because new instances are not of this class
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, GenericDataArrayType, vtkDataArray, typeid(SelfType).name())
+  using ValueType = typename Superclass::ValueType;
+  using SourceArrayType = vtkAOSDataArrayTemplate<ValueType>;
+
+  static VSExtentDataArray* New()
+  {
+    VTK_STANDARD_NEW_BODY(VSExtentDataArray)
+  }
+
+  /**
+   * @brief Sets the source array and the map to its sub-extent.  Returns false if the source
+   * is not an array of contiguous values.
+   * @param source
+   * @param map
+   * @return
+   */
+  bool SetSource(vtkDataArray* source, VSExtentMap::Pointer map)
+  {
+    SourceArrayType* sourceArray = SourceArrayType::FastDownCast(source);
+    if(nullptr == sourceArray || nullptr == map)
+    {
+      return false;
+    }
+
+    m_Source = sourceArray;
+    m_Map = map;
+    m_Gathered = nullptr;
+
+    this->SetName(source->GetName());
+    this->NumberOfComponents = source->GetNumberOfComponents();
+    this->Size = map->getNumberOfTuples() * this->NumberOfComponents;
+    this->MaxId = this->Size - 1;
+    this->DataChanged();
+    return true;
+  }
+
+  /**
+   * @brief Returns the source array
+   * @return
+   */
+  vtkDataArray* GetSource() const override
+  {
+    return m_Source;
+  }
+
+  /**
+   * @brief Returns the map from the viewed sub-extent to the source array
+   * @return
+   */
+  VSExtentMap::Pointer GetExtentMap() const override
+  {
+    return m_Map;
+  }
+
+  /**
+   * @brief Returns the value for the given value index
+   * @param valueIdx
+   * @return
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    const vtkIdType tupleIdx = valueIdx / this->NumberOfComponents;
+    const int compIdx = static_cast<int>(valueIdx % this->NumberOfComponents);
+    return GetTypedComponent(tupleIdx, compIdx);
+  }
+
+  /**
+   * @brief Read-only.  Does nothing.
+   * @param valueIdx
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+  }
+
+  /**
+   * @brief Copies the tuple at the given index
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    const int numComps = this->NumberOfComponents;
+    const ValueType* source = m_Source->GetPointer(m_Map->getSourceTuple(tupleIdx) * numComps);
+    std::copy(source, source + numComps, tuple);
+  }
+
+  /**
+   * @brief Read-only.  Does nothing.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+  }
+
+  /**
+   * @brief Returns the component specified by tuple and component ID
+   * @param tupleIdx
+   * @param compIdx
+   * @return
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    return m_Source->GetValue(m_Map->getSourceTuple(tupleIdx) * this->NumberOfComponents + compIdx);
+  }
+
+  /**
+   * @brief Read-only.  Does nothing.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+  }
+
+  /**
+   * @brief Returns a pointer to the viewed values.  Contiguous sub-extents point into the
+   * source array.  Otherwise the values are gathered on first use and kept until the source
+   * changes.  Background filters and the render thread may request the pointer at the same time.
+   * @param valueIdx
+   * @return
+   */
+  void* GetVoidPointer(vtkIdType valueIdx) override
+  {
+    if(nullptr == m_Source)
+    {
+      return nullptr;
+    }
+
+    if(m_Map->isContiguous())
+    {
+      return m_Source->GetVoidPointer(m_Map->getSourceTuple(0) * this->NumberOfComponents + valueIdx);
+    }
+
+    std::lock_guard<std::mutex> lock(m_GatherLock);
+    if(nullptr == m_Gathered || m_Gathered->GetMTime() < m_Source->GetMTime())
+    {
+      m_Gathered = Gather();
+    }
+
+    return m_Gathered->GetVoidPointer(valueIdx);
+  }
+
+  /**
+   * @brief Copies the viewed values into a new contiguous array.  Rows are gathered in parallel.
+   * @return
+   */
+  VTK_PTR(SourceArrayType) Gather() const
+  {
+    // Gathered values keep the source's array class such as vtkUnsignedCharArray
+    VTK_PTR(SourceArrayType) gathered = nullptr;
+    if(m_Source)
+    {
+      gathered.TakeReference(SourceArrayType::FastDownCast(m_Source->NewInstance()));
+    }
+    if(nullptr == gathered)
+    {
+      gathered = VTK_PTR(SourceArrayType)::New();
+    }
+    gathered->SetNumberOfComponents(this->NumberOfComponents);
+    if(nullptr == m_Source)
+    {
+      return gathered;
+    }
+    gathered->SetName(m_Source->GetName());
+    gathered->SetNumberOfTuples(m_Map->getNumberOfTuples());
+
+    const int numComps = this->NumberOfComponents;
+    const int rowLength = m_Map->getRowLength();
+    const ValueType* source = m_Source->GetPointer(0);
+    ValueType* target = gathered->GetPointer(0);
+    const VSExtentMap* map = m_Map.get();
+    vtkSMPTools::For(0, map->getNumberOfRows(), [=](vtkIdType begin, vtkIdType end) {
+      for(vtkIdType row = begin; row < end; row++)
+      {
+        const vtkIdType rowStart = map->getRowStart(row);
+        ValueType* rowTarget = target + row * rowLength * numComps;
+        if(map->areRowsContiguous())
+        {
+          const ValueType* rowSource = source + (rowStart + map->getColumnOffset(0)) * numComps;
+          std::copy(rowSource, rowSource + rowLength * numComps, rowTarget);
+          continue;
+        }
+
+        for(int i = 0; i < rowLength; i++)
+        {
+          const ValueType* tupleSource = source + (rowStart + map->getColumnOffset(i)) * numComps;
+          std::copy(tupleSource, tupleSource + numComps, rowTarget + i * numComps);
+        }
+      }
+    });
+
+    return gathered;
+  }
+
+  /**
+   * @brief Returns the memory in kibibytes held by gathered values.  Viewed values belong
+   * to the source array.
+   * @return
+   */
+#if VTK_MAJOR_VERSION >= 9
+  unsigned long GetActualMemorySize() const override
+#else
+  unsigned long GetActualMemorySize() override
+#endif
+  {
+    std::lock_guard<std::mutex> lock(m_GatherLock);
+    return (nullptr == m_Gathered) ? 1 : m_Gathered->GetActualMemorySize() + 1;
+  }
+
+protected:
+  VSExtentDataArray() = default;
+  ~VSExtentDataArray() override = default;
+
+  /**
+   * @brief Returns a writable array of the same value type
+   * @return
+   */
+  vtkObjectBase* NewInstanceInternal() const override
+  {
+    return SourceArrayType::New();
+  }
+
+  /**
+   * @brief The array is sized by its extent map.  Allocation requests are ignored.
+   * @param numTuples
+   * @return
+   */
+  bool AllocateTuples(vtkIdType numTuples)
+  {
+    return true;
+  }
+
+  /**
+   * @brief The array is sized by its extent map.  Allocation requests are ignored.
+   * @param numTuples
+   * @return
+   */
+  bool ReallocateTuples(vtkIdType numTuples)
+  {
+    return true;
+  }
+
+  friend class vtkGenericDataArray<VSExtentDataArray<ValueTypeT>, ValueTypeT>;
+
+private:
+  VTK_PTR(SourceArrayType) m_Source = nullptr;
+  VSExtentMap::Pointer m_Map = nullptr;
+  VTK_PTR(SourceArrayType) m_Gathered = nullptr;
+  mutable std::mutex m_GatherLock;
+
+  VSExtentDataArray(const VSExtentDataArray&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSExtentDataArray&) = delete;    // Operator '=' Not Implemented
+};
+
+/**
+ * @class VSExtentDataArrays VSExtentDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSExtentDataArray.hpp
+ * @brief This class creates VSExtentDataArrays matching the value type of a source vtkDataArray
+ * and gathers sub-extents of arrays that cannot be viewed.
+ */
+class VSExtentDataArrays
+{
+public:
+  /**
+   * @brief Creates a VSExtentDataArray viewing the source array through the given map.
+   * Views of other views look through to their source.  Returns nullptr if the source does
+   * not store its values contiguously.
+   * @param source
+   * @param map
+   * @return
+   */
+  static VTK_PTR(vtkDataArray) Create(vtkDataArray* source, VSExtentMap::Pointer map)
+  {
+    if(nullptr == source || nullptr == map)
+    {
+      return nullptr;
+    }
+
+    ComposeExtentView(source, map);
+
+    VTK_PTR(vtkDataArray) array = nullptr;
+    switch(source->GetDataType())
+    {
+      vtkTemplateMacro(array = CreateTemplate<VTK_TT>(source, map));
+    default:
+      break;
+    }
+
+    return array;
+  }
+
+  /**
+   * @brief Copies the sub-extent of any vtkDataArray into a new array of the same type.
+   * Tuples are copied in parallel.
+   * @param source
+   * @param map
+   * @return
+   */
+  static VTK_PTR(vtkDataArray) Gather(vtkDataArray* source, VSExtentMap::Pointer map)
+  {
+    if(nullptr == source || nullptr == map)
+    {
+      return nullptr;
+    }
+
+    ComposeExtentView(source, map);
+
+    VTK_PTR(vtkDataArray) gathered = nullptr;
+    switch(source->GetDataType())
+    {
+      vtkTemplateMacro(gathered = GatherTemplate<VTK_TT>(source, map));
+    default:
+      break;
+    }
+    if(gathered)
+    {
+      return gathered;
+    }
+
+    // Arrays without contiguous storage are copied a tuple at a time
+    gathered.TakeReference(source->NewInstance());
+    gathered->SetName(source->GetName());
+    gathered->SetNumberOfComponents(source->GetNumberOfComponents());
+    gathered->SetNumberOfTuples(map->getNumberOfTuples());
+
+    const int numComps = source->GetNumberOfComponents();
+    vtkDataArray* target = gathered;
+    const VSExtentMap* extentMap = map.get();
+    vtkSMPTools::For(0, map->getNumberOfTuples(), [=](vtkIdType begin, vtkIdType end) {
+      std::vector<double> tuple(numComps);
+      for(vtkIdType tupleIdx = begin; tupleIdx < end; tupleIdx++)
+      {
+        source->GetTuple(extentMap->getSourceTuple(tupleIdx), tuple.data());
+        target->SetTuple(tupleIdx, tuple.data());
+      }
+    });
+
+    return gathered;
+  }
+
+protected:
+  /**
+   * @brief Replaces a source that is itself a VSExtentDataArray with its own source and the
+   * map composed through both sub-extents
+   * @param source
+   * @param map
+   */
+  static void ComposeExtentView(vtkDataArray*& source, VSExtentMap::Pointer& map)
+  {
+    VSExtentArray* extentArray = dynamic_cast<VSExtentArray*>(source);
+    if(nullptr == extentArray || nullptr == extentArray->GetSource())
+    {
+      return;
+    }
+
+    VSExtentMap::Pointer composedMap = VSExtentMap::Compose(extentArray->GetExtentMap(), map);
+    if(composedMap)
+    {
+      source = extentArray->GetSource();
+      map = composedMap;
+    }
+  }
+
+  template <typename T> static VTK_PTR(vtkDataArray) CreateTemplate(vtkDataArray* source, VSExtentMap::Pointer map)
+  {
+    VTK_PTR(VSExtentDataArray<T>) array = VTK_PTR(VSExtentDataArray<T>)::New();
+    if(false == array->SetSource(source, map))
+    {
+      return nullptr;
+    }
+
+    return VTK_PTR(vtkDataArray)(array.GetPointer());
+  }
+
+  template <typename T> static VTK_PTR(vtkDataArray) GatherTemplate(vtkDataArray* source, VSExtentMap::Pointer map)
+  {
+    VTK_PTR(VSExtentDataArray<T>) array = VTK_PTR(VSExtentDataArray<T>)::New();
+    if(false == array->SetSource(source, map))
+    {
+      return nullptr;
+    }
+
+    return VTK_PTR(vtkDataArray)(array->Gather().GetPointer());
+  }
+};
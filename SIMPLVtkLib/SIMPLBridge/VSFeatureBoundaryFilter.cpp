@@ -0,0 +1,536 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSFeatureBoundaryFilter.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkArrayDispatch.h>
+#include <vtkCellData.h>
+#include <vtkDataArrayAccessor.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkVersion.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSImagePointMarker.h"
+
+namespace
+{
+// The two in-plane axes for faces normal to each axis.  The order keeps (axis, u, v) right-handed.
+const int FaceAxes[3][2] = {{1, 2}, {2, 0}, {0, 1}};
+
+struct FaceRow
+{
+  int m_Axis;
+  vtkIdType m_Plane;
+  vtkIdType m_Row;
+};
+
+/**
+ * @brief Face labels keep the feature ID type so large IDs are not truncated.  Unsigned
+ * IDs are widened to a signed type so the outside of the volume can be labeled with -1.
+ */
+template <typename T, bool Widen = std::is_integral<T>::value && std::is_unsigned<T>::value>
+struct FaceLabel
+{
+  using Type = T;
+};
+
+template <typename T>
+struct FaceLabel<T, true>
+{
+  using Type = typename std::conditional<(sizeof(T) < sizeof(int)), int, vtkTypeInt64>::type;
+};
+
+/**
+ * @brief Finds the faces between cells with different IDs and generates their points, cells,
+ * and labels.  IDs are read through an array accessor so arrays of any memory layout are
+ * used in place.
+ */
+struct BoundaryFacesWorker
+{
+  vtkImageData* m_Image = nullptr;
+  bool m_Exterior = false;
+
+  VTK_PTR(vtkFloatArray) m_Coords;
+  VTK_PTR(vtkIdTypeArray) m_Cells;
+  VTK_PTR(vtkDataArray) m_Labels;
+  vtkIdType m_NumFaces = 0;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* idArray)
+  {
+    using LabelType = typename FaceLabel<typename vtkDataArrayAccessor<ArrayT>::APIType>::Type;
+    using LabelArrayType = vtkAOSDataArrayTemplate<LabelType>;
+
+    const vtkDataArrayAccessor<ArrayT> ids(idArray);
+    const bool exterior = m_Exterior;
+
+    int extent[6];
+    m_Image->GetExtent(extent);
+    const vtkIdType cellDims[3] = {std::max(extent[1] - extent[0], 0), std::max(extent[3] - extent[2], 0), std::max(extent[5] - extent[4], 0)};
+    const vtkIdType pointDims[3] = {cellDims[0] + 1, cellDims[1] + 1, cellDims[2] + 1};
+    const vtkIdType firstPlane = exterior ? 0 : 1;
+
+    // Rows are numbered through every plane of every axis so they can be split between threads
+    vtkIdType axisRows[4] = {0, 0, 0, 0};
+    for(int axis = 0; axis < 3; axis++)
+    {
+      const vtkIdType numPlanes = exterior ? cellDims[axis] + 1 : std::max<vtkIdType>(cellDims[axis] - 1, 0);
+      axisRows[axis + 1] = axisRows[axis] + numPlanes * cellDims[FaceAxes[axis][1]];
+    }
+    const vtkIdType numRows = axisRows[3];
+
+    auto rowAt = [=](vtkIdType r) -> FaceRow {
+      const int axis = r < axisRows[1] ? 0 : (r < axisRows[2] ? 1 : 2);
+      const vtkIdType local = r - axisRows[axis];
+      const vtkIdType rowsPerPlane = cellDims[FaceAxes[axis][1]];
+      return {axis, firstPlane + local / rowsPerPlane, local % rowsPerPlane};
+    };
+
+    // Stores the IDs on either side of the plane with -1 outside the volume.  Returns 1 if the
+    // face's normal points along the axis, -1 if it points against it, and 0 if there is no face.
+    auto faceDirection = [=](int axis, vtkIdType plane, vtkIdType u, vtkIdType v, LabelType* labels) -> int {
+      vtkIdType index[3];
+      index[FaceAxes[axis][0]] = u;
+      index[FaceAxes[axis][1]] = v;
+
+      for(int side = 0; side < 2; side++)
+      {
+        index[axis] = plane - 1 + side;
+        if(index[axis] < 0 || index[axis] >= cellDims[axis])
+        {
+          labels[side] = -1;
+          continue;
+        }
+
+        const vtkIdType cellId = index[0] + index[1] * cellDims[0] + index[2] * cellDims[0] * cellDims[1];
+        labels[side] = static_cast<LabelType>(ids.Get(cellId, 0));
+      }
+
+      if(labels[0] == labels[1])
+      {
+        return 0;
+      }
+      return labels[0] > labels[1] ? 1 : -1;
+    };
+
+    // Counter-clockwise corners when looking against a face normal along the axis
+    const vtkIdType cornersU[4] = {0, 1, 1, 0};
+    const vtkIdType cornersV[4] = {0, 0, 1, 1};
+    auto cornerPoint = [=](const FaceRow& row, vtkIdType u, int corner) -> vtkIdType {
+      vtkIdType pointIndex[3];
+      pointIndex[row.m_Axis] = row.m_Plane;
+      pointIndex[FaceAxes[row.m_Axis][0]] = u + cornersU[corner];
+      pointIndex[FaceAxes[row.m_Axis][1]] = row.m_Row + cornersV[corner];
+      return pointIndex[0] + pointIndex[1] * pointDims[0] + pointIndex[2] * pointDims[0] * pointDims[1];
+    };
+
+    // Faces are counted per row while marking the image points they touch
+    VSImagePointMarker marker(pointDims[0], pointDims[1] * pointDims[2]);
+    VSImagePointMarker* markerPtr = &marker;
+    std::vector<vtkIdType> rowOffsets(numRows + 1, 0);
+    vtkIdType* offsetPtr = rowOffsets.data();
+    vtkSMPTools::For(0, numRows, [=](vtkIdType begin, vtkIdType end) {
+      LabelType labels[2];
+      for(vtkIdType r = begin; r < end; r++)
+      {
+        const FaceRow row = rowAt(r);
+        const vtkIdType rowLength = cellDims[FaceAxes[row.m_Axis][0]];
+        vtkIdType count = 0;
+        for(vtkIdType u = 0; u < rowLength; u++)
+        {
+          if(0 == faceDirection(row.m_Axis, row.m_Plane, u, row.m_Row, labels))
+          {
+            continue;
+          }
+
+          for(int corner = 0; corner < 4; corner++)
+          {
+            markerPtr->mark(cornerPoint(row, u, corner));
+          }
+          count++;
+        }
+        offsetPtr[r + 1] = count;
+      }
+    });
+
+    for(vtkIdType r = 0; r < numRows; r++)
+    {
+      rowOffsets[r + 1] += rowOffsets[r];
+    }
+    const vtkIdType numFaces = rowOffsets[numRows];
+
+    const vtkIdType numPoints = marker.numberPoints();
+    m_Coords = marker.createPoints(m_Image, numPoints);
+
+#if VTK_MAJOR_VERSION >= 9
+    const vtkIdType prefix = 0;
+#else
+    // The legacy cell array layout prefixes each cell with its size
+    const vtkIdType prefix = 1;
+#endif
+    const vtkIdType cellSize = 4 + prefix;
+
+    m_Cells = VTK_PTR(vtkIdTypeArray)::New();
+    m_Cells->SetNumberOfValues(numFaces * cellSize);
+    vtkIdType* cellPtr = m_Cells->GetPointer(0);
+
+    VTK_NEW(LabelArrayType, faceLabels);
+    faceLabels->SetName("FaceLabels");
+    faceLabels->SetNumberOfComponents(2);
+    faceLabels->SetNumberOfTuples(numFaces);
+    LabelType* labelPtr = faceLabels->GetPointer(0);
+
+    vtkSMPTools::For(0, numRows, [=](vtkIdType begin, vtkIdType end) {
+      LabelType labels[2];
+      for(vtkIdType r = begin; r < end; r++)
+      {
+        const FaceRow row = rowAt(r);
+        const vtkIdType rowLength = cellDims[FaceAxes[row.m_Axis][0]];
+        vtkIdType faceId = offsetPtr[r];
+        for(vtkIdType u = 0; u < rowLength; u++)
+        {
+          const int direction = faceDirection(row.m_Axis, row.m_Plane, u, row.m_Row, labels);
+          if(0 == direction)
+          {
+            continue;
+          }
+
+          labelPtr[faceId * 2] = std::min(labels[0], labels[1]);
+          labelPtr[faceId * 2 + 1] = std::max(labels[0], labels[1]);
+
+          vtkIdType* cell = cellPtr + faceId * cellSize;
+          if(prefix > 0)
+          {
+            cell[0] = 4;
+          }
+          for(int corner = 0; corner < 4; corner++)
+          {
+            const int ordered = direction > 0 ? corner : (4 - corner) % 4;
+            cell[prefix + corner] = markerPtr->pointId(cornerPoint(row, u, ordered));
+          }
+          faceId++;
+        }
+      }
+    });
+
+    m_Labels = VTK_PTR(vtkDataArray)(faceLabels.GetPointer());
+    m_NumFaces = numFaces;
+  }
+};
+
+/**
+ * @brief Marks the faces whose labels match a highlighted pair or feature
+ * @param labels
+ * @param numFaces
+ * @param pairs
+ * @param features
+ * @param highlight
+ */
+template <typename T>
+void HighlightFaces(const T* labels, vtkIdType numFaces, const std::vector<VSFeatureBoundaryFilter::FeaturePair>& pairs, const std::vector<vtkIdType>& features, unsigned char* highlight)
+{
+  vtkSMPTools::For(0, numFaces, [&](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType faceId = begin; faceId < end; faceId++)
+    {
+      const VSFeatureBoundaryFilter::FeaturePair faceLabels(static_cast<vtkIdType>(labels[faceId * 2]), static_cast<vtkIdType>(labels[faceId * 2 + 1]));
+      const bool highlighted = std::binary_search(pairs.begin(), pairs.end(), faceLabels) || std::binary_search(features.begin(), features.end(), faceLabels.first) ||
+                               std::binary_search(features.begin(), features.end(), faceLabels.second);
+      highlight[faceId] = highlighted ? 1 : 0;
+    }
+  });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFeatureBoundaryFilter* VSFeatureBoundaryFilter::New()
+{
+  return new VSFeatureBoundaryFilter();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFeatureBoundaryFilter::VSFeatureBoundaryFilter()
+: vtkPolyDataAlgorithm()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFeatureBoundaryFilter::~VSFeatureBoundaryFilter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFeatureBoundaryFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Include Exterior: " << m_IncludeExterior << endl;
+  os << indent << "Highlighted Pairs: " << m_HighlightedPairs.size() << endl;
+  os << indent << "Faces: " << GetNumberOfFaces() << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFeatureBoundaryFilter::SetIncludeExterior(bool include)
+{
+  if(include != m_IncludeExterior)
+  {
+    m_IncludeExterior = include;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFeatureBoundaryFilter::GetIncludeExterior() const
+{
+  return m_IncludeExterior;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFeatureBoundaryFilter::SetHighlightedPairs(const std::vector<FeaturePair>& pairs)
+{
+  if(pairs != m_HighlightedPairs)
+  {
+    m_HighlightedPairs = pairs;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VSFeatureBoundaryFilter::FeaturePair> VSFeatureBoundaryFilter::GetHighlightedPairs() const
+{
+  return m_HighlightedPairs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSFeatureBoundaryFilter::GetNumberOfFaces() const
+{
+  if(nullptr == m_FaceLabels)
+  {
+    return 0;
+  }
+
+  return m_FaceLabels->GetNumberOfTuples();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFeatureBoundaryFilter::ClearCache()
+{
+  m_CachedExtent[1] = -1;
+  m_CachedIds = nullptr;
+  m_CachedIdTime = 0;
+  m_Points = nullptr;
+  m_Polys = nullptr;
+  m_FaceLabels = nullptr;
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSFeatureBoundaryFilter::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSFeatureBoundaryFilter::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0], 0);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  vtkDataArray* featureIds = GetInputArrayToProcess(0, inputVector);
+  if(nullptr == featureIds || featureIds->GetNumberOfComponents() != 1 || featureIds->GetNumberOfTuples() != input->GetNumberOfCells())
+  {
+    vtkErrorMacro(<< "A single component cell array is required to find feature boundaries");
+    return 0;
+  }
+
+  if(false == isCacheValid(input, featureIds))
+  {
+    updateFaces(input, featureIds);
+  }
+
+  output->SetPoints(m_Points);
+  output->SetPolys(m_Polys);
+  output->GetCellData()->AddArray(m_FaceLabels);
+  if(false == m_HighlightedPairs.empty())
+  {
+    output->GetCellData()->AddArray(createHighlightArray());
+    output->GetCellData()->SetActiveScalars("Highlighted");
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFeatureBoundaryFilter::isCacheValid(vtkImageData* image, vtkDataArray* featureIds) const
+{
+  if(nullptr == m_Polys || featureIds != m_CachedIds || featureIds->GetMTime() != m_CachedIdTime || m_IncludeExterior != m_CachedExterior)
+  {
+    return false;
+  }
+
+  int extent[6];
+  image->GetExtent(extent);
+  double* origin = image->GetOrigin();
+  double* spacing = image->GetSpacing();
+  for(int i = 0; i < 3; i++)
+  {
+    if(extent[2 * i] != m_CachedExtent[2 * i] || extent[2 * i + 1] != m_CachedExtent[2 * i + 1])
+    {
+      return false;
+    }
+    if(origin[i] != m_CachedOrigin[i] || spacing[i] != m_CachedSpacing[i])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFeatureBoundaryFilter::updateFaces(vtkImageData* image, vtkDataArray* featureIds)
+{
+  BoundaryFacesWorker worker;
+  worker.m_Image = image;
+  worker.m_Exterior = m_IncludeExterior;
+
+  // Arrays outside the dispatch list are read through the generic vtkDataArray API
+  if(false == vtkArrayDispatch::Dispatch::Execute(featureIds, worker))
+  {
+    worker(featureIds);
+  }
+
+  int extent[6];
+  double origin[3];
+  double spacing[3];
+  image->GetExtent(extent);
+  image->GetOrigin(origin);
+  image->GetSpacing(spacing);
+
+  m_Points = VTK_PTR(vtkPoints)::New();
+  m_Points->SetData(worker.m_Coords);
+  m_Polys = VTK_PTR(vtkCellArray)::New();
+#if VTK_MAJOR_VERSION >= 9
+  m_Polys->SetData(4, worker.m_Cells);
+#else
+  m_Polys->SetCells(worker.m_NumFaces, worker.m_Cells);
+#endif
+  m_FaceLabels = worker.m_Labels;
+
+  std::copy(extent, extent + 6, m_CachedExtent);
+  std::copy(origin, origin + 3, m_CachedOrigin);
+  std::copy(spacing, spacing + 3, m_CachedSpacing);
+  m_CachedIds = featureIds;
+  m_CachedIdTime = featureIds->GetMTime();
+  m_CachedExterior = m_IncludeExterior;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataArray) VSFeatureBoundaryFilter::createHighlightArray() const
+{
+  // Pairs with the same ID twice match every boundary of the feature
+  std::vector<FeaturePair> pairs;
+  std::vector<vtkIdType> features;
+  for(const FeaturePair& pair : m_HighlightedPairs)
+  {
+    if(pair.first == pair.second)
+    {
+      features.push_back(pair.first);
+    }
+    else
+    {
+      pairs.push_back(std::make_pair(std::min(pair.first, pair.second), std::max(pair.first, pair.second)));
+    }
+  }
+  std::sort(pairs.begin(), pairs.end());
+  std::sort(features.begin(), features.end());
+
+  const vtkIdType numFaces = GetNumberOfFaces();
+  VTK_PTR(vtkUnsignedCharArray) highlight = VTK_PTR(vtkUnsignedCharArray)::New();
+  highlight->SetName("Highlighted");
+  highlight->SetNumberOfValues(numFaces);
+  unsigned char* highlightPtr = highlight->GetPointer(0);
+
+  // Face labels are always created as contiguous arrays of the feature ID type
+  switch(m_FaceLabels->GetDataType())
+  {
+    vtkTemplateMacro(HighlightFaces(static_cast<const VTK_TT*>(m_FaceLabels->GetVoidPointer(0)), numFaces, pairs, features, highlightPtr));
+  default:
+    break;
+  }
+
+  return VTK_PTR(vtkDataArray)(highlight.GetPointer());
+}
@@ -0,0 +1,170 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <vtkCellArray.h>
+#include <vtkDataArray.h>
+#include <vtkPoints.h>
+#include <vtkPolyDataAlgorithm.h>
+#include <vtkType.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkImageData;
+
+/**
+ * @class VSFeatureBoundaryFilter VSFeatureBoundaryFilter.h SIMPLVtkLib/SIMPLBridge/VSFeatureBoundaryFilter.h
+ * @brief This class extracts the voxel faces separating cells with different feature IDs
+ * from a vtkImageData volume.  The ID array is selected through SetInputArrayToProcess and
+ * must have a single component.  Rows of faces are generated in parallel and points are
+ * shared between faces.  Each face stores the IDs on either side in the two component
+ * "FaceLabels" cell array with the smaller ID first, and face normals point from the larger
+ * ID towards the smaller one.  Labels keep the ID array's type, with unsigned IDs widened to
+ * a signed type.  When the exterior is included, faces on the volume's boundary are labeled
+ * with -1 for the outside.
+ *
+ * Faces are cached until the image structure or ID array changes, so changing the
+ * highlighted feature pairs only updates the "Highlighted" cell array.
+ */
+class SIMPLVtkLib_EXPORT VSFeatureBoundaryFilter : public vtkPolyDataAlgorithm
+{
+public:
+  using FeaturePair = std::pair<vtkIdType, vtkIdType>;
+
+  static VSFeatureBoundaryFilter* New();
+  vtkTypeMacro(VSFeatureBoundaryFilter, vtkPolyDataAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets whether faces on the volume's boundary are generated
+   * @param include
+   */
+  void SetIncludeExterior(bool include);
+
+  /**
+   * @brief Returns true if faces on the volume's boundary are generated
+   * @return
+   */
+  bool GetIncludeExterior() const;
+
+  /**
+   * @brief Sets the feature pairs whose faces are highlighted.  A pair with
+   * the same ID twice highlights every boundary of that feature.
+   * @param pairs
+   */
+  void SetHighlightedPairs(const std::vector<FeaturePair>& pairs);
+
+  /**
+   * @brief Returns the highlighted feature pairs
+   * @return
+   */
+  std::vector<FeaturePair> GetHighlightedPairs() const;
+
+  /**
+   * @brief Returns the number of faces found for the cached feature IDs
+   * @return
+   */
+  vtkIdType GetNumberOfFaces() const;
+
+  /**
+   * @brief Clears the cached faces so they are recomputed on the next update
+   */
+  void ClearCache();
+
+protected:
+  VSFeatureBoundaryFilter();
+  ~VSFeatureBoundaryFilter() override;
+
+  /**
+   * @brief Only accepts vtkImageData inputs
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Creates the boundary faces for the input
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Returns true if the cached faces were generated for the given image and feature IDs
+   * @param image
+   * @param featureIds
+   * @return
+   */
+  bool isCacheValid(vtkImageData* image, vtkDataArray* featureIds) const;
+
+  /**
+   * @brief Generates the faces, points, and face labels for the given image and feature IDs
+   * @param image
+   * @param featureIds
+   */
+  void updateFaces(vtkImageData* image, vtkDataArray* featureIds);
+
+  /**
+   * @brief Creates the highlight array for the cached face labels
+   * @return
+   */
+  VTK_PTR(vtkDataArray) createHighlightArray() const;
+
+private:
+  bool m_IncludeExterior = false;
+  std::vector<FeaturePair> m_HighlightedPairs;
+
+  int m_CachedExtent[6] = {0, -1, 0, -1, 0, -1};
+  double m_CachedOrigin[3] = {0.0, 0.0, 0.0};
+  double m_CachedSpacing[3] = {0.0, 0.0, 0.0};
+  vtkDataArray* m_CachedIds = nullptr;
+  vtkMTimeType m_CachedIdTime = 0;
+  bool m_CachedExterior = false;
+
+  VTK_PTR(vtkPoints) m_Points = nullptr;
+  VTK_PTR(vtkCellArray) m_Polys = nullptr;
+  VTK_PTR(vtkDataArray) m_FaceLabels = nullptr;
+
+  VSFeatureBoundaryFilter(const VSFeatureBoundaryFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSFeatureBoundaryFilter&) = delete;          // Operator '=' Not Implemented
+};
@@ -0,0 +1,413 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSIPFColorGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <vtkDoubleArray.h>
+#include <vtkSMPTools.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+
+namespace
+{
+// Number of tuples rotated together before they are reduced and colored
+const vtkIdType BlockSize = 1024;
+
+const double Pi = 3.14159265358979323846;
+
+/**
+ * @brief Converts the relative distances from the triangle's corners to an RGB color
+ * using DREAM3D's scaling so the legend matches its IPF color filters.
+ * @param chiRatio Angle from the red corner divided by the maximum angle in the triangle
+ * @param etaRatio Azimuth from the green edge divided by the triangle's azimuth range
+ * @param rgb
+ */
+inline void TriangleColor(double chiRatio, double etaRatio, unsigned char* rgb)
+{
+  chiRatio = std::min(std::max(chiRatio, 0.0), 1.0);
+  etaRatio = std::min(std::max(etaRatio, 0.0), 1.0);
+
+  double red = std::sqrt(1.0 - chiRatio);
+  double green = std::sqrt((1.0 - etaRatio) * chiRatio);
+  double blue = std::sqrt(etaRatio * chiRatio);
+
+  double maxValue = std::max(red, std::max(green, blue));
+  if(maxValue <= 0.0)
+  {
+    maxValue = 1.0;
+  }
+
+  rgb[0] = static_cast<unsigned char>(255.0 * red / maxValue + 0.5);
+  rgb[1] = static_cast<unsigned char>(255.0 * green / maxValue + 0.5);
+  rgb[2] = static_cast<unsigned char>(255.0 * blue / maxValue + 0.5);
+}
+
+/**
+ * @brief Colors a unit crystal direction in the m-3m standard triangle [001]-[101]-[111].
+ * Every signed permutation of the components is symmetrically equivalent, so sorting the
+ * absolute values finds the equivalent direction with z >= x >= y >= 0.
+ * @param x
+ * @param y
+ * @param z
+ * @param rgb
+ */
+inline void CubicColor(double x, double y, double z, unsigned char* rgb)
+{
+  double low = std::abs(x);
+  double mid = std::abs(y);
+  double high = std::abs(z);
+  if(low > mid)
+  {
+    std::swap(low, mid);
+  }
+  if(mid > high)
+  {
+    std::swap(mid, high);
+  }
+  if(low > mid)
+  {
+    std::swap(low, mid);
+  }
+
+  double chi = std::acos(std::min(high, 1.0));
+  double eta = std::atan2(low, mid);
+  double tanEta = std::tan(eta);
+  double chiMax = std::acos(std::sqrt(1.0 / (2.0 + tanEta * tanEta)));
+
+  TriangleColor(chi / chiMax, eta / (Pi / 4.0), rgb);
+}
+
+/**
+ * @brief Colors a unit crystal direction in the 6/mmm standard triangle [0001]-[2-1-10]-[10-10]
+ * with the a1 axis along x.
+ * @param x
+ * @param y
+ * @param z
+ * @param rgb
+ */
+inline void HexagonalColor(double x, double y, double z, unsigned char* rgb)
+{
+  const double sector = Pi / 3.0;
+
+  double eta = std::fmod(std::atan2(y, x), sector);
+  if(eta < 0.0)
+  {
+    eta += sector;
+  }
+  if(eta > sector / 2.0)
+  {
+    eta = sector - eta;
+  }
+
+  double chi = std::acos(std::min(std::abs(z), 1.0));
+
+  TriangleColor(chi / (Pi / 2.0), eta / (sector / 2.0), rgb);
+}
+
+/**
+ * @brief Functor for vtkSMPTools that colors a range of tuples
+ */
+template <typename EulerT, typename PhaseT>
+class IPFWorker
+{
+public:
+  const EulerT* m_Eulers = nullptr;
+  const PhaseT* m_Phases = nullptr;
+  const std::vector<unsigned int>* m_Structures = nullptr;
+  VSIPFColorGenerator::Direction m_Direction;
+  unsigned char* m_Colors = nullptr;
+
+  unsigned int structureAt(vtkIdType tuple) const
+  {
+    if(nullptr == m_Phases)
+    {
+      return VSIPFColorGenerator::CubicHigh;
+    }
+
+    long long phase = static_cast<long long>(m_Phases[tuple]);
+    if(phase <= 0)
+    {
+      return VSIPFColorGenerator::UnknownCrystalStructure;
+    }
+    if(m_Structures->empty())
+    {
+      return VSIPFColorGenerator::CubicHigh;
+    }
+    if(phase >= static_cast<long long>(m_Structures->size()))
+    {
+      return VSIPFColorGenerator::UnknownCrystalStructure;
+    }
+    return (*m_Structures)[phase];
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    double x[BlockSize];
+    double y[BlockSize];
+    double z[BlockSize];
+
+    const double d0 = m_Direction[0];
+    const double d1 = m_Direction[1];
+    const double d2 = m_Direction[2];
+
+    for(vtkIdType blockStart = begin; blockStart < end; blockStart += BlockSize)
+    {
+      const vtkIdType count = std::min(BlockSize, end - blockStart);
+      const EulerT* eulers = m_Eulers + 3 * blockStart;
+
+      // Rotate the sample direction into the crystal frame: g * direction
+      for(vtkIdType i = 0; i < count; i++)
+      {
+        const double phi1 = eulers[3 * i];
+        const double phi = eulers[3 * i + 1];
+        const double phi2 = eulers[3 * i + 2];
+        const double c1 = std::cos(phi1);
+        const double s1 = std::sin(phi1);
+        const double c = std::cos(phi);
+        const double s = std::sin(phi);
+        const double c2 = std::cos(phi2);
+        const double s2 = std::sin(phi2);
+
+        x[i] = (c1 * c2 - s1 * s2 * c) * d0 + (s1 * c2 + c1 * s2 * c) * d1 + (s2 * s) * d2;
+        y[i] = (-c1 * s2 - s1 * c2 * c) * d0 + (-s1 * s2 + c1 * c2 * c) * d1 + (c2 * s) * d2;
+        z[i] = (s1 * s) * d0 - (c1 * s) * d1 + c * d2;
+      }
+
+      for(vtkIdType i = 0; i < count; i++)
+      {
+        unsigned char* rgb = m_Colors + 3 * (blockStart + i);
+        switch(structureAt(blockStart + i))
+        {
+        case VSIPFColorGenerator::CubicHigh:
+          CubicColor(x[i], y[i], z[i], rgb);
+          break;
+        case VSIPFColorGenerator::HexagonalHigh:
+          HexagonalColor(x[i], y[i], z[i], rgb);
+          break;
+        default:
+          rgb[0] = rgb[1] = rgb[2] = 0;
+          break;
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Runs the worker over every tuple once the phase type is known
+ */
+template <typename EulerT, typename PhaseT>
+void GenerateColors(const EulerT* eulers, const PhaseT* phases, const std::vector<unsigned int>& structures, const VSIPFColorGenerator::Direction& direction, vtkIdType numTuples,
+                    unsigned char* colors)
+{
+  IPFWorker<EulerT, PhaseT> worker;
+  worker.m_Eulers = eulers;
+  worker.m_Phases = phases;
+  worker.m_Structures = &structures;
+  worker.m_Direction = direction;
+  worker.m_Colors = colors;
+  vtkSMPTools::For(0, numTuples, BlockSize, worker);
+}
+
+/**
+ * @brief Dispatches on the phase array type
+ */
+template <typename EulerT>
+void GenerateColors(const EulerT* eulers, vtkDataArray* phases, const std::vector<unsigned int>& structures, const VSIPFColorGenerator::Direction& direction, vtkIdType numTuples,
+                    unsigned char* colors)
+{
+  if(nullptr == phases)
+  {
+    GenerateColors<EulerT, int>(eulers, nullptr, structures, direction, numTuples, colors);
+    return;
+  }
+
+  switch(phases->GetDataType())
+  {
+    vtkTemplateMacro(GenerateColors(eulers, static_cast<const VTK_TT*>(phases->GetVoidPointer(0)), structures, direction, numTuples, colors));
+  default:
+    break;
+  }
+}
+
+/**
+ * @brief Returns an array whose values can be read through a raw pointer
+ * @param array
+ * @return
+ */
+VTK_PTR(vtkDataArray) StandardLayoutArray(vtkDataArray* array)
+{
+  if(nullptr == array || array->HasStandardMemoryLayout())
+  {
+    return array;
+  }
+
+  VTK_PTR(vtkDataArray) copiedArray;
+  copiedArray.TakeReference(vtkDoubleArray::New());
+  copiedArray->DeepCopy(array);
+  return copiedArray;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSIPFColorGenerator::IsEulerArray(vtkDataArray* array)
+{
+  if(nullptr == array || array->GetNumberOfComponents() != 3)
+  {
+    return false;
+  }
+
+  int dataType = array->GetDataType();
+  return VTK_FLOAT == dataType || VTK_DOUBLE == dataType;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<unsigned int> VSIPFColorGenerator::FindCrystalStructures(const DataContainer::Pointer& dc)
+{
+  std::vector<unsigned int> structures;
+  if(nullptr == dc)
+  {
+    return structures;
+  }
+
+  DataContainer::AttributeMatrixMap_t attrMats = dc->getAttributeMatrices();
+  for(DataContainer::AttributeMatrixMap_t::Iterator attrMat = attrMats.begin(); attrMat != attrMats.end(); ++attrMat)
+  {
+    if(!(*attrMat) || AttributeMatrix::Type::CellEnsemble != (*attrMat)->getType())
+    {
+      continue;
+    }
+
+    UInt32ArrayType::Pointer array = std::dynamic_pointer_cast<UInt32ArrayType>((*attrMat)->getAttributeArray("CrystalStructures"));
+    if(nullptr == array)
+    {
+      continue;
+    }
+
+    size_t numTuples = array->getNumberOfTuples();
+    structures.resize(numTuples);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      structures[i] = array->getValue(i);
+    }
+    break;
+  }
+
+  return structures;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSIPFColorGenerator::ArrayName(const Direction& direction)
+{
+  return QString("IPF Colors [%1 %2 %3]").arg(direction[0]).arg(direction[1]).arg(direction[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIPFColorGenerator::setEulerAngles(vtkDataArray* eulers)
+{
+  m_EulerAngles = eulers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIPFColorGenerator::setPhases(vtkDataArray* phases)
+{
+  m_Phases = phases;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIPFColorGenerator::setCrystalStructures(const std::vector<unsigned int>& structures)
+{
+  m_CrystalStructures = structures;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkUnsignedCharArray) VSIPFColorGenerator::generate(const Direction& direction) const
+{
+  if(false == IsEulerArray(m_EulerAngles))
+  {
+    return nullptr;
+  }
+
+  double length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] + direction[2] * direction[2]);
+  if(length <= 0.0)
+  {
+    return nullptr;
+  }
+  Direction unitDirection = {{direction[0] / length, direction[1] / length, direction[2] / length}};
+
+  vtkIdType numTuples = m_EulerAngles->GetNumberOfTuples();
+  VTK_PTR(vtkDataArray) phases = nullptr;
+  if(m_Phases && m_Phases->GetNumberOfComponents() == 1 && m_Phases->GetNumberOfTuples() == numTuples)
+  {
+    phases = StandardLayoutArray(m_Phases);
+  }
+  VTK_PTR(vtkDataArray) eulers = StandardLayoutArray(m_EulerAngles);
+
+  VTK_PTR(vtkUnsignedCharArray) colors = VTK_PTR(vtkUnsignedCharArray)::New();
+  colors->SetName(qPrintable(ArrayName(direction)));
+  colors->SetNumberOfComponents(3);
+  colors->SetNumberOfTuples(numTuples);
+  unsigned char* colorPtr = colors->GetPointer(0);
+
+  switch(eulers->GetDataType())
+  {
+  case VTK_FLOAT:
+    GenerateColors(static_cast<const float*>(eulers->GetVoidPointer(0)), phases, m_CrystalStructures, unitDirection, numTuples, colorPtr);
+    break;
+  default:
+    GenerateColors(static_cast<const double*>(eulers->GetVoidPointer(0)), phases, m_CrystalStructures, unitDirection, numTuples, colorPtr);
+    break;
+  }
+
+  return colors;
+}
@@ -0,0 +1,135 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <vtkDataArray.h>
+#include <vtkUnsignedCharArray.h>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSIPFColorGenerator VSIPFColorGenerator.h SIMPLVtkLib/SIMPLBridge/VSIPFColorGenerator.h
+ * @brief This class computes inverse pole figure colors from Bunge Euler angles stored
+ * in radians.  The reference direction is rotated into the crystal frame of every tuple,
+ * reduced to the standard stereographic triangle of the phase's Laue class, and mapped
+ * to RGB the same way DREAM3D's orientation filters do.  Tuples are processed in blocks
+ * so the rotation is a plain loop over contiguous values the compiler can vectorize, and
+ * blocks are processed in parallel.
+ *
+ * Only the cubic m-3m and hexagonal 6/mmm Laue classes are colored.  Tuples in phase 0,
+ * in an unknown phase, or in a phase with any other crystal structure are black.  When no
+ * phase array is given every tuple is treated as cubic.
+ */
+class SIMPLVtkLib_EXPORT VSIPFColorGenerator
+{
+public:
+  using Direction = std::array<double, 3>;
+
+  /**
+   * @brief Crystal structure values used by SIMPL's CrystalStructures ensemble array
+   */
+  enum CrystalStructure : unsigned int
+  {
+    HexagonalHigh = 0,
+    CubicHigh = 1,
+    UnknownCrystalStructure = 999
+  };
+
+  VSIPFColorGenerator() = default;
+  virtual ~VSIPFColorGenerator() = default;
+
+  /**
+   * @brief Returns true if the array can be used as Euler angles
+   * @param array
+   * @return
+   */
+  static bool IsEulerArray(vtkDataArray* array);
+
+  /**
+   * @brief Returns the crystal structure of each phase from the DataContainer's ensemble
+   * CrystalStructures array.  An empty vector is returned if none could be found.
+   * @param dc
+   * @return
+   */
+  static std::vector<unsigned int> FindCrystalStructures(const DataContainer::Pointer& dc);
+
+  /**
+   * @brief Returns the name used for the color array generated for the given direction
+   * @param direction
+   * @return
+   */
+  static QString ArrayName(const Direction& direction);
+
+  /**
+   * @brief Sets the 3-component Euler angle array
+   * @param eulers
+   */
+  void setEulerAngles(vtkDataArray* eulers);
+
+  /**
+   * @brief Sets the single component phase array.  Phases are optional.
+   * @param phases
+   */
+  void setPhases(vtkDataArray* phases);
+
+  /**
+   * @brief Sets the crystal structure of each phase.  Phase 0 is not a crystal but
+   * keeps its index in the vector.
+   * @param structures
+   */
+  void setCrystalStructures(const std::vector<unsigned int>& structures);
+
+  /**
+   * @brief Generates the color array for the sample reference direction.  Returns nullptr
+   * if the Euler angles are not set or the direction has no length.
+   * @param direction
+   * @return
+   */
+  VTK_PTR(vtkUnsignedCharArray) generate(const Direction& direction) const;
+
+private:
+  VTK_PTR(vtkDataArray) m_EulerAngles = nullptr;
+  VTK_PTR(vtkDataArray) m_Phases = nullptr;
+  std::vector<unsigned int> m_CrystalStructures;
+};
@@ -0,0 +1,219 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageContourFilter.h"
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkFlyingEdges3D.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageContourFilter* VSImageContourFilter::New()
+{
+  return new VSImageContourFilter();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageContourFilter::VSImageContourFilter()
+: vtkPolyDataAlgorithm()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageContourFilter::~VSImageContourFilter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageContourFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Values: " << m_Values.size() << endl;
+  os << indent << "Compute Normals: " << m_ComputeNormals << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageContourFilter::SetValues(const std::vector<double>& values)
+{
+  if(values != m_Values)
+  {
+    m_Values = values;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<double> VSImageContourFilter::GetValues() const
+{
+  return m_Values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageContourFilter::SetComputeNormals(bool computeNormals)
+{
+  if(computeNormals != m_ComputeNormals)
+  {
+    m_ComputeNormals = computeNormals;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageContourFilter::GetComputeNormals() const
+{
+  return m_ComputeNormals;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageContourFilter::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSImageContourFilter::CreateContourLattice(vtkImageData* image, vtkDataArray* array, int association)
+{
+  if(nullptr == image || nullptr == array || array->GetNumberOfComponents() != 1)
+  {
+    return nullptr;
+  }
+
+  VTK_PTR(vtkImageData) lattice = VTK_PTR(vtkImageData)::New();
+  if(vtkDataObject::FIELD_ASSOCIATION_POINTS == association)
+  {
+    lattice->CopyStructure(image);
+  }
+  else
+  {
+    // Cell centers are offset half a voxel from the first image point
+    int extent[6];
+    double origin[3];
+    double spacing[3];
+    image->GetExtent(extent);
+    image->GetOrigin(origin);
+    image->GetSpacing(spacing);
+
+    int dims[3];
+    for(int i = 0; i < 3; i++)
+    {
+      dims[i] = extent[2 * i + 1] - extent[2 * i];
+      origin[i] += (extent[2 * i] + 0.5) * spacing[i];
+    }
+
+    lattice->SetDimensions(dims);
+    lattice->SetOrigin(origin);
+    lattice->SetSpacing(spacing);
+  }
+
+  if(lattice->GetNumberOfPoints() != array->GetNumberOfTuples())
+  {
+    return nullptr;
+  }
+
+  lattice->GetPointData()->SetScalars(array);
+  return lattice;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageContourFilter::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0], 0);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  int association = vtkDataObject::FIELD_ASSOCIATION_CELLS;
+  vtkDataArray* array = GetInputArrayToProcess(0, inputVector, association);
+  if(m_Values.empty() || nullptr == array)
+  {
+    return 1;
+  }
+
+  VTK_PTR(vtkImageData) lattice = CreateContourLattice(input, array, association);
+  if(nullptr == lattice)
+  {
+    vtkErrorMacro(<< "A single component image array is required to generate isosurfaces");
+    return 0;
+  }
+
+  // Flying edges requires a volume
+  int* dims = lattice->GetDimensions();
+  if(dims[0] < 2 || dims[1] < 2 || dims[2] < 2)
+  {
+    return 1;
+  }
+
+  VTK_NEW(vtkFlyingEdges3D, flyingEdges);
+  flyingEdges->SetInputData(lattice);
+  flyingEdges->SetNumberOfContours(static_cast<int>(m_Values.size()));
+  for(size_t i = 0; i < m_Values.size(); i++)
+  {
+    flyingEdges->SetValue(static_cast<int>(i), m_Values[i]);
+  }
+  flyingEdges->SetComputeNormals(m_ComputeNormals);
+  flyingEdges->SetComputeScalars(true);
+  flyingEdges->Update();
+
+  output->ShallowCopy(flyingEdges->GetOutput());
+  return 1;
+}
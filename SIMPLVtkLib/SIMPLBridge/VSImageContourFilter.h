@@ -0,0 +1,126 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vector>
+
+#include <vtkPolyDataAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkDataArray;
+class vtkImageData;
+
+/**
+ * @class VSImageContourFilter VSImageContourFilter.h SIMPLVtkLib/SIMPLBridge/VSImageContourFilter.h
+ * @brief This class generates isosurfaces of a single component vtkImageData array for any
+ * number of iso-values at once.  The array is selected through SetInputArrayToProcess.
+ * Contours are generated with vtkFlyingEdges3D, which processes the volume in parallel
+ * edge rows.  Cell arrays are contoured on the lattice of cell centers.  That lattice
+ * shares the cell array as its point scalars, so values are interpolated between cell
+ * centers as edges are crossed instead of being copied to the image points first.
+ */
+class SIMPLVtkLib_EXPORT VSImageContourFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static VSImageContourFilter* New();
+  vtkTypeMacro(VSImageContourFilter, vtkPolyDataAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets the iso-values to generate surfaces for
+   * @param values
+   */
+  void SetValues(const std::vector<double>& values);
+
+  /**
+   * @brief Returns the iso-values to generate surfaces for
+   * @return
+   */
+  std::vector<double> GetValues() const;
+
+  /**
+   * @brief Sets whether point normals are generated for the surfaces
+   * @param computeNormals
+   */
+  void SetComputeNormals(bool computeNormals);
+
+  /**
+   * @brief Returns true if point normals are generated for the surfaces
+   * @return
+   */
+  bool GetComputeNormals() const;
+
+  /**
+   * @brief Returns the image whose point scalars are contoured for the given array.
+   * Point arrays use the image structure directly while cell arrays use the lattice
+   * of cell centers.  Returns nullptr if the array cannot be contoured.
+   * @param image
+   * @param array
+   * @param association
+   * @return
+   */
+  static VTK_PTR(vtkImageData) CreateContourLattice(vtkImageData* image, vtkDataArray* array, int association);
+
+protected:
+  VSImageContourFilter();
+  ~VSImageContourFilter() override;
+
+  /**
+   * @brief Only accepts vtkImageData inputs
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Creates the isosurfaces for the input
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+private:
+  std::vector<double> m_Values;
+  bool m_ComputeNormals = true;
+
+  VSImageContourFilter(const VSImageContourFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSImageContourFilter&) = delete;       // Operator '=' Not Implemented
+};
@@ -0,0 +1,358 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageExtentFilter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include <vtkCellData.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkPointData.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSExtentDataArray.hpp"
+#include "SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp"
+
+namespace
+{
+/**
+ * @brief Adds arrays viewing the source attributes through the given map to the target.
+ * Index arrays used by VSIndexedDataArrays are gathered once and shared by every array
+ * indexed through them.
+ * @param source
+ * @param target
+ * @param map
+ * @param numSourceTuples
+ */
+void AddExtentArrays(vtkDataSetAttributes* source, vtkDataSetAttributes* target, VSExtentMap::Pointer map, vtkIdType numSourceTuples)
+{
+  const int numArrays = source->GetNumberOfArrays();
+
+  std::map<vtkDataArray*, VTK_PTR(vtkDataArray)> gatheredIndices;
+  for(int i = 0; i < numArrays; i++)
+  {
+    VSIndexedArray* indexedArray = dynamic_cast<VSIndexedArray*>(source->GetArray(i));
+    if(indexedArray && indexedArray->GetIndices()->GetNumberOfTuples() == numSourceTuples && 0 == gatheredIndices.count(indexedArray->GetIndices()))
+    {
+      gatheredIndices[indexedArray->GetIndices()] = VSExtentDataArrays::Gather(indexedArray->GetIndices(), map);
+    }
+  }
+
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkDataArray* array = source->GetArray(i);
+    if(nullptr == array)
+    {
+      continue;
+    }
+
+    VTK_PTR(vtkDataArray) targetArray = nullptr;
+    VSIndexedArray* indexedArray = dynamic_cast<VSIndexedArray*>(array);
+    if(gatheredIndices.count(array) > 0)
+    {
+      targetArray = gatheredIndices[array];
+    }
+    else if(indexedArray && gatheredIndices.count(indexedArray->GetIndices()) > 0)
+    {
+      targetArray = VSIndexedDataArrays::Create(indexedArray->GetSource(), gatheredIndices[indexedArray->GetIndices()]);
+      if(targetArray)
+      {
+        targetArray->SetName(array->GetName());
+      }
+    }
+    else if(nullptr == array->GetName() || 0 != std::strcmp(array->GetName(), vtkDataSetAttributes::GhostArrayName()))
+    {
+      targetArray = VSExtentDataArrays::Create(array, map);
+    }
+
+    if(nullptr == targetArray)
+    {
+      targetArray = VSExtentDataArrays::Gather(array, map);
+    }
+
+    target->AddArray(targetArray);
+  }
+
+  for(int attributeType = 0; attributeType < vtkDataSetAttributes::NUM_ATTRIBUTES; attributeType++)
+  {
+    vtkAbstractArray* attribute = source->GetAbstractAttribute(attributeType);
+    if(attribute && attribute->GetName())
+    {
+      target->SetActiveAttribute(attribute->GetName(), attributeType);
+    }
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageExtentFilter* VSImageExtentFilter::New()
+{
+  return new VSImageExtentFilter();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageExtentFilter::VSImageExtentFilter()
+: vtkImageAlgorithm()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageExtentFilter::~VSImageExtentFilter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageExtentFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "VOI: (" << m_VOI[0] << ", " << m_VOI[1] << ", " << m_VOI[2] << ", " << m_VOI[3] << ", " << m_VOI[4] << ", " << m_VOI[5] << ")" << endl;
+  os << indent << "Sample Rate: (" << m_SampleRate[0] << ", " << m_SampleRate[1] << ", " << m_SampleRate[2] << ")" << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageExtentFilter::SetVOI(const int voi[6])
+{
+  if(std::equal(voi, voi + 6, m_VOI))
+  {
+    return;
+  }
+
+  std::copy(voi, voi + 6, m_VOI);
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageExtentFilter::GetVOI(int voi[6]) const
+{
+  std::copy(m_VOI, m_VOI + 6, voi);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageExtentFilter::SetSampleRate(const int sampleRate[3])
+{
+  int rate[3];
+  for(int i = 0; i < 3; i++)
+  {
+    rate[i] = std::max(sampleRate[i], 1);
+  }
+
+  if(std::equal(rate, rate + 3, m_SampleRate))
+  {
+    return;
+  }
+
+  std::copy(rate, rate + 3, m_SampleRate);
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageExtentFilter::GetSampleRate(int sampleRate[3]) const
+{
+  std::copy(m_SampleRate, m_SampleRate + 3, sampleRate);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageExtentFilter::computeOutputInformation(const int inputExtent[6], const double inputOrigin[3], const double inputSpacing[3], int outputExtent[6], double outputOrigin[3],
+                                                   double outputSpacing[3]) const
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    outputOrigin[axis] = inputOrigin[axis];
+    outputSpacing[axis] = inputSpacing[axis];
+    if(inputExtent[2 * axis] > inputExtent[2 * axis + 1])
+    {
+      outputExtent[2 * axis] = inputExtent[2 * axis];
+      outputExtent[2 * axis + 1] = inputExtent[2 * axis + 1];
+      continue;
+    }
+
+    const int lower = std::min(std::max(m_VOI[2 * axis], inputExtent[2 * axis]), inputExtent[2 * axis + 1]);
+    const int upper = std::min(std::max(m_VOI[2 * axis + 1], lower), inputExtent[2 * axis + 1]);
+    const int rate = m_SampleRate[axis];
+
+    // The upper boundary is always included even when the sample rate skips past it
+    const int numSamples = (upper - lower) / rate + 1 + (((upper - lower) % rate) ? 1 : 0);
+    outputExtent[2 * axis] = lower;
+    outputExtent[2 * axis + 1] = lower + numSamples - 1;
+
+    // Sampled points keep their position with the extent starting at the lower bound
+    outputSpacing[axis] = inputSpacing[axis] * rate;
+    outputOrigin[axis] = inputOrigin[axis] + lower * inputSpacing[axis] * (1 - rate);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageExtentFilter::coversInput(const int inputExtent[6]) const
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    if(m_SampleRate[axis] != 1 || m_VOI[2 * axis] > inputExtent[2 * axis] || m_VOI[2 * axis + 1] < inputExtent[2 * axis + 1])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageExtentFilter::RequestInformation(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  int inputExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), inputExtent);
+
+  double inputOrigin[3] = {0.0, 0.0, 0.0};
+  double inputSpacing[3] = {1.0, 1.0, 1.0};
+  if(inInfo->Has(vtkDataObject::ORIGIN()))
+  {
+    inInfo->Get(vtkDataObject::ORIGIN(), inputOrigin);
+  }
+  if(inInfo->Has(vtkDataObject::SPACING()))
+  {
+    inInfo->Get(vtkDataObject::SPACING(), inputSpacing);
+  }
+
+  int outputExtent[6];
+  double outputOrigin[3];
+  double outputSpacing[3];
+  computeOutputInformation(inputExtent, inputOrigin, inputSpacing, outputExtent, outputOrigin, outputSpacing);
+
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), outputExtent, 6);
+  outInfo->Set(vtkDataObject::ORIGIN(), outputOrigin, 3);
+  outInfo->Set(vtkDataObject::SPACING(), outputSpacing, 3);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageExtentFilter::RequestUpdateExtent(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT()), 6);
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageExtentFilter::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0], 0);
+  vtkImageData* output = vtkImageData::GetData(outputVector, 0);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  int inputExtent[6];
+  input->GetExtent(inputExtent);
+  if(inputExtent[0] > inputExtent[1] || inputExtent[2] > inputExtent[3] || inputExtent[4] > inputExtent[5] || coversInput(inputExtent))
+  {
+    output->ShallowCopy(input);
+    return 1;
+  }
+
+  int outputExtent[6];
+  double outputOrigin[3];
+  double outputSpacing[3];
+  computeOutputInformation(inputExtent, input->GetOrigin(), input->GetSpacing(), outputExtent, outputOrigin, outputSpacing);
+
+  output->Initialize();
+  output->SetExtent(outputExtent);
+  output->SetOrigin(outputOrigin);
+  output->SetSpacing(outputSpacing);
+  output->GetFieldData()->PassData(input->GetFieldData());
+
+  // Cells along each axis start at the first sampled point and end before the last one.
+  // Flat axes keep the single cell layer they are part of.
+  int pointDims[3];
+  int pointFirst[3];
+  int pointLast[3];
+  int outputPointDims[3];
+  int cellDims[3];
+  int cellFirst[3];
+  int cellLast[3];
+  int outputCellDims[3];
+  for(int axis = 0; axis < 3; axis++)
+  {
+    const int upper = std::min(std::max(m_VOI[2 * axis + 1], outputExtent[2 * axis]), inputExtent[2 * axis + 1]);
+
+    pointDims[axis] = inputExtent[2 * axis + 1] - inputExtent[2 * axis] + 1;
+    pointFirst[axis] = outputExtent[2 * axis] - inputExtent[2 * axis];
+    pointLast[axis] = upper - inputExtent[2 * axis];
+    outputPointDims[axis] = outputExtent[2 * axis + 1] - outputExtent[2 * axis] + 1;
+
+    cellDims[axis] = std::max(pointDims[axis] - 1, 1);
+    cellFirst[axis] = std::min(pointFirst[axis], cellDims[axis] - 1);
+    cellLast[axis] = std::max(cellFirst[axis], std::min(pointLast[axis] - 1, cellDims[axis] - 1));
+    outputCellDims[axis] = std::max(outputPointDims[axis] - 1, 1);
+  }
+
+  VSExtentMap::Pointer pointMap = VSExtentMap::Create(pointDims, pointFirst, pointLast, outputPointDims, m_SampleRate);
+  VSExtentMap::Pointer cellMap = VSExtentMap::Create(cellDims, cellFirst, cellLast, outputCellDims, m_SampleRate);
+  AddExtentArrays(input->GetPointData(), output->GetPointData(), pointMap, input->GetNumberOfPoints());
+  AddExtentArrays(input->GetCellData(), output->GetCellData(), cellMap, input->GetNumberOfCells());
+
+  return 1;
+}
@@ -0,0 +1,141 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkImageAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkDataSetAttributes;
+
+/**
+ * @class VSImageExtentFilter VSImageExtentFilter.h SIMPLVtkLib/SIMPLBridge/VSImageExtentFilter.h
+ * @brief This class extracts a volume of interest from a vtkImageData with an optional
+ * sample rate along each axis.  The output matches vtkExtractVOI with IncludeBoundary on,
+ * but its point and cell arrays are VSExtentDataArrays viewing the input arrays instead of
+ * copies.  Cropping without sampling is contiguous in memory whenever the volume of interest
+ * spans whole rows or planes of the input, otherwise views only gather values in parallel
+ * when a consumer requests a contiguous buffer.  Ghost arrays and arrays indexed through
+ * FeatureIds or Phases are gathered up front so blanking and feature coloring keep working.
+ */
+class SIMPLVtkLib_EXPORT VSImageExtentFilter : public vtkImageAlgorithm
+{
+public:
+  static VSImageExtentFilter* New();
+  vtkTypeMacro(VSImageExtentFilter, vtkImageAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets the volume of interest in the input's index space
+   * @param voi
+   */
+  void SetVOI(const int voi[6]);
+
+  /**
+   * @brief Returns the volume of interest
+   * @param voi
+   */
+  void GetVOI(int voi[6]) const;
+
+  /**
+   * @brief Sets the sample rate along each axis.  Rates below 1 are treated as 1.
+   * @param sampleRate
+   */
+  void SetSampleRate(const int sampleRate[3]);
+
+  /**
+   * @brief Returns the sample rate along each axis
+   * @param sampleRate
+   */
+  void GetSampleRate(int sampleRate[3]) const;
+
+protected:
+  VSImageExtentFilter();
+  ~VSImageExtentFilter() override;
+
+  /**
+   * @brief Sets the output's whole extent, origin, and spacing
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Requests the input's whole extent so views can index into it
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestUpdateExtent(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Creates the output image viewing the input's arrays
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Calculates the output extent, origin, and spacing for the given input values
+   * @param inputExtent
+   * @param inputOrigin
+   * @param inputSpacing
+   * @param outputExtent
+   * @param outputOrigin
+   * @param outputSpacing
+   */
+  void computeOutputInformation(const int inputExtent[6], const double inputOrigin[3], const double inputSpacing[3], int outputExtent[6], double outputOrigin[3], double outputSpacing[3]) const;
+
+  /**
+   * @brief Returns true if the volume of interest covers the whole input without sampling
+   * @param inputExtent
+   * @return
+   */
+  bool coversInput(const int inputExtent[6]) const;
+
+private:
+  int m_VOI[6] = {0, VTK_INT_MAX, 0, VTK_INT_MAX, 0, VTK_INT_MAX};
+  int m_SampleRate[3] = {1, 1, 1};
+
+  VSImageExtentFilter(const VSImageExtentFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSImageExtentFilter&) = delete;      // Operator '=' Not Implemented
+};
@@ -0,0 +1,199 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#include "VSImagePointMarker.h"
+
+#include <algorithm>
+#include <bitset>
+
+#include <vtkSMPTools.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImagePointMarker::VSImagePointMarker(vtkIdType rowLength, vtkIdType numRows)
+: m_RowLength(rowLength)
+, m_WordsPerRow((rowLength + WordBits - 1) / WordBits)
+, m_NumRows(numRows)
+, m_Words(m_WordsPerRow * numRows)
+, m_WordIds(m_WordsPerRow * numRows, 0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSImagePointMarker::getRowLength() const
+{
+  return m_RowLength;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSImagePointMarker::getNumberOfRows() const
+{
+  return m_NumRows;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSImagePointMarker::CountBits(Word word)
+{
+  return static_cast<vtkIdType>(std::bitset<WordBits>(word).count());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSImagePointMarker::numberPoints()
+{
+  std::vector<vtkIdType> rowOffsets(m_NumRows + 1, 0);
+  vtkIdType* offsetPtr = rowOffsets.data();
+  vtkSMPTools::For(0, m_NumRows, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType r = begin; r < end; r++)
+    {
+      vtkIdType count = 0;
+      for(vtkIdType w = r * m_WordsPerRow; w < (r + 1) * m_WordsPerRow; w++)
+      {
+        count += CountBits(m_Words[w].load(std::memory_order_relaxed));
+      }
+      offsetPtr[r + 1] = count;
+    }
+  });
+
+  for(vtkIdType r = 0; r < m_NumRows; r++)
+  {
+    rowOffsets[r + 1] += rowOffsets[r];
+  }
+
+  vtkSMPTools::For(0, m_NumRows, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType r = begin; r < end; r++)
+    {
+      vtkIdType pointId = offsetPtr[r];
+      for(vtkIdType w = r * m_WordsPerRow; w < (r + 1) * m_WordsPerRow; w++)
+      {
+        m_WordIds[w] = pointId;
+        pointId += CountBits(m_Words[w].load(std::memory_order_relaxed));
+      }
+    }
+  });
+
+  return rowOffsets[m_NumRows];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSImagePointMarker::firstPointId(vtkIdType row) const
+{
+  return m_WordIds[row * m_WordsPerRow];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkFloatArray) VSImagePointMarker::createPoints(vtkImageData* image, vtkIdType numPoints) const
+{
+  int extent[6];
+  double origin[3];
+  double spacing[3];
+  image->GetExtent(extent);
+  image->GetOrigin(origin);
+  image->GetSpacing(spacing);
+
+  const vtkIdType rowLength = m_RowLength;
+  const vtkIdType rowsPerPlane = std::max(extent[3] - extent[2], 0) + 1;
+
+  VTK_NEW(vtkFloatArray, coords);
+  coords->SetNumberOfComponents(3);
+  coords->SetNumberOfTuples(numPoints);
+  float* coordPtr = coords->GetPointer(0);
+
+  const int* extentPtr = extent;
+  const double* originPtr = origin;
+  const double* spacingPtr = spacing;
+  vtkSMPTools::For(0, m_NumRows, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType r = begin; r < end; r++)
+    {
+      const vtkIdType pointIndex[2] = {r % rowsPerPlane, r / rowsPerPlane};
+      vtkIdType pointId = firstPointId(r);
+      for(vtkIdType i = 0; i < rowLength; i++)
+      {
+        if(false == isMarked(r, i))
+        {
+          continue;
+        }
+
+        float* coord = coordPtr + pointId * 3;
+        coord[0] = static_cast<float>(originPtr[0] + (extentPtr[0] + i) * spacingPtr[0]);
+        coord[1] = static_cast<float>(originPtr[1] + (extentPtr[2] + pointIndex[0]) * spacingPtr[1]);
+        coord[2] = static_cast<float>(originPtr[2] + (extentPtr[4] + pointIndex[1]) * spacingPtr[2]);
+        pointId++;
+      }
+    }
+  });
+
+  return coords;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkIdTypeArray) VSImagePointMarker::createImagePointIds(vtkIdType numPoints) const
+{
+  VTK_NEW(vtkIdTypeArray, imagePointIds);
+  imagePointIds->SetNumberOfValues(numPoints);
+  vtkIdType* idPtr = imagePointIds->GetPointer(0);
+
+  const vtkIdType rowLength = m_RowLength;
+  vtkSMPTools::For(0, m_NumRows, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType r = begin; r < end; r++)
+    {
+      vtkIdType pointId = firstPointId(r);
+      for(vtkIdType i = 0; i < rowLength; i++)
+      {
+        if(isMarked(r, i))
+        {
+          idPtr[pointId++] = r * rowLength + i;
+        }
+      }
+    }
+  });
+
+  return imagePointIds;
+}
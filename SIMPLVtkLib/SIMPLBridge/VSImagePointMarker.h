@@ -0,0 +1,161 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkImageData.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImagePointMarker VSImagePointMarker.h SIMPLVtkLib/SIMPLBridge/VSImagePointMarker.h
+ * @brief This class marks the points of an image with one bit each and numbers the marked
+ * points in order so surfaces extracted from the image can share their corner points.  Every
+ * row of points starts on a new word so rows can be counted and numbered in parallel without
+ * sharing words.  A marked point's new ID is the ID of the first marked point in its word
+ * plus the number of marked points below it in the word.
+ */
+class SIMPLVtkLib_EXPORT VSImagePointMarker
+{
+public:
+  using Word = vtkTypeUInt64;
+  static const vtkIdType WordBits = 64;
+
+  /**
+   * @brief Constructor
+   * @param rowLength Number of points along the image's x axis
+   * @param numRows Number of rows of points through every plane of the image
+   */
+  VSImagePointMarker(vtkIdType rowLength, vtkIdType numRows);
+
+  virtual ~VSImagePointMarker() = default;
+
+  /**
+   * @brief Returns the number of points in each row
+   * @return
+   */
+  vtkIdType getRowLength() const;
+
+  /**
+   * @brief Returns the number of rows
+   * @return
+   */
+  vtkIdType getNumberOfRows() const;
+
+  /**
+   * @brief Marks an image point.  Neighboring faces may mark points in the same word from
+   * different threads, so the bit is set atomically.
+   * @param imagePointId
+   */
+  void mark(vtkIdType imagePointId)
+  {
+    const vtkIdType i = imagePointId % m_RowLength;
+    m_Words[wordIndex(imagePointId / m_RowLength, i)].fetch_or(Word(1) << (i % WordBits), std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Returns true if the point at the given index of the row is marked
+   * @param row
+   * @param i
+   * @return
+   */
+  bool isMarked(vtkIdType row, vtkIdType i) const
+  {
+    return 0 != (m_Words[wordIndex(row, i)].load(std::memory_order_relaxed) & (Word(1) << (i % WordBits)));
+  }
+
+  /**
+   * @brief Counts the marked points of each row and offsets them by the rows before them
+   * @return The number of marked points
+   */
+  vtkIdType numberPoints();
+
+  /**
+   * @brief Returns the new ID of a marked image point.  Only valid after numberPoints().
+   * @param imagePointId
+   * @return
+   */
+  vtkIdType pointId(vtkIdType imagePointId) const
+  {
+    const vtkIdType i = imagePointId % m_RowLength;
+    const vtkIdType word = wordIndex(imagePointId / m_RowLength, i);
+    const Word below = m_Words[word].load(std::memory_order_relaxed) & ((Word(1) << (i % WordBits)) - 1);
+    return m_WordIds[word] + CountBits(below);
+  }
+
+  /**
+   * @brief Returns the new ID of the first marked point in a row.  Only valid after numberPoints().
+   * @param row
+   * @return
+   */
+  vtkIdType firstPointId(vtkIdType row) const;
+
+  /**
+   * @brief Generates the coordinates of the numbered points.  Each row of points is written
+   * by one thread starting from the ID of its first marked point.  Only valid after numberPoints().
+   * @param image
+   * @param numPoints
+   * @return
+   */
+  VTK_PTR(vtkFloatArray) createPoints(vtkImageData* image, vtkIdType numPoints) const;
+
+  /**
+   * @brief Generates the image point ID of each numbered point.  Only valid after numberPoints().
+   * @param numPoints
+   * @return
+   */
+  VTK_PTR(vtkIdTypeArray) createImagePointIds(vtkIdType numPoints) const;
+
+private:
+  static vtkIdType CountBits(Word word);
+
+  vtkIdType wordIndex(vtkIdType row, vtkIdType i) const
+  {
+    return row * m_WordsPerRow + i / WordBits;
+  }
+
+  vtkIdType m_RowLength;
+  vtkIdType m_WordsPerRow;
+  vtkIdType m_NumRows;
+  std::vector<std::atomic<Word>> m_Words;
+  std::vector<vtkIdType> m_WordIds;
+};
@@ -0,0 +1,452 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageSurfaceFilter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <vtkCellData.h>
+#include <vtkDataSetAttributes.h>
+#include <vtkDataSetSurfaceFilter.h>
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkVersion.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSImagePointMarker.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp"
+
+namespace
+{
+// The two in-plane axes for faces normal to each axis.  The order keeps (axis, u, v) right-handed.
+const int FaceAxes[3][2] = {{1, 2}, {2, 0}, {0, 1}};
+
+struct FaceRow
+{
+  int m_Axis;
+  vtkIdType m_Plane;
+  vtkIdType m_Row;
+};
+
+/**
+ * @brief Adds arrays looking up the source attributes through the given indices to the target
+ * @param source
+ * @param target
+ * @param indices
+ */
+void AddIndexedArrays(vtkDataSetAttributes* source, vtkDataSetAttributes* target, vtkIdTypeArray* indices)
+{
+  const vtkIdType numTuples = indices->GetNumberOfTuples();
+  const int numArrays = source->GetNumberOfArrays();
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkDataArray* array = source->GetArray(i);
+    if(nullptr == array || (array->GetName() && 0 == std::strcmp(array->GetName(), vtkDataSetAttributes::GhostArrayName())))
+    {
+      continue;
+    }
+
+    VTK_PTR(vtkDataArray) indexedArray = VSIndexedDataArrays::Create(array, indices);
+    if(nullptr == indexedArray)
+    {
+      // Arrays without contiguous storage are copied instead
+      indexedArray.TakeReference(array->NewInstance());
+      indexedArray->SetName(array->GetName());
+      indexedArray->SetNumberOfComponents(array->GetNumberOfComponents());
+      indexedArray->SetNumberOfTuples(numTuples);
+      for(vtkIdType tuple = 0; tuple < numTuples; tuple++)
+      {
+        indexedArray->SetTuple(tuple, indices->GetValue(tuple), array);
+      }
+    }
+
+    target->AddArray(indexedArray);
+  }
+
+  if(source->GetScalars() && source->GetScalars()->GetName())
+  {
+    target->SetActiveScalars(source->GetScalars()->GetName());
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSurfaceFilter* VSImageSurfaceFilter::New()
+{
+  return new VSImageSurfaceFilter();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSurfaceFilter::VSImageSurfaceFilter()
+: vtkPolyDataAlgorithm()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSurfaceFilter::~VSImageSurfaceFilter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSurfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Faces: " << GetNumberOfFaces() << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSImageSurfaceFilter::GetNumberOfFaces() const
+{
+  if(nullptr == m_FaceCellIds)
+  {
+    return 0;
+  }
+
+  return m_FaceCellIds->GetNumberOfTuples();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSurfaceFilter::ClearCache()
+{
+  m_CachedExtent[1] = -1;
+  m_CachedGhosts = nullptr;
+  m_CachedGhostTime = 0;
+  m_Points = nullptr;
+  m_Polys = nullptr;
+  m_FaceCellIds = nullptr;
+  m_FacePointIds = nullptr;
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSurfaceFilter::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSImageSurfaceFilter::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0], 0);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  int extent[6];
+  input->GetExtent(extent);
+  if(extent[1] <= extent[0] || extent[3] <= extent[2] || extent[5] <= extent[4])
+  {
+    VTK_NEW(vtkDataSetSurfaceFilter, surfaceFilter);
+    surfaceFilter->SetInputData(input);
+    surfaceFilter->Update();
+    output->ShallowCopy(surfaceFilter->GetOutput());
+    return 1;
+  }
+
+  if(false == isCacheValid(input))
+  {
+    updateFaces(input);
+  }
+
+  output->SetPoints(m_Points);
+  output->SetPolys(m_Polys);
+
+  AddIndexedArrays(input->GetCellData(), output->GetCellData(), m_FaceCellIds);
+  output->GetCellData()->AddArray(m_FaceCellIds);
+  if(input->GetPointData()->GetNumberOfArrays() > 0)
+  {
+    AddIndexedArrays(input->GetPointData(), output->GetPointData(), m_FacePointIds);
+  }
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageSurfaceFilter::isCacheValid(vtkImageData* image) const
+{
+  if(nullptr == m_Polys)
+  {
+    return false;
+  }
+
+  int extent[6];
+  image->GetExtent(extent);
+  double* origin = image->GetOrigin();
+  double* spacing = image->GetSpacing();
+  for(int i = 0; i < 3; i++)
+  {
+    if(extent[2 * i] != m_CachedExtent[2 * i] || extent[2 * i + 1] != m_CachedExtent[2 * i + 1])
+    {
+      return false;
+    }
+    if(origin[i] != m_CachedOrigin[i] || spacing[i] != m_CachedSpacing[i])
+    {
+      return false;
+    }
+  }
+
+  vtkDataArray* ghosts = image->GetCellGhostArray();
+  if(ghosts != m_CachedGhosts)
+  {
+    return false;
+  }
+
+  return nullptr == ghosts || ghosts->GetMTime() == m_CachedGhostTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSurfaceFilter::updateFaces(vtkImageData* image)
+{
+  int extent[6];
+  image->GetExtent(extent);
+  double origin[3];
+  double spacing[3];
+  image->GetOrigin(origin);
+  image->GetSpacing(spacing);
+
+  const vtkIdType cellDims[3] = {extent[1] - extent[0], extent[3] - extent[2], extent[5] - extent[4]};
+  const vtkIdType pointDims[3] = {cellDims[0] + 1, cellDims[1] + 1, cellDims[2] + 1};
+
+  vtkUnsignedCharArray* ghosts = image->GetCellGhostArray();
+  const unsigned char* ghostPtr = ghosts ? ghosts->GetPointer(0) : nullptr;
+  bool hasBlanking = false;
+  if(ghostPtr)
+  {
+    const vtkIdType numCells = cellDims[0] * cellDims[1] * cellDims[2];
+    hasBlanking = std::any_of(ghostPtr, ghostPtr + numCells, [](unsigned char ghost) { return 0 != (ghost & vtkDataSetAttributes::HIDDENCELL); });
+  }
+  if(false == hasBlanking)
+  {
+    ghostPtr = nullptr;
+  }
+
+  // Without blanking only the first and last plane along each axis has faces
+  std::vector<FaceRow> rows;
+  for(int axis = 0; axis < 3; axis++)
+  {
+    const vtkIdType numRows = cellDims[FaceAxes[axis][1]];
+    const vtkIdType planeStep = hasBlanking ? 1 : cellDims[axis];
+    for(vtkIdType plane = 0; plane <= cellDims[axis]; plane += planeStep)
+    {
+      for(vtkIdType row = 0; row < numRows; row++)
+      {
+        rows.push_back({axis, plane, row});
+      }
+    }
+  }
+
+  const vtkIdType numRows = static_cast<vtkIdType>(rows.size());
+  const FaceRow* rowPtr = rows.data();
+  std::vector<vtkIdType> rowOffsets(numRows + 1, 0);
+  vtkIdType* offsetPtr = rowOffsets.data();
+
+  // Returns 1 if the face's normal points along the axis, -1 if it points against it, and
+  // 0 if there is no face between the cells on either side of the plane.
+  auto faceDirection = [=](int axis, vtkIdType plane, vtkIdType u, vtkIdType v) -> int {
+    vtkIdType index[3];
+    index[FaceAxes[axis][0]] = u;
+    index[FaceAxes[axis][1]] = v;
+
+    bool visible[2] = {false, false};
+    for(int side = 0; side < 2; side++)
+    {
+      index[axis] = plane - 1 + side;
+      if(index[axis] < 0 || index[axis] >= cellDims[axis])
+      {
+        continue;
+      }
+
+      const vtkIdType cellId = index[0] + index[1] * cellDims[0] + index[2] * cellDims[0] * cellDims[1];
+      visible[side] = (nullptr == ghostPtr) || (0 == (ghostPtr[cellId] & vtkDataSetAttributes::HIDDENCELL));
+    }
+
+    if(visible[0] == visible[1])
+    {
+      return 0;
+    }
+    return visible[0] ? 1 : -1;
+  };
+
+  // Counter-clockwise corners when looking against a face normal along the axis
+  const vtkIdType cornersU[4] = {0, 1, 1, 0};
+  const vtkIdType cornersV[4] = {0, 0, 1, 1};
+  auto cornerPoint = [=](const FaceRow& row, vtkIdType u, int corner) -> vtkIdType {
+    vtkIdType pointIndex[3];
+    pointIndex[row.m_Axis] = row.m_Plane;
+    pointIndex[FaceAxes[row.m_Axis][0]] = u + cornersU[corner];
+    pointIndex[FaceAxes[row.m_Axis][1]] = row.m_Row + cornersV[corner];
+    return pointIndex[0] + pointIndex[1] * pointDims[0] + pointIndex[2] * pointDims[0] * pointDims[1];
+  };
+
+  // Faces are counted per row while marking the image points they touch so neighboring
+  // faces share their corners
+  VSImagePointMarker marker(pointDims[0], pointDims[1] * pointDims[2]);
+  VSImagePointMarker* markerPtr = &marker;
+  vtkSMPTools::For(0, numRows, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType r = begin; r < end; r++)
+    {
+      const FaceRow& row = rowPtr[r];
+      const vtkIdType rowLength = cellDims[FaceAxes[row.m_Axis][0]];
+      vtkIdType count = 0;
+      for(vtkIdType u = 0; u < rowLength; u++)
+      {
+        if(0 == faceDirection(row.m_Axis, row.m_Plane, u, row.m_Row))
+        {
+          continue;
+        }
+
+        for(int corner = 0; corner < 4; corner++)
+        {
+          markerPtr->mark(cornerPoint(row, u, corner));
+        }
+        count++;
+      }
+      offsetPtr[r + 1] = count;
+    }
+  });
+
+  for(vtkIdType r = 0; r < numRows; r++)
+  {
+    rowOffsets[r + 1] += rowOffsets[r];
+  }
+  const vtkIdType numFaces = rowOffsets[numRows];
+
+#if VTK_MAJOR_VERSION >= 9
+  const vtkIdType prefix = 0;
+#else
+  // The legacy cell array layout prefixes each cell with its size
+  const vtkIdType prefix = 1;
+#endif
+  const vtkIdType cellSize = 4 + prefix;
+
+  // Each face keeps the color of its cell through the cell data, so corners are shared
+  const vtkIdType numPoints = marker.numberPoints();
+  VTK_PTR(vtkFloatArray) coords = marker.createPoints(image, numPoints);
+
+  VTK_NEW(vtkIdTypeArray, cells);
+  cells->SetNumberOfValues(numFaces * cellSize);
+  vtkIdType* cellPtr = cells->GetPointer(0);
+
+  VTK_PTR(vtkIdTypeArray) faceCellIds = VTK_PTR(vtkIdTypeArray)::New();
+  faceCellIds->SetName("vtkOriginalCellIds");
+  faceCellIds->SetNumberOfValues(numFaces);
+  vtkIdType* faceCellPtr = faceCellIds->GetPointer(0);
+
+  VTK_PTR(vtkIdTypeArray) facePointIds = marker.createImagePointIds(numPoints);
+  facePointIds->SetName("vtkOriginalPointIds");
+
+  vtkSMPTools::For(0, numRows, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType r = begin; r < end; r++)
+    {
+      const FaceRow& row = rowPtr[r];
+      const int uAxis = FaceAxes[row.m_Axis][0];
+      const int vAxis = FaceAxes[row.m_Axis][1];
+      const vtkIdType rowLength = cellDims[uAxis];
+      vtkIdType faceId = offsetPtr[r];
+      for(vtkIdType u = 0; u < rowLength; u++)
+      {
+        const int direction = faceDirection(row.m_Axis, row.m_Plane, u, row.m_Row);
+        if(0 == direction)
+        {
+          continue;
+        }
+
+        // The face belongs to the visible cell
+        vtkIdType cellIndex[3];
+        cellIndex[uAxis] = u;
+        cellIndex[vAxis] = row.m_Row;
+        cellIndex[row.m_Axis] = direction > 0 ? row.m_Plane - 1 : row.m_Plane;
+        faceCellPtr[faceId] = cellIndex[0] + cellIndex[1] * cellDims[0] + cellIndex[2] * cellDims[0] * cellDims[1];
+
+        vtkIdType* cell = cellPtr + faceId * cellSize;
+        if(prefix > 0)
+        {
+          cell[0] = 4;
+        }
+        for(int corner = 0; corner < 4; corner++)
+        {
+          const int ordered = direction > 0 ? corner : (4 - corner) % 4;
+          cell[prefix + corner] = markerPtr->pointId(cornerPoint(row, u, ordered));
+        }
+        faceId++;
+      }
+    }
+  });
+
+  m_Points = VTK_PTR(vtkPoints)::New();
+  m_Points->SetData(coords);
+  m_Polys = VTK_PTR(vtkCellArray)::New();
+#if VTK_MAJOR_VERSION >= 9
+  m_Polys->SetData(4, cells);
+#else
+  m_Polys->SetCells(numFaces, cells);
+#endif
+  m_FaceCellIds = faceCellIds;
+  m_FacePointIds = facePointIds;
+
+  std::copy(extent, extent + 6, m_CachedExtent);
+  std::copy(origin, origin + 3, m_CachedOrigin);
+  std::copy(spacing, spacing + 3, m_CachedSpacing);
+  m_CachedGhosts = ghosts;
+  m_CachedGhostTime = ghosts ? ghosts->GetMTime() : 0;
+}
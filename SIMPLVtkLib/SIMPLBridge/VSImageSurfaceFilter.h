@@ -0,0 +1,126 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkCellArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkPoints.h>
+#include <vtkPolyDataAlgorithm.h>
+#include <vtkType.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkImageData;
+
+/**
+ * @class VSImageSurfaceFilter VSImageSurfaceFilter.h SIMPLVtkLib/SIMPLBridge/VSImageSurfaceFilter.h
+ * @brief This class extracts the external faces of a vtkImageData volume.  Only the six
+ * boundary sides are generated unless cells are blanked through the hidden cell ghost
+ * array, in which case faces between visible and blanked cells are generated as well.
+ * Rows of faces are generated in parallel, neighboring faces share their corner points, and
+ * the output stays in the image's local coordinates.  Cell and point data are mapped to the faces by index through
+ * VSIndexedDataArrays instead of being copied.  The faces are cached until the image
+ * structure or blanking changes so changing arrays or colors never extracts them again.
+ * Flat images are passed to vtkDataSetSurfaceFilter.
+ */
+class SIMPLVtkLib_EXPORT VSImageSurfaceFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static VSImageSurfaceFilter* New();
+  vtkTypeMacro(VSImageSurfaceFilter, vtkPolyDataAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Returns the number of faces found for the cached image structure
+   * @return
+   */
+  vtkIdType GetNumberOfFaces() const;
+
+  /**
+   * @brief Clears the cached faces so they are recomputed on the next update
+   */
+  void ClearCache();
+
+protected:
+  VSImageSurfaceFilter();
+  ~VSImageSurfaceFilter() override;
+
+  /**
+   * @brief Only accepts vtkImageData inputs
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Creates the external faces for the input
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Returns true if the cached faces were generated for the given image's structure
+   * @param image
+   * @return
+   */
+  bool isCacheValid(vtkImageData* image) const;
+
+  /**
+   * @brief Generates the faces, points, and face to cell and point maps for the given image
+   * @param image
+   */
+  void updateFaces(vtkImageData* image);
+
+private:
+  int m_CachedExtent[6] = {0, -1, 0, -1, 0, -1};
+  double m_CachedOrigin[3] = {0.0, 0.0, 0.0};
+  double m_CachedSpacing[3] = {0.0, 0.0, 0.0};
+  vtkDataArray* m_CachedGhosts = nullptr;
+  vtkMTimeType m_CachedGhostTime = 0;
+
+  VTK_PTR(vtkPoints) m_Points = nullptr;
+  VTK_PTR(vtkCellArray) m_Polys = nullptr;
+  VTK_PTR(vtkIdTypeArray) m_FaceCellIds = nullptr;
+  VTK_PTR(vtkIdTypeArray) m_FacePointIds = nullptr;
+
+  VSImageSurfaceFilter(const VSImageSurfaceFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSImageSurfaceFilter&) = delete;       // Operator '=' Not Implemented
+};
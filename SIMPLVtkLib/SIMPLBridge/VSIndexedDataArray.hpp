@@ -0,0 +1,435 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <typeinfo>
+
+#include <vtkAOSDataArrayTemplate.h>
+#include <vtkDataArray.h>
+#include <vtkGenericDataArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkObjectFactory.h>
+#include <vtkVersion.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+/**
+ * @class VSIndexedArray VSIndexedDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp
+ * @brief This class allows the source and index arrays of any VSIndexedDataArray to be
+ * found without knowing its value or index type.
+ */
+class VSIndexedArray
+{
+public:
+  virtual ~VSIndexedArray() = default;
+
+  /**
+   * @brief Returns the source array
+   * @return
+   */
+  virtual vtkDataArray* GetSource() const = 0;
+
+  /**
+   * @brief Returns the index array
+   * @return
+   */
+  virtual vtkDataArray* GetIndices() const = 0;
+};
+
+/**
+ * @class VSIndexedDataArray VSIndexedDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp
+ * @brief This class is a read-only vtkDataArray whose tuples are looked up from a source
+ * array through an index array.  Tuple i returns the source tuple at indices[i].  This
+ * allows derived geometry such as extracted faces to be colored by the cell data of the
+ * cells they were taken from without copying every array.  Feature and ensemble arrays
+ * are mapped to cells the same way through the cell array indexing them.  The array does
+ * not report a standard memory layout, so readers go through the typed accessors or the
+ * source and index arrays.  Values are only copied into a contiguous buffer if VTK code
+ * requests GetVoidPointer anyway.  Indices outside of the source array return 0.
+ *
+ * New instances are plain vtkAOSDataArrayTemplates so filters copying tuples into a new
+ * array of the same type get writable storage.  NewInstance is declared to return a
+ * vtkDataArray for the same reason.
+ */
+template <class ValueTypeT, class IndexTypeT = vtkIdType>
+class VSIndexedDataArray : public vtkGenericDataArray<VSIndexedDataArray<ValueTypeT, IndexTypeT>, ValueTypeT>, public VSIndexedArray
+{
+  using GenericDataArrayType = vtkGenericDataArray<VSIndexedDataArray<ValueTypeT, IndexTypeT>, ValueTypeT>;
+
+public:
+  using SelfType = VSIndexedDataArray<ValueTypeT, IndexTypeT>;
+  // NewInstance returns a vtkDataArray because new instances are not of this class
+  vtkAbstractTypeMacroWithNewInstanceType(SelfType, GenericDataArrayType, vtkDataArray, typeid(SelfType).name())
+  using ValueType = typename Superclass::ValueType;
+  using SourceArrayType = vtkAOSDataArrayTemplate<ValueType>;
+  using IndexArrayType = vtkAOSDataArrayTemplate<IndexTypeT>;
+
+  static VSIndexedDataArray* New()
+  {
+    VTK_STANDARD_NEW_BODY(VSIndexedDataArray)
+  }
+
+  /**
+   * @brief Sets the source array and the index array used to look up each tuple.
+   * Returns false if either is not an array of contiguous values.
+   * @param source
+   * @param indices
+   * @return
+   */
+  bool SetSource(vtkDataArray* source, vtkDataArray* indices)
+  {
+    SourceArrayType* sourceArray = SourceArrayType::FastDownCast(source);
+    IndexArrayType* indexArray = IndexArrayType::FastDownCast(indices);
+    if(nullptr == sourceArray || nullptr == indexArray || indexArray->GetNumberOfComponents() != 1)
+    {
+      return false;
+    }
+
+    m_Source = sourceArray;
+    m_Indices = indexArray;
+    m_NumSourceTuples = sourceArray->GetNumberOfTuples();
+    m_Materialized = nullptr;
+
+    this->SetName(source->GetName());
+    this->NumberOfComponents = source->GetNumberOfComponents();
+    this->Size = indices->GetNumberOfTuples() * this->NumberOfComponents;
+    this->MaxId = this->Size - 1;
+    this->DataChanged();
+    return true;
+  }
+
+  /**
+   * @brief Returns the source array
+   * @return
+   */
+  vtkDataArray* GetSource() const override
+  {
+    return m_Source;
+  }
+
+  /**
+   * @brief Returns the index array
+   * @return
+   */
+  vtkDataArray* GetIndices() const override
+  {
+    return m_Indices;
+  }
+
+  /**
+   * @brief Returns the value for the given value index
+   * @param valueIdx
+   * @return
+   */
+  inline ValueType GetValue(vtkIdType valueIdx) const
+  {
+    const vtkIdType tupleIdx = valueIdx / this->NumberOfComponents;
+    const int compIdx = static_cast<int>(valueIdx % this->NumberOfComponents);
+    return GetTypedComponent(tupleIdx, compIdx);
+  }
+
+  /**
+   * @brief Read-only.  Does nothing.
+   * @param valueIdx
+   * @param value
+   */
+  inline void SetValue(vtkIdType valueIdx, ValueType value)
+  {
+  }
+
+  /**
+   * @brief Copies the tuple at the given index
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void GetTypedTuple(vtkIdType tupleIdx, ValueType* tuple) const
+  {
+    const int numComps = this->NumberOfComponents;
+    const vtkIdType sourceIdx = GetSourceTuple(tupleIdx);
+    if(sourceIdx < 0)
+    {
+      std::fill(tuple, tuple + numComps, ValueType(0));
+      return;
+    }
+
+    const ValueType* source = m_Source->GetPointer(sourceIdx * numComps);
+    std::copy(source, source + numComps, tuple);
+  }
+
+  /**
+   * @brief Read-only.  Does nothing.
+   * @param tupleIdx
+   * @param tuple
+   */
+  inline void SetTypedTuple(vtkIdType tupleIdx, const ValueType* tuple)
+  {
+  }
+
+  /**
+   * @brief Returns the component specified by tuple and component ID
+   * @param tupleIdx
+   * @param compIdx
+   * @return
+   */
+  inline ValueType GetTypedComponent(vtkIdType tupleIdx, int compIdx) const
+  {
+    const vtkIdType sourceIdx = GetSourceTuple(tupleIdx);
+    if(sourceIdx < 0)
+    {
+      return ValueType(0);
+    }
+
+    return m_Source->GetValue(sourceIdx * this->NumberOfComponents + compIdx);
+  }
+
+  /**
+   * @brief Read-only.  Does nothing.
+   * @param tupleIdx
+   * @param compIdx
+   * @param value
+   */
+  inline void SetTypedComponent(vtkIdType tupleIdx, int compIdx, ValueType value)
+  {
+  }
+
+  /**
+   * @brief Values are looked up through the index array rather than stored contiguously
+   * @return
+   */
+  bool HasStandardMemoryLayout() const override
+  {
+    return false;
+  }
+
+  /**
+   * @brief Returns a pointer to a contiguous copy of the indexed values.  The copy is
+   * created on first use and kept until the source or indices change.  Background filters
+   * and the render thread may request the pointer at the same time.
+   * @param valueIdx
+   * @return
+   */
+  void* GetVoidPointer(vtkIdType valueIdx) override
+  {
+    if(nullptr == m_Source)
+    {
+      return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_MaterializeLock);
+    const vtkMTimeType inputTime = std::max(m_Source->GetMTime(), m_Indices->GetMTime());
+    if(nullptr == m_Materialized || m_Materialized->GetMTime() < inputTime)
+    {
+      m_Materialized = VTK_PTR(SourceArrayType)::New();
+      m_Materialized->SetNumberOfComponents(this->NumberOfComponents);
+      m_Materialized->SetNumberOfTuples(this->GetNumberOfTuples());
+      const vtkIdType numTuples = this->GetNumberOfTuples();
+      for(vtkIdType i = 0; i < numTuples; i++)
+      {
+        GetTypedTuple(i, m_Materialized->GetPointer(i * this->NumberOfComponents));
+      }
+    }
+
+    return m_Materialized->GetVoidPointer(valueIdx);
+  }
+
+protected:
+  VSIndexedDataArray() = default;
+  ~VSIndexedDataArray() override = default;
+
+  /**
+   * @brief Returns a writable array of the same value type
+   * @return
+   */
+  vtkObjectBase* NewInstanceInternal() const override
+  {
+    return SourceArrayType::New();
+  }
+
+  /**
+   * @brief Returns the source tuple for the given tuple or -1 if the index is out of range
+   * @param tupleIdx
+   * @return
+   */
+  inline vtkIdType GetSourceTuple(vtkIdType tupleIdx) const
+  {
+    const vtkIdType index = static_cast<vtkIdType>(m_Indices->GetValue(tupleIdx));
+    return (index < 0 || index >= m_NumSourceTuples) ? -1 : index;
+  }
+
+  // Every indexed value is a source value, so ranges are taken from the much smaller source
+  // array.  Source values that are never referenced still contribute to the range.
+#if VTK_MAJOR_VERSION > 9 || (VTK_MAJOR_VERSION == 9 && VTK_MINOR_VERSION >= 2)
+  bool ComputeScalarRange(double* ranges, const unsigned char* ghosts, unsigned char ghostsToSkip = 0xff) override
+  {
+    return ComputeSourceScalarRange(ranges);
+  }
+
+  bool ComputeVectorRange(double range[2], const unsigned char* ghosts, unsigned char ghostsToSkip = 0xff) override
+  {
+    return ComputeSourceVectorRange(range);
+  }
+#else
+  bool ComputeScalarRange(double* ranges) override
+  {
+    return ComputeSourceScalarRange(ranges);
+  }
+
+  bool ComputeVectorRange(double range[2]) override
+  {
+    return ComputeSourceVectorRange(range);
+  }
+#endif
+
+  bool ComputeSourceScalarRange(double* ranges)
+  {
+    if(nullptr == m_Source || m_NumSourceTuples == 0)
+    {
+      return false;
+    }
+
+    for(int i = 0; i < this->NumberOfComponents; i++)
+    {
+      m_Source->GetRange(ranges + 2 * i, i);
+    }
+    return true;
+  }
+
+  bool ComputeSourceVectorRange(double range[2])
+  {
+    if(nullptr == m_Source || m_NumSourceTuples == 0)
+    {
+      return false;
+    }
+
+    m_Source->GetRange(range, -1);
+    return true;
+  }
+
+  /**
+   * @brief The array is sized by its index array.  Allocation requests are ignored.
+   * @param numTuples
+   * @return
+   */
+  bool AllocateTuples(vtkIdType numTuples)
+  {
+    return true;
+  }
+
+  /**
+   * @brief The array is sized by its index array.  Allocation requests are ignored.
+   * @param numTuples
+   * @return
+   */
+  bool ReallocateTuples(vtkIdType numTuples)
+  {
+    return true;
+  }
+
+  friend class vtkGenericDataArray<VSIndexedDataArray<ValueTypeT, IndexTypeT>, ValueTypeT>;
+
+private:
+  VTK_PTR(SourceArrayType) m_Source = nullptr;
+  VTK_PTR(IndexArrayType) m_Indices = nullptr;
+  vtkIdType m_NumSourceTuples = 0;
+  VTK_PTR(SourceArrayType) m_Materialized = nullptr;
+  std::mutex m_MaterializeLock;
+
+  VSIndexedDataArray(const VSIndexedDataArray&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSIndexedDataArray&) = delete;     // Operator '=' Not Implemented
+};
+
+/**
+ * @class VSIndexedDataArrays VSIndexedDataArray.hpp SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp
+ * @brief This class creates VSIndexedDataArrays matching the value type of a source vtkDataArray.
+ */
+class VSIndexedDataArrays
+{
+public:
+  /**
+   * @brief Creates a VSIndexedDataArray looking up the source array through the given
+   * indices.  Indices may be vtkIdType or int such as SIMPL's FeatureIds.  Returns nullptr
+   * if the source or index array type is not supported.
+   * @param source
+   * @param indices
+   * @return
+   */
+  static VTK_PTR(vtkDataArray) Create(vtkDataArray* source, vtkDataArray* indices)
+  {
+    if(nullptr == source || nullptr == indices)
+    {
+      return nullptr;
+    }
+
+    switch(indices->GetDataType())
+    {
+    case VTK_ID_TYPE:
+      return CreateIndexed<vtkIdType>(source, indices);
+    case VTK_INT:
+      return CreateIndexed<int>(source, indices);
+    default:
+      break;
+    }
+
+    return nullptr;
+  }
+
+protected:
+  template <typename IndexT> static VTK_PTR(vtkDataArray) CreateIndexed(vtkDataArray* source, vtkDataArray* indices)
+  {
+    VTK_PTR(vtkDataArray) array = nullptr;
+    switch(source->GetDataType())
+    {
+      vtkTemplateMacro(array = CreateTemplate<VTK_TT, IndexT>(source, indices));
+    default:
+      break;
+    }
+
+    return array;
+  }
+
+  template <typename T, typename IndexT> static VTK_PTR(vtkDataArray) CreateTemplate(vtkDataArray* source, vtkDataArray* indices)
+  {
+    VTK_PTR(VSIndexedDataArray<T, IndexT>) array = VTK_PTR(VSIndexedDataArray<T, IndexT>)::New();
+    if(false == array->SetSource(source, indices))
+    {
+      return nullptr;
+    }
+
+    return VTK_PTR(vtkDataArray)(array.GetPointer());
+  }
+};
@@ -85,6 +85,14 @@ void VSTetrahedralGeom::SetGeometry(TetrahedralGeom::Pointer geom)
   m_Geom = geom;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TetrahedralGeom::Pointer VSTetrahedralGeom::GetGeometry() const
+{
+  return m_Geom;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -63,6 +63,12 @@ public:
        */
       void SetGeometry(TetrahedralGeom::Pointer geom);
 
+  /**
+   * @brief Returns the DREAM.3D geometry
+   * @return
+   */
+  TetrahedralGeom::Pointer GetGeometry() const;
+
   /**
    * @brief Returns the number of cells in the geometry
    * @return
@@ -0,0 +1,358 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSTetrahedralSurfaceFilter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <vtkCellData.h>
+#include <vtkDataSetSurfaceFilter.h>
+#include <vtkIdList.h>
+#include <vtkInformation.h>
+#include <vtkInformationVector.h>
+#include <vtkPointData.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkUnstructuredGridBase.h>
+#include <vtkVersion.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h"
+
+namespace
+{
+// Outward facing triangles of a tetrahedron matching vtkTetra
+const int TetFaces[4][3] = {{0, 1, 3}, {1, 2, 3}, {2, 0, 3}, {0, 2, 1}};
+const vtkIdType TetBlockSize = 65536;
+
+/**
+ * @brief Returns true if the tetrahedron uses the given vertex
+ * @param tet
+ * @param vert
+ * @return
+ */
+inline bool TetHasVert(const int64_t* tet, int64_t vert)
+{
+  return tet[0] == vert || tet[1] == vert || tet[2] == vert || tet[3] == vert;
+}
+
+/**
+ * @brief Returns the number of boundary faces flagged in the mask
+ * @param mask
+ * @return
+ */
+inline vtkIdType CountFaces(unsigned char mask)
+{
+  return (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTetrahedralSurfaceFilter* VSTetrahedralSurfaceFilter::New()
+{
+  return new VSTetrahedralSurfaceFilter();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTetrahedralSurfaceFilter::VSTetrahedralSurfaceFilter()
+: vtkPolyDataAlgorithm()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSTetrahedralSurfaceFilter::~VSTetrahedralSurfaceFilter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTetrahedralSurfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "BoundaryFaces: " << GetNumberOfBoundaryFaces() << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSTetrahedralSurfaceFilter::GetNumberOfBoundaryFaces() const
+{
+  if(nullptr == m_OriginalCellIds)
+  {
+    return 0;
+  }
+
+  return m_OriginalCellIds->GetNumberOfTuples();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSTetrahedralSurfaceFilter::ClearCache()
+{
+  m_CachedGeom = nullptr;
+  m_CachedTets = nullptr;
+  m_CachedNumTets = 0;
+  m_Polys = nullptr;
+  m_OriginalCellIds = nullptr;
+  Modified();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSTetrahedralSurfaceFilter::FillInputPortInformation(int port, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkUnstructuredGridBase");
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSTetrahedralSurfaceFilter::RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkUnstructuredGridBase* input = vtkUnstructuredGridBase::GetData(inputVector[0], 0);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
+  if(nullptr == input || nullptr == output)
+  {
+    return 0;
+  }
+
+  // The transform filter copies the implementation so the geometry is still available
+  TetrahedralGeom::Pointer geom = nullptr;
+  VSTetrahedralGrid* tetGrid = VSTetrahedralGrid::SafeDownCast(input);
+  if(tetGrid && tetGrid->GetImplementation())
+  {
+    geom = tetGrid->GetImplementation()->GetGeometry();
+  }
+
+  if(nullptr == geom || false == updateBoundaryFaces(geom))
+  {
+    VTK_NEW(vtkDataSetSurfaceFilter, surfaceFilter);
+    surfaceFilter->SetInputData(input);
+    surfaceFilter->Update();
+    output->ShallowCopy(surfaceFilter->GetOutput());
+    return 1;
+  }
+
+  // Interior points are left unused so the input points do not need to be renumbered
+  output->SetPoints(input->GetPoints());
+  output->GetPointData()->PassData(input->GetPointData());
+  output->SetPolys(m_Polys);
+
+  const vtkIdType numFaces = m_OriginalCellIds->GetNumberOfTuples();
+  VTK_NEW(vtkIdList, fromIds);
+  VTK_NEW(vtkIdList, toIds);
+  fromIds->SetNumberOfIds(numFaces);
+  toIds->SetNumberOfIds(numFaces);
+  const vtkIdType* cellIdPtr = m_OriginalCellIds->GetPointer(0);
+  for(vtkIdType i = 0; i < numFaces; i++)
+  {
+    fromIds->SetId(i, cellIdPtr[i]);
+    toIds->SetId(i, i);
+  }
+
+  vtkCellData* outputCellData = output->GetCellData();
+  outputCellData->CopyAllocate(input->GetCellData(), numFaces);
+  outputCellData->CopyData(input->GetCellData(), fromIds, toIds);
+  outputCellData->AddArray(m_OriginalCellIds);
+
+  return 1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSTetrahedralSurfaceFilter::updateBoundaryFaces(TetrahedralGeom::Pointer geom)
+{
+  SharedTetList::Pointer tets = geom->getTetrahedra();
+  if(nullptr == tets)
+  {
+    return false;
+  }
+
+  const vtkIdType numTets = static_cast<vtkIdType>(tets->getNumberOfTuples());
+  if(m_Polys && geom.get() == m_CachedGeom && tets->getVoidPointer(0) == m_CachedTets && static_cast<size_t>(numTets) == m_CachedNumTets)
+  {
+    return true;
+  }
+
+  ElementDynamicList::Pointer elementsContainingVert = geom->getElementsContainingVert();
+  if(nullptr == elementsContainingVert)
+  {
+    if(geom->findElementsContainingVert() < 0)
+    {
+      return false;
+    }
+    elementsContainingVert = geom->getElementsContainingVert();
+    if(nullptr == elementsContainingVert)
+    {
+      return false;
+    }
+  }
+
+  const int64_t* tetPtr = tets->getPointer(0);
+  ElementDynamicList* cellsContaining = elementsContainingVert.get();
+
+  // Flag boundary faces and count them per block so the output can be filled in parallel
+  const vtkIdType numBlocks = (numTets + TetBlockSize - 1) / TetBlockSize;
+  std::vector<unsigned char> faceMasks(numTets, 0);
+  std::vector<vtkIdType> blockOffsets(numBlocks + 1, 0);
+  unsigned char* maskPtr = faceMasks.data();
+  vtkIdType* blockPtr = blockOffsets.data();
+
+  vtkSMPTools::For(0, numBlocks, [=](vtkIdType beginBlock, vtkIdType endBlock) {
+    for(vtkIdType block = beginBlock; block < endBlock; block++)
+    {
+      const vtkIdType begin = block * TetBlockSize;
+      const vtkIdType end = std::min(begin + TetBlockSize, numTets);
+      vtkIdType count = 0;
+      for(vtkIdType tetId = begin; tetId < end; tetId++)
+      {
+        const int64_t* tet = tetPtr + tetId * 4;
+        unsigned char mask = 0;
+        for(int face = 0; face < 4; face++)
+        {
+          const int64_t v0 = tet[TetFaces[face][0]];
+          const int64_t v1 = tet[TetFaces[face][1]];
+          const int64_t v2 = tet[TetFaces[face][2]];
+
+          // Any other tetrahedron sharing the face must also use its first vertex
+          bool shared = false;
+          DynamicListArray<uint16_t, int64_t>::ElementList elementList = cellsContaining->getElementList(v0);
+          for(int i = 0; i < elementList.ncells && false == shared; i++)
+          {
+            const int64_t otherId = elementList.cells[i];
+            if(otherId == tetId)
+            {
+              continue;
+            }
+
+            const int64_t* other = tetPtr + otherId * 4;
+            shared = TetHasVert(other, v1) && TetHasVert(other, v2);
+          }
+
+          if(false == shared)
+          {
+            mask |= (1 << face);
+          }
+        }
+
+        maskPtr[tetId] = mask;
+        count += CountFaces(mask);
+      }
+      blockPtr[block + 1] = count;
+    }
+  });
+
+  for(vtkIdType block = 0; block < numBlocks; block++)
+  {
+    blockOffsets[block + 1] += blockOffsets[block];
+  }
+  const vtkIdType numFaces = blockOffsets[numBlocks];
+
+#if VTK_MAJOR_VERSION >= 9
+  const vtkIdType prefix = 0;
+#else
+  // The legacy cell array layout prefixes each cell with its size
+  const vtkIdType prefix = 1;
+#endif
+  const vtkIdType cellSize = 3 + prefix;
+
+  VTK_NEW(vtkIdTypeArray, cells);
+  cells->SetNumberOfValues(numFaces * cellSize);
+  vtkIdType* cellPtr = cells->GetPointer(0);
+
+  VTK_PTR(vtkIdTypeArray) originalCellIds = VTK_PTR(vtkIdTypeArray)::New();
+  originalCellIds->SetName("vtkOriginalCellIds");
+  originalCellIds->SetNumberOfValues(numFaces);
+  vtkIdType* cellIdPtr = originalCellIds->GetPointer(0);
+
+  vtkSMPTools::For(0, numBlocks, [=](vtkIdType beginBlock, vtkIdType endBlock) {
+    for(vtkIdType block = beginBlock; block < endBlock; block++)
+    {
+      const vtkIdType begin = block * TetBlockSize;
+      const vtkIdType end = std::min(begin + TetBlockSize, numTets);
+      vtkIdType faceId = blockPtr[block];
+      for(vtkIdType tetId = begin; tetId < end; tetId++)
+      {
+        const unsigned char mask = maskPtr[tetId];
+        if(0 == mask)
+        {
+          continue;
+        }
+
+        const int64_t* tet = tetPtr + tetId * 4;
+        for(int face = 0; face < 4; face++)
+        {
+          if(0 == (mask & (1 << face)))
+          {
+            continue;
+          }
+
+          vtkIdType* cell = cellPtr + faceId * cellSize;
+          if(prefix > 0)
+          {
+            cell[0] = 3;
+          }
+          cell[prefix] = tet[TetFaces[face][0]];
+          cell[prefix + 1] = tet[TetFaces[face][1]];
+          cell[prefix + 2] = tet[TetFaces[face][2]];
+          cellIdPtr[faceId] = tetId;
+          faceId++;
+        }
+      }
+    }
+  });
+
+  m_Polys = VTK_PTR(vtkCellArray)::New();
+#if VTK_MAJOR_VERSION >= 9
+  m_Polys->SetData(3, cells);
+#else
+  m_Polys->SetCells(numFaces, cells);
+#endif
+  m_OriginalCellIds = originalCellIds;
+
+  m_CachedGeom = geom.get();
+  m_CachedTets = tets->getVoidPointer(0);
+  m_CachedNumTets = static_cast<size_t>(numTets);
+  return true;
+}
@@ -0,0 +1,115 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkCellArray.h>
+#include <vtkIdTypeArray.h>
+#include <vtkPolyDataAlgorithm.h>
+
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSTetrahedralSurfaceFilter VSTetrahedralSurfaceFilter.h SIMPLVtkLib/SIMPLBridge/VSTetrahedralSurfaceFilter.h
+ * @brief This class extracts the external surface of a VSTetrahedralGrid.  A tetrahedron
+ * face is on the boundary when no other tetrahedron using the face's first vertex also
+ * uses its other two vertices.  Faces are tested in parallel using the TetrahedralGeom's
+ * elements containing vertex list instead of hashing every face like vtkDataSetSurfaceFilter.
+ * The output shares the input points and point data.  Cell data is copied from the
+ * tetrahedron each face belongs to and the original cell IDs are stored in the
+ * "vtkOriginalCellIds" array.  The boundary faces are cached until the TetrahedralGeom
+ * changes so moving the input only rebuilds the output arrays.  Inputs that are not
+ * backed by a TetrahedralGeom are passed to vtkDataSetSurfaceFilter.
+ */
+class SIMPLVtkLib_EXPORT VSTetrahedralSurfaceFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static VSTetrahedralSurfaceFilter* New();
+  vtkTypeMacro(VSTetrahedralSurfaceFilter, vtkPolyDataAlgorithm)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Returns the number of boundary faces found for the cached geometry
+   * @return
+   */
+  vtkIdType GetNumberOfBoundaryFaces() const;
+
+  /**
+   * @brief Clears the cached boundary faces so they are recomputed on the next update
+   */
+  void ClearCache();
+
+protected:
+  VSTetrahedralSurfaceFilter();
+  ~VSTetrahedralSurfaceFilter() override;
+
+  /**
+   * @brief Only accepts vtkUnstructuredGridBase inputs
+   * @param port
+   * @param info
+   * @return
+   */
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  /**
+   * @brief Creates the external surface for the input
+   * @param request
+   * @param inputVector
+   * @param outputVector
+   * @return
+   */
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector) override;
+
+  /**
+   * @brief Finds the boundary faces of the given geometry and caches the polygons and
+   * the cell ID each polygon was taken from.
+   * @param geom
+   * @return
+   */
+  bool updateBoundaryFaces(TetrahedralGeom::Pointer geom);
+
+private:
+  TetrahedralGeom* m_CachedGeom = nullptr;
+  void* m_CachedTets = nullptr;
+  size_t m_CachedNumTets = 0;
+  VTK_PTR(vtkCellArray) m_Polys = nullptr;
+  VTK_PTR(vtkIdTypeArray) m_OriginalCellIds = nullptr;
+
+  VSTetrahedralSurfaceFilter(const VSTetrahedralSurfaceFilter&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSTetrahedralSurfaceFilter&) = delete;             // Operator '=' Not Implemented
+};
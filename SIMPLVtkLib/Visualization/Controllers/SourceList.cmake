@@ -1,20 +1,38 @@
 
 set(${PROJECT_NAME}_Visualization_Controllers_HDRS
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSCategoricalLookupTable.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSController.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSFilterViewSettings.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSImageSlabCache.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSIndexedLookupTable.h
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSMemoryManager.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSOutputCache.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSRenderGeometry.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSSessionBundle.h
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSSessionDataLoader.h
 )
 
 set(${PROJECT_NAME}_Visualization_Controllers_SRCS
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSCategoricalLookupTable.cpp
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.cpp
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSController.cpp
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSFilterModel.cpp
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSFilterViewModel.cpp
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSFilterViewSettings.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSImageSlabCache.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSIndexedLookupTable.cpp
   ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSMemoryManager.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSOutputCache.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSRenderGeometry.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSSessionBundle.cpp
+  ${${PROJECT_NAME}_SOURCE_DIR}/SIMPLVtkLib/Visualization/Controllers/VSSessionDataLoader.cpp
 )
 
 cmp_IDE_SOURCE_PROPERTIES( "${PROJECT_NAME}/Controllers" "${${PROJECT_NAME}_Visualization_Controllers_HDRS}" "${${PROJECT_NAME}_Visualization_Controllers_SRCS}" "0")
\ No newline at end of file
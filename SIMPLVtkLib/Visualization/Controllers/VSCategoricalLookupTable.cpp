@@ -0,0 +1,186 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSCategoricalLookupTable.h"
+
+#include <algorithm>
+
+#include <vtkDataArray.h>
+#include <vtkSMPTools.h>
+
+namespace
+{
+/**
+ * @brief Maps a range of typed values to the requested output format
+ */
+template <typename T>
+void MapValues(const VSCategoricalLookupTable* table, const T* input, unsigned char* output, vtkIdType numValues, int inputIncrement, int outputFormat, unsigned char alpha)
+{
+  vtkSMPTools::For(0, numValues, [&](vtkIdType begin, vtkIdType end) {
+    unsigned char rgb[3];
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      table->LookupColor(static_cast<double>(input[i * inputIncrement]), rgb);
+      unsigned char* color = output + i * outputFormat;
+      switch(outputFormat)
+      {
+      case VTK_RGBA:
+        color[3] = alpha;
+      // Fall through
+      case VTK_RGB:
+        color[0] = rgb[0];
+        color[1] = rgb[1];
+        color[2] = rgb[2];
+        break;
+      case VTK_LUMINANCE_ALPHA:
+        color[1] = alpha;
+      // Fall through
+      case VTK_LUMINANCE:
+        color[0] = static_cast<unsigned char>(rgb[0] * 0.30 + rgb[1] * 0.59 + rgb[2] * 0.11 + 0.5);
+        break;
+      default:
+        break;
+      }
+    }
+  });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCategoricalLookupTable* VSCategoricalLookupTable::New()
+{
+  return new VSCategoricalLookupTable();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCategoricalLookupTable::VSCategoricalLookupTable()
+: vtkScalarsToColors()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCategoricalLookupTable::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSCategoricalLookupTable::IsCategoricalArray(vtkDataArray* array, int component, double minimumIds)
+{
+  if(nullptr == array || array->GetNumberOfTuples() == 0)
+  {
+    return false;
+  }
+  if(array->GetNumberOfComponents() != 1 && component < 0)
+  {
+    return false;
+  }
+
+  switch(array->GetDataType())
+  {
+  case VTK_CHAR:
+  case VTK_SIGNED_CHAR:
+  case VTK_UNSIGNED_CHAR:
+  case VTK_SHORT:
+  case VTK_UNSIGNED_SHORT:
+  case VTK_INT:
+  case VTK_UNSIGNED_INT:
+  case VTK_LONG:
+  case VTK_UNSIGNED_LONG:
+  case VTK_LONG_LONG:
+  case VTK_UNSIGNED_LONG_LONG:
+  case VTK_ID_TYPE:
+    break;
+  default:
+    return false;
+  }
+
+  double range[2];
+  array->GetRange(range, std::max(component, 0));
+  return (range[1] - range[0] + 1.0) >= minimumIds;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCategoricalLookupTable::GetColor(double v, double rgb[3])
+{
+  unsigned char color[3];
+  LookupColor(v, color);
+  rgb[0] = color[0] / 255.0;
+  rgb[1] = color[1] / 255.0;
+  rgb[2] = color[2] / 255.0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const unsigned char* VSCategoricalLookupTable::MapValue(double v)
+{
+  LookupColor(v, m_MappedColor);
+  m_MappedColor[3] = static_cast<unsigned char>(GetAlpha() * 255.0 + 0.5);
+  return m_MappedColor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCategoricalLookupTable::MapScalarsThroughTable2(void* input, unsigned char* output, int inputDataType, int numberOfValues, int inputIncrement, int outputFormat)
+{
+  unsigned char alpha = static_cast<unsigned char>(GetAlpha() * 255.0 + 0.5);
+  switch(inputDataType)
+  {
+    vtkTemplateMacro(MapValues(this, static_cast<const VTK_TT*>(input), output, numberOfValues, inputIncrement, outputFormat, alpha));
+  default:
+    vtkErrorMacro(<< "MapScalarsThroughTable2: Unknown input data type");
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSCategoricalLookupTable::GetNumberOfAvailableColors()
+{
+  return static_cast<vtkIdType>(1) << 24;
+}
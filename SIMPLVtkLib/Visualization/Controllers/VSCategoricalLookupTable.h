@@ -0,0 +1,161 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkScalarsToColors.h>
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkDataArray;
+
+/**
+ * @class VSCategoricalLookupTable VSCategoricalLookupTable.h SIMPLVtkLib/Visualization/Controllers/VSCategoricalLookupTable.h
+ * @brief This class maps integer IDs such as FeatureIds or Phases to distinct colors.  Each
+ * ID's color is a hash of the ID, so neighboring IDs get unrelated colors and the same ID
+ * is always the same color regardless of the array or range.  Hashing an ID costs a few
+ * multiplies, so colors are hashed as values are mapped instead of being stored in a table.
+ * Values are mapped in parallel.  Non-integer values are truncated toward negative infinity.
+ */
+class SIMPLVtkLib_EXPORT VSCategoricalLookupTable : public vtkScalarsToColors
+{
+public:
+  static VSCategoricalLookupTable* New();
+  vtkTypeMacro(VSCategoricalLookupTable, vtkScalarsToColors)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Returns true if the array should be colored categorically when the lookup table
+   * is chosen automatically.  This is true for single component integer arrays whose range
+   * covers at least the given number of IDs.
+   * @param array
+   * @param component
+   * @param minimumIds
+   * @return
+   */
+  static bool IsCategoricalArray(vtkDataArray* array, int component, double minimumIds);
+
+  /**
+   * @brief Returns the color for the given ID
+   * @param id
+   * @param rgb
+   */
+  static inline void HashColor(long long id, unsigned char rgb[3]);
+
+  /**
+   * @brief Returns the color for the given value as doubles in the range [0, 1]
+   * @param v
+   * @param rgb
+   */
+  void GetColor(double v, double rgb[3]) override;
+
+  /**
+   * @brief Returns the RGBA color for the given value
+   * @param v
+   * @return
+   */
+  const unsigned char* MapValue(double v) override;
+
+  /**
+   * @brief Maps the input values to colors in parallel
+   * @param input
+   * @param output
+   * @param inputDataType
+   * @param numberOfValues
+   * @param inputIncrement
+   * @param outputFormat
+   */
+  void MapScalarsThroughTable2(void* input, unsigned char* output, int inputDataType, int numberOfValues, int inputIncrement, int outputFormat) override;
+
+  /**
+   * @brief Returns the number of distinct colors available
+   * @return
+   */
+  vtkIdType GetNumberOfAvailableColors() override;
+
+  /**
+   * @brief Copies the color for the given value into rgb
+   * @param value
+   * @param rgb
+   */
+  inline void LookupColor(double value, unsigned char rgb[3]) const;
+
+protected:
+  VSCategoricalLookupTable();
+  ~VSCategoricalLookupTable() override = default;
+
+private:
+  unsigned char m_MappedColor[4] = {0, 0, 0, 255};
+
+  VSCategoricalLookupTable(const VSCategoricalLookupTable&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSCategoricalLookupTable&) = delete;           // Operator '=' Not Implemented
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline void VSCategoricalLookupTable::HashColor(long long id, unsigned char rgb[3])
+{
+  // SplitMix64 finalizer
+  unsigned long long hash = static_cast<unsigned long long>(id) + 0x9E3779B97F4A7C15ull;
+  hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ull;
+  hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBull;
+  hash = hash ^ (hash >> 31);
+
+  // Keep every channel above 48 so no ID is close to black
+  rgb[0] = static_cast<unsigned char>(48 + ((hash & 0xFF) * 207) / 255);
+  rgb[1] = static_cast<unsigned char>(48 + (((hash >> 8) & 0xFF) * 207) / 255);
+  rgb[2] = static_cast<unsigned char>(48 + (((hash >> 16) & 0xFF) * 207) / 255);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+inline void VSCategoricalLookupTable::LookupColor(double value, unsigned char rgb[3]) const
+{
+  if(value != value)
+  {
+    rgb[0] = rgb[1] = rgb[2] = 0;
+    return;
+  }
+
+  long long id = static_cast<long long>(value);
+  if(static_cast<double>(id) > value)
+  {
+    id--;
+  }
+
+  HashColor(id, rgb);
+}
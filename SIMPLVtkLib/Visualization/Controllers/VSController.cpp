@@ -35,17 +35,26 @@
 
 #include "VSController.h"
 
+#include <vtkAlgorithm.h>
+
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QUuid>
 
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSSessionBundle.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCalculatorFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSClipFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSContourFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSCropFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSDataSetFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSGrainBoundaryFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSMaskFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSRootFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
@@ -53,6 +62,12 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSTextFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSThresholdFilter.h"
 
+namespace
+{
+// A single array of this many voxels is read and wrapped in well under a second
+const size_t CoarseVoxelCount = 1 << 20;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -62,6 +77,7 @@ VSController::VSController(QObject* parent)
 , m_SelectionModel(new QItemSelectionModel(m_FilterModel))
 {
   m_ImportObject = new VSConcurrentImport(this);
+  m_SessionLoader = new VSSessionDataLoader(this);
 
   connect(m_FilterModel, &VSFilterModel::filterAdded, this, &VSController::listenFilterAdded);
   connect(m_FilterModel, &VSFilterModel::filterRemoved, this, &VSController::filterRemoved);
@@ -71,6 +87,10 @@ VSController::VSController(QObject* parent)
   connect(m_ImportObject, SIGNAL(applyingDataFilters(int)), this, SIGNAL(applyingDataFilters(int)));
   connect(m_ImportObject, SIGNAL(dataFilterApplied(int)), this, SIGNAL(dataFilterApplied(int)));
 
+  connect(m_SessionLoader, &VSSessionDataLoader::applyingDataFilters, this, &VSController::applyingDataFilters);
+  connect(m_SessionLoader, &VSSessionDataLoader::dataFilterApplied, this, &VSController::dataFilterApplied);
+  connect(m_SessionLoader, &VSSessionDataLoader::finishedLoading, this, &VSController::dataImported);
+
   connect(m_SelectionModel, &QItemSelectionModel::selectionChanged, this, &VSController::listenSelectionModel);
 }
 
@@ -92,6 +112,146 @@ void VSController::importDataContainerArray(QString filePath, DataContainerArray
   m_ImportObject->run();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSController::importDataContainerArray(QString filePath, DataContainerArray::Pointer dca, const VSImageRegion& region)
+{
+  VSFileNameFilter* fileFilter = new VSFileNameFilter(filePath);
+  fileFilter->setImageRegion(region);
+
+  m_ImportObject->setLoadType(VSConcurrentImport::LoadType::Import);
+  m_ImportObject->addDataContainerArray(fileFilter, dca);
+  m_ImportObject->run();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSController::importDataContainerArrayProgressively(QString filePath, DataContainerArrayProxy proxy, const VSImageRegion& region, bool useRegion, QString& errorMessage)
+{
+  VSFileNameFilter* fileFilter = new VSFileNameFilter(filePath);
+  if(useRegion)
+  {
+    fileFilter->setImageRegion(region);
+  }
+
+  QMap<QString, VSImageRegion> coarseRegions;
+  DataContainerArrayProxy coarseProxy = proxy;
+  for(const DataContainerProxy& dcProxy : proxy.dataContainers)
+  {
+    if(dcProxy.flag == Qt::Unchecked || dcProxy.dcType != static_cast<unsigned int>(IGeometry::Type::Image))
+    {
+      continue;
+    }
+
+    ImageGeom::Pointer geom = VSImageRegionReader::ReadImageGeometry(filePath, dcProxy.name);
+    if(nullptr == geom)
+    {
+      continue;
+    }
+
+    std::tuple<size_t, size_t, size_t> geomDims = geom->getDimensions();
+    size_t dims[3] = {std::get<0>(geomDims), std::get<1>(geomDims), std::get<2>(geomDims)};
+    QList<VSImageRegion> levels = VSImageRegionReader::CreateRefinementLevels(region.clamped(dims), CoarseVoxelCount);
+    coarseRegions[dcProxy.name] = levels.takeFirst();
+    if(levels.isEmpty())
+    {
+      if(false == useRegion)
+      {
+        coarseRegions.remove(dcProxy.name);
+      }
+      continue;
+    }
+
+    // The finest level reads every checked array of this DataContainer only
+    VSImageRefinement refinement;
+    refinement.m_Proxy = proxy;
+    for(QMap<QString, DataContainerProxy>::iterator dcIter = refinement.m_Proxy.dataContainers.begin(); dcIter != refinement.m_Proxy.dataContainers.end(); dcIter++)
+    {
+      if(dcIter.key() != dcProxy.name)
+      {
+        dcIter.value().flag = Qt::Unchecked;
+      }
+    }
+    refinement.m_Levels = levels;
+    fileFilter->setImageRefinement(dcProxy.name, refinement);
+
+    // The coarse level only reads the first checked cell array
+    bool foundArray = false;
+    DataContainerProxy& coarseDcProxy = coarseProxy.dataContainers[dcProxy.name];
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = coarseDcProxy.attributeMatricies.begin(); amIter != coarseDcProxy.attributeMatricies.end(); amIter++)
+    {
+      if(amIter.value().amType != AttributeMatrix::Type::Cell || amIter.value().flag == Qt::Unchecked)
+      {
+        continue;
+      }
+
+      QMap<QString, DataArrayProxy>& dataArrays = amIter.value().dataArrays;
+      for(QMap<QString, DataArrayProxy>::iterator daIter = dataArrays.begin(); daIter != dataArrays.end(); daIter++)
+      {
+        if(foundArray)
+        {
+          daIter.value().flag = Qt::Unchecked;
+        }
+        foundArray = foundArray || daIter.value().flag != Qt::Unchecked;
+      }
+    }
+  }
+
+  DataContainerArray::Pointer dca = VSImageRegionReader::ReadDataContainerArray(filePath, coarseProxy, coarseRegions, errorMessage);
+  if(nullptr == dca)
+  {
+    delete fileFilter;
+    return false;
+  }
+
+  m_ImportObject->setLoadType(VSConcurrentImport::LoadType::Import);
+  m_ImportObject->addDataContainerArray(fileFilter, dca);
+  m_ImportObject->run();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSController::importDataContainerArraySliceOnly(QString filePath, DataContainerArrayProxy proxy, QString& errorMessage)
+{
+  VSFileNameFilter* fileFilter = new VSFileNameFilter(filePath);
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = proxy.dataContainers.begin(); dcIter != proxy.dataContainers.end(); dcIter++)
+  {
+    DataContainerProxy& dcProxy = dcIter.value();
+    if(dcProxy.flag == Qt::Unchecked || dcProxy.dcType != static_cast<unsigned int>(IGeometry::Type::Image))
+    {
+      continue;
+    }
+
+    fileFilter->setSliceArrays(dcProxy.name, VSImageRegionReader::GetCellArrays(dcProxy));
+    VSImageRegionReader::UncheckCellArrays(dcProxy);
+  }
+
+  DataContainerArray::Pointer dca = nullptr;
+  {
+    QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
+    SIMPLH5DataReader reader;
+    if(reader.openFile(filePath))
+    {
+      dca = reader.readSIMPLDataUsingProxy(proxy, false);
+    }
+  }
+  if(nullptr == dca)
+  {
+    errorMessage = tr("The file '%1' could not be read.").arg(filePath);
+    delete fileFilter;
+    return false;
+  }
+
+  m_ImportObject->setLoadType(VSConcurrentImport::LoadType::Import);
+  m_ImportObject->addDataContainerArray(fileFilter, dca);
+  m_ImportObject->run();
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -225,6 +385,63 @@ bool VSController::saveSession(const QString& sessionFilePath)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSController::saveSessionBundle(const QString& sessionFilePath)
+{
+  QJsonObject rootObj;
+
+  VSAbstractFilter::FilterListType baseFilters = getBaseFilters();
+  for(VSAbstractFilter* filter : baseFilters)
+  {
+    saveFilter(filter, rootObj);
+  }
+
+  // Snapshots are streamed to the file one at a time
+  VSSessionBundleWriter writer(sessionFilePath);
+  QJsonDocument doc(rootObj);
+  if(false == writer.open(doc.toJson(QJsonDocument::Compact)))
+  {
+    return false;
+  }
+
+  VSAbstractFilter::FilterListType allFilters = getAllFilters();
+  for(VSAbstractFilter* filter : allFilters)
+  {
+    if(false == filter->canCacheOutput())
+    {
+      continue;
+    }
+
+    // Bring the output up to date with the applied values the key is built from
+    filter->updateDirtyOutput();
+    vtkAlgorithmOutput* outputPort = filter->getOutputPort();
+    if(outputPort && outputPort->GetProducer())
+    {
+      outputPort->GetProducer()->Update();
+    }
+
+    VTK_PTR(vtkDataSet) output = filter->getOutput();
+    QByteArray key = filter->getOutputKey();
+    if(nullptr == output || key.isEmpty() || writer.contains(key))
+    {
+      continue;
+    }
+
+    writer.addSnapshot(key, output);
+  }
+
+  // Release the mapping before replacing the bundle it was read from
+  VSSessionBundle::Pointer activeBundle = VSSessionBundle::GetActiveBundle();
+  if(activeBundle && QFileInfo(activeBundle->getFilePath()) == QFileInfo(sessionFilePath))
+  {
+    VSSessionBundle::SetActiveBundle(nullptr);
+  }
+
+  return writer.commit();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -253,13 +470,29 @@ void VSController::saveFilter(VSAbstractFilter* filter, QJsonObject& obj)
 // -----------------------------------------------------------------------------
 bool VSController::loadSession(const QString& sessionFilePath)
 {
-  QFile inputFile(sessionFilePath);
-  if(inputFile.open(QIODevice::ReadOnly) == false)
+  QByteArray byteArray;
+  if(VSSessionBundle::IsBundle(sessionFilePath))
   {
-    return false;
+    VSSessionBundle::Pointer bundle = VSSessionBundle::Open(sessionFilePath);
+    if(nullptr == bundle)
+    {
+      return false;
+    }
+
+    VSSessionBundle::SetActiveBundle(bundle);
+    byteArray = bundle->getSessionJson();
+  }
+  else
+  {
+    QFile inputFile(sessionFilePath);
+    if(inputFile.open(QIODevice::ReadOnly) == false)
+    {
+      return false;
+    }
+
+    byteArray = inputFile.readAll();
   }
 
-  QByteArray byteArray = inputFile.readAll();
   QJsonParseError parseError;
 
   QJsonDocument doc = QJsonDocument::fromJson(byteArray, &parseError);
@@ -275,9 +508,19 @@ bool VSController::loadSession(const QString& sessionFilePath)
     loadFilter(filterObj);
   }
 
+  m_SessionLoader->run();
+
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSController::isLoadingSession() const
+{
+  return m_SessionLoader->isLoading();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -286,10 +529,20 @@ void VSController::loadFilter(QJsonObject& obj, VSAbstractFilter* parentFilter)
   QUuid uuid(obj["Uuid"].toString());
 
   VSAbstractFilter* newFilter = nullptr;
+  VSSIMPLDataContainerFilter* placeholderFilter = nullptr;
+  QString placeholderFilePath;
   if(uuid == VSClipFilter::GetUuid())
   {
     newFilter = VSClipFilter::Create(obj, parentFilter);
   }
+  else if(uuid == VSCalculatorFilter::GetUuid())
+  {
+    newFilter = VSCalculatorFilter::Create(obj, parentFilter);
+  }
+  else if(uuid == VSContourFilter::GetUuid())
+  {
+    newFilter = VSContourFilter::Create(obj, parentFilter);
+  }
   else if(uuid == VSCropFilter::GetUuid())
   {
     newFilter = VSCropFilter::Create(obj, parentFilter);
@@ -308,6 +561,10 @@ void VSController::loadFilter(QJsonObject& obj, VSAbstractFilter* parentFilter)
   {
     newFilter = VSFileNameFilter::Create(obj, parentFilter);
   }
+  else if(uuid == VSGrainBoundaryFilter::GetUuid())
+  {
+    newFilter = VSGrainBoundaryFilter::Create(obj, parentFilter);
+  }
   else if(uuid == VSMaskFilter::GetUuid())
   {
     newFilter = VSMaskFilter::Create(obj, parentFilter);
@@ -317,9 +574,11 @@ void VSController::loadFilter(QJsonObject& obj, VSAbstractFilter* parentFilter)
     if(dynamic_cast<VSFileNameFilter*>(parentFilter) != nullptr)
     {
       VSFileNameFilter* fileNameFilter = dynamic_cast<VSFileNameFilter*>(parentFilter);
-      QString filePath = fileNameFilter->getFilePath();
+      placeholderFilePath = fileNameFilter->getFilePath();
 
-      newFilter = VSSIMPLDataContainerFilter::Create(filePath, obj, parentFilter);
+      // The DataContainer is read in the background along with the others from the same file
+      placeholderFilter = VSSIMPLDataContainerFilter::CreatePlaceholder(obj, parentFilter);
+      newFilter = placeholderFilter;
     }
   }
   else if(uuid == VSSliceFilter::GetUuid())
@@ -343,6 +602,12 @@ void VSController::loadFilter(QJsonObject& obj, VSAbstractFilter* parentFilter)
     newFilter->setChecked(obj["CheckState"].toInt() == Qt::Checked);
     emit filterCheckStateChanged(newFilter);
 
+    // Children of a placeholder run once its data arrives and only if they are displayed
+    if(placeholderFilter)
+    {
+      m_SessionLoader->addDataContainerFilter(placeholderFilePath, placeholderFilter);
+    }
+
     for(QJsonObject::iterator iter = childrenObj.begin(); iter != childrenObj.end(); iter++)
     {
       QJsonObject childObj = iter.value().toObject();
@@ -45,6 +45,7 @@
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSConcurrentImport.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSSessionDataLoader.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -89,13 +90,32 @@ public:
   bool saveSession(const QString& sessionFilePath);
 
   /**
-   * @brief Loads the session stored in the file at sessionFilePath
+   * @brief Saves the session to a binary bundle at sessionFilePath.  The bundle also stores
+   * snapshots of the current outputs of filters that support it so that reopening the bundle
+   * does not need to execute those filters again.  Bundles are opened with loadSession.
+   * @param sessionFilePath
+   * @return
+   */
+  bool saveSessionBundle(const QString& sessionFilePath);
+
+  /**
+   * @brief Loads the session stored in the file at sessionFilePath.  The filter tree is
+   * created immediately with placeholder DataContainer filters whose data is read in the
+   * background.  Child filters are restored once their input DataContainer is available.
+   * Session bundles become the active VSSessionBundle so restored filters whose input and
+   * parameters still match a stored snapshot use it instead of executing.
    * @param sessionFilePath
    * @param instance
    * @return
    */
   bool loadSession(const QString& sessionFilePath);
 
+  /**
+   * @brief Returns true while DataContainers from a loaded session are still being read
+   * @return
+   */
+  bool isLoadingSession() const;
+
   /**
    * @brief Import data from a DataContainerArray and add any relevant DataContainers
    * as top-level VisualFilters
@@ -103,6 +123,43 @@ public:
    */
   void importDataContainerArray(QString filePath, DataContainerArray::Pointer dca);
 
+  /**
+   * @brief Import data from a DataContainerArray read with a region of interest and add any
+   * relevant DataContainers as top-level VisualFilters.  The region is stored so that the
+   * DataContainers can be reloaded or expanded without reading the full volume.
+   * @param filePath
+   * @param dca
+   * @param region
+   */
+  void importDataContainerArray(QString filePath, DataContainerArray::Pointer dca, const VSImageRegion& region);
+
+  /**
+   * @brief Imports the checked items of the proxy with large ImageGeom DataContainers read
+   * progressively.  A strided version of each ImageGeom with only its first checked cell array
+   * is read and imported first.  The finer levels are read in the background and replace the
+   * data of the same filters.  Returns false and sets the error message if the file could not
+   * be read.
+   * @param filePath
+   * @param proxy
+   * @param region
+   * @param useRegion
+   * @param errorMessage
+   * @return
+   */
+  bool importDataContainerArrayProgressively(QString filePath, DataContainerArrayProxy proxy, const VSImageRegion& region, bool useRegion, QString& errorMessage);
+
+  /**
+   * @brief Imports the checked items of the proxy with ImageGeom DataContainers in slice-only mode.
+   * Only the geometry of each ImageGeom is read and its checked cell arrays are left in the file
+   * for slice filters to read one slab at a time.  Other DataContainers are read normally.
+   * Returns false and sets the error message if the file could not be read.
+   * @param filePath
+   * @param proxy
+   * @param errorMessage
+   * @return
+   */
+  bool importDataContainerArraySliceOnly(QString filePath, DataContainerArrayProxy proxy, QString& errorMessage);
+
   /**
    * @brief Import data from a FilterPipeline and add any relevant DataContainers as top-level VisualFilters
    * @param pipeline
@@ -233,6 +290,7 @@ protected:
 private:
   VSFilterModel* m_FilterModel;
   VSConcurrentImport* m_ImportObject;
+  VSSessionDataLoader* m_SessionLoader;
   QItemSelectionModel* m_SelectionModel;
 
   /**
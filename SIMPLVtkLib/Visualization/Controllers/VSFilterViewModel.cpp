@@ -37,6 +37,12 @@
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSRootFilter.h"
 
+namespace
+{
+// Number of shared layers looked through before they are flattened into one
+const int MaxSharedLayerDepth = 4;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -119,12 +125,16 @@ void VSFilterViewModel::setFilterModel(VSFilterModel* filterModel)
     connect(filterModel, &VSFilterModel::finishedInsertingFilter, this, &VSFilterViewModel::finishInsertingFilter);
     connect(filterModel, &VSFilterModel::finishedRemovingFilter, this, &VSFilterViewModel::finishRemovingFilter);
 
-    std::list<VSAbstractFilter*> filterList = filterModel->getAllFilters();
-    for(VSAbstractFilter* filter : filterList)
+    // Filters with shared values are created on demand
+    if(nullptr == m_SharedValues)
     {
-      beginInsertingFilter(filter);
-      createFilterViewSettings(filter);
-      finishInsertingFilter();
+      std::list<VSAbstractFilter*> filterList = filterModel->getAllFilters();
+      for(VSAbstractFilter* filter : filterList)
+      {
+        beginInsertingFilter(filter);
+        createFilterViewSettings(filter);
+        finishInsertingFilter();
+      }
     }
   }
 
@@ -183,21 +193,236 @@ void VSFilterViewModel::deepCopy(const VSFilterViewModel& model)
 {
   if(nullptr != model.m_FilterModel)
   {
+    // Share the other model's values instead of copying every VSFilterViewSettings
+    SharedValuesPointer sharedValues = model.createSharedValues();
+    clearFilterViewSettings();
+    m_SharedValues = sharedValues;
+
     setFilterModel(model.m_FilterModel);
+    createVisibleFilterViewSettings();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewModel::SharedValuesPointer VSFilterViewModel::createSharedValues() const
+{
+  // Nothing changed since the last split so the existing layer can be shared as is
+  if(m_ChangedFilters.empty())
+  {
+    return m_SharedValues;
+  }
+
+  SharedValuesPointer layer = std::make_shared<SharedValuesLayer>();
+  if(m_SharedValues && m_SharedValues->m_Depth >= MaxSharedLayerDepth)
+  {
+    // Older layers are copied first so newer values replace them
+    std::vector<SharedValuesLayer*> chain;
+    for(SharedValuesLayer* parent = m_SharedValues.get(); parent != nullptr; parent = parent->m_Parent.get())
+    {
+      chain.push_back(parent);
+    }
+    for(auto iter = chain.rbegin(); iter != chain.rend(); iter++)
+    {
+      for(const auto& values : (*iter)->m_Values)
+      {
+        layer->m_Values[values.first] = values.second;
+      }
+    }
+  }
+  else if(m_SharedValues)
+  {
+    layer->m_Parent = m_SharedValues;
+    layer->m_Depth = m_SharedValues->m_Depth + 1;
+  }
+
+  for(VSAbstractFilter* filter : m_ChangedFilters)
+  {
+    auto iter = m_FilterViewSettings.find(filter);
+    if(iter != m_FilterViewSettings.end() && iter->second)
+    {
+      layer->m_Values[filter] = iter->second->getValues();
+    }
+  }
+
+  m_SharedValues = layer;
+  m_ChangedFilters.clear();
+  return layer;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewModel::pruneSharedValues(VSAbstractFilter* filter)
+{
+  for(SharedValuesLayer* layer = m_SharedValues.get(); layer != nullptr; layer = layer->m_Parent.get())
+  {
+    layer->m_Values.erase(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewModel::trackValueChanges(VSFilterViewSettings* viewSettings) const
+{
+  VSAbstractFilter* filter = viewSettings->getFilter();
+  connect(viewSettings, &VSFilterViewSettings::valuesChanged, this, [=] { m_ChangedFilters.insert(filter); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewSettings::ValuesPointer VSFilterViewModel::findSharedValues(VSAbstractFilter* filter) const
+{
+  for(const SharedValuesLayer* layer = m_SharedValues.get(); layer != nullptr; layer = layer->m_Parent.get())
+  {
+    auto iter = layer->m_Values.find(filter);
+    if(iter != layer->m_Values.end())
+    {
+      return iter->second;
+    }
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewSettings* VSFilterViewModel::createFromSharedValues(VSAbstractFilter* filter) const
+{
+  VSFilterViewSettings::ValuesPointer values = findSharedValues(filter);
+  if(nullptr == values)
+  {
+    return nullptr;
+  }
+
+  VSFilterViewSettings* viewSettings = new VSFilterViewSettings(filter, values);
+  m_FilterViewSettings[filter] = viewSettings;
+  trackValueChanges(viewSettings);
+
+  emit viewSettingsCreated(viewSettings);
+  return viewSettings;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewModel::createVisibleFilterViewSettings()
+{
+  if(nullptr == m_FilterModel)
+  {
+    return;
+  }
+
+  // The newest values for each filter are found first
+  std::set<VSAbstractFilter*> visited;
+  std::vector<VSAbstractFilter*> visibleFilters;
+  for(const SharedValuesLayer* layer = m_SharedValues.get(); layer != nullptr; layer = layer->m_Parent.get())
+  {
+    for(const auto& values : layer->m_Values)
+    {
+      if(visited.insert(values.first).second && values.second && values.second->m_Visible)
+      {
+        visibleFilters.push_back(values.first);
+      }
+    }
+  }
+
+  for(VSAbstractFilter* filter : visibleFilters)
+  {
+    getFilterViewSettings(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewModel::createAllFilterViewSettings() const
+{
+  if(nullptr == m_FilterModel)
+  {
+    return;
+  }
+
+  std::list<VSAbstractFilter*> filterList = m_FilterModel->getAllFilters();
+  for(VSAbstractFilter* filter : filterList)
+  {
+    getFilterViewSettings(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSFilterViewModel::createResourceReport() const
+{
+  QStringList lines;
+  int allocatedCount = 0;
+  int releasedCount = 0;
+  int sharedCount = 0;
+  unsigned long geometrySize = 0;
 
-    std::vector<VSFilterViewSettings*> allFilterViewSettings = model.getAllFilterViewSettings();
-    for(VSFilterViewSettings* filterViewSettings : allFilterViewSettings)
+  if(m_FilterModel)
+  {
+    std::list<VSAbstractFilter*> filterList = m_FilterModel->getAllFilters();
+    for(VSAbstractFilter* filter : filterList)
     {
-      if(m_FilterViewSettings.find(filterViewSettings->getFilter()) == m_FilterViewSettings.end())
+      auto iter = m_FilterViewSettings.find(filter);
+      if(iter == m_FilterViewSettings.end() || nullptr == iter->second)
       {
-        m_FilterViewSettings[filterViewSettings->getFilter()] = new VSFilterViewSettings(*filterViewSettings);
+        // Only referenced through the shared values
+        if(findSharedValues(filter))
+        {
+          sharedCount++;
+        }
+        continue;
       }
-      else
+
+      VSFilterViewSettings* settings = iter->second;
+      if(settings->isReleased())
       {
-        m_FilterViewSettings[filterViewSettings->getFilter()]->deepCopy(filterViewSettings);
+        releasedCount++;
       }
+      else if(settings->isValid())
+      {
+        allocatedCount++;
+        geometrySize += settings->getResourceMemorySize();
+      }
+
+      lines << settings->getResourceReport();
     }
   }
+
+  QString header = QString("View Resources: %1 allocated, %2 released, %3 shared values only, %4 KiB geometry")
+                       .arg(allocatedCount)
+                       .arg(releasedCount)
+                       .arg(sharedCount)
+                       .arg(geometrySize);
+  lines.prepend(header);
+  return lines.join("\n");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewModel::isFilterVisible(VSAbstractFilter* filter) const
+{
+  auto iter = m_FilterViewSettings.find(filter);
+  if(iter != m_FilterViewSettings.end() && iter->second)
+  {
+    return iter->second->isVisible();
+  }
+
+  VSFilterViewSettings::ValuesPointer values = findSharedValues(filter);
+  if(values)
+  {
+    return values->m_Visible;
+  }
+
+  return false;
 }
 
 // -----------------------------------------------------------------------------
@@ -210,7 +435,14 @@ VSFilterViewSettings* VSFilterViewModel::getFilterViewSettings(VSAbstractFilter*
     return nullptr;
   }
 
-  VSFilterViewSettings* settings = m_FilterViewSettings[filter];
+  auto iter = m_FilterViewSettings.find(filter);
+  if(iter != m_FilterViewSettings.end() && iter->second)
+  {
+    return iter->second;
+  }
+
+  // Copy the shared values on first use
+  VSFilterViewSettings* settings = createFromSharedValues(filter);
   if(nullptr == settings)
   {
     settings = createFilterViewSettings(filter);
@@ -263,13 +495,16 @@ VSFilterViewSettings* VSFilterViewModel::createFilterViewSettings(VSAbstractFilt
   }
 
   // Do not overwrite filter view settings that already exist
-  if(nullptr != m_FilterViewSettings[filter])
+  auto iter = m_FilterViewSettings.find(filter);
+  if(iter != m_FilterViewSettings.end() && iter->second)
   {
-    return m_FilterViewSettings[filter];
+    return iter->second;
   }
 
   VSFilterViewSettings* viewSettings = new VSFilterViewSettings(filter);
   m_FilterViewSettings[filter] = viewSettings;
+  m_ChangedFilters.insert(filter);
+  trackValueChanges(viewSettings);
 
   if(filter->getParentFilter() && filter->getParentFilter()->getOutput())
   {
@@ -296,6 +531,7 @@ void VSFilterViewModel::clearFilterViewSettings()
   }
 
   m_FilterViewSettings.clear();
+  m_ChangedFilters.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -307,18 +543,24 @@ void VSFilterViewModel::removeFilterViewSettings(VSAbstractFilter* filter)
   {
     return;
   }
-  if(m_FilterViewSettings.find(filter) == m_FilterViewSettings.end())
+
+  // The filter may only exist in the shared values, and its address may be reused
+  pruneSharedValues(filter);
+  m_ChangedFilters.erase(filter);
+
+  auto iter = m_FilterViewSettings.find(filter);
+  if(iter == m_FilterViewSettings.end())
   {
     return;
   }
 
-  VSFilterViewSettings* viewSettings = m_FilterViewSettings[filter];
+  VSFilterViewSettings* viewSettings = iter->second;
+  m_FilterViewSettings.erase(iter);
   if(viewSettings)
   {
     viewSettings->setVisible(false);
 
     emit viewSettingsRemoved(viewSettings);
-    m_FilterViewSettings.erase(filter);
     viewSettings->deleteLater();
   }
 }
@@ -486,7 +728,19 @@ QModelIndexList VSFilterViewModel::getIndexesFromFilters(VSAbstractFilter::Filte
 // -----------------------------------------------------------------------------
 QVariant VSFilterViewModel::getFilterCheckState(const QModelIndex& index) const
 {
-  VSFilterViewSettings* targetSettings = getFilterViewSettingsByIndex(index);
+  VSAbstractFilter* filter = getFilterFromIndex(index);
+  if(nullptr == filter)
+  {
+    return QVariant();
+  }
+
+  // Avoid creating VSFilterViewSettings just to display the check state
+  if(m_FilterViewSettings.find(filter) == m_FilterViewSettings.end() && findSharedValues(filter))
+  {
+    return isFilterVisible(filter) ? Qt::Checked : Qt::Unchecked;
+  }
+
+  VSFilterViewSettings* targetSettings = getFilterViewSettings(filter);
   if(!targetSettings)
   {
     return QVariant();
@@ -510,7 +764,7 @@ bool VSFilterViewModel::setFilterCheckState(const QModelIndex& index, QVariant v
   }
 
   // Get View Settings
-  VSFilterViewSettings* targetSettings = (m_FilterViewSettings.find(targetFilter))->second;
+  VSFilterViewSettings* targetSettings = getFilterViewSettings(targetFilter);
   if(targetSettings)
   {
     targetSettings->setVisible(checkState == Qt::Checked);
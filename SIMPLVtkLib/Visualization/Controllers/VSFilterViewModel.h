@@ -35,6 +35,9 @@
 
 #pragma once
 
+#include <memory>
+#include <set>
+
 #include <QtCore/QAbstractItemModel>
 
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
@@ -82,7 +85,10 @@ public:
   void setFilterModel(VSFilterModel* filterModel);
 
   /**
-   * @brief Sets the VSFilterModel and deep copies the VSFilterViewSettings
+   * @brief Sets the VSFilterModel and shares the other model's view values.  The values
+   * are copied on write: VSFilterViewSettings are only created for visible filters and
+   * for filters accessed through getFilterViewSettings.  Hidden filters keep referencing
+   * the shared values until they are used.
    * @param model
    */
   void deepCopy(const VSFilterViewModel& model);
@@ -254,6 +260,26 @@ public:
    */
   std::vector<VSFilterViewSettings*> getAllFilterViewSettings() const;
 
+  /**
+   * @brief Creates VSFilterViewSettings for every filter that only exists in the shared values
+   */
+  void createAllFilterViewSettings() const;
+
+  /**
+   * @brief Returns a debug report listing the rendering resources allocated for each
+   * VSFilterViewSettings along with totals for allocated, released, and shared-only filters.
+   * @return
+   */
+  QString createResourceReport() const;
+
+  /**
+   * @brief Returns true if the given filter is visible in this view.  This does not create
+   * VSFilterViewSettings for filters that only exist in the shared values.
+   * @param filter
+   * @return
+   */
+  bool isFilterVisible(VSAbstractFilter* filter) const;
+
 signals:
   void viewSettingsCreated(VSFilterViewSettings*) const;
   void viewSettingsRemoved(VSFilterViewSettings*);
@@ -267,13 +293,34 @@ protected:
    */
   VSFilterViewSettings* createFilterViewSettings(VSAbstractFilter* filter) const;
 
+  /**
+   * @brief Creates VSFilterViewSettings for the given filter from the shared values.
+   * Returns nullptr if there are no shared values for the filter.
+   * @param filter
+   * @return
+   */
+  VSFilterViewSettings* createFromSharedValues(VSAbstractFilter* filter) const;
+
+  /**
+   * @brief Creates VSFilterViewSettings for each filter visible in the shared values.  Only
+   * filters with shared values are visited; every other filter is created on first access.
+   */
+  void createVisibleFilterViewSettings();
+
+  /**
+   * @brief Returns the shared values for the given filter or nullptr if there are none
+   * @param filter
+   * @return
+   */
+  VSFilterViewSettings::ValuesPointer findSharedValues(VSAbstractFilter* filter) const;
+
   /**
    * @brief Clears all VSFilterViewSettings
    */
   void clearFilterViewSettings();
 
   /**
-   * @brief Removes the VSFilterViewSetting for the given filter.
+   * @brief Removes the VSFilterViewSetting for the given filter along with its shared values.
    * @aram filter
    * @return
    */
@@ -308,8 +355,46 @@ protected:
   void filterVisibilityChanged();
 
 private:
+  /**
+   * @brief Layer of view values shared between split views.  Each layer holds the values
+   * that changed in the view it was created from since its previous layer and falls back
+   * to its parent layer for everything else.  Values are never changed once the layer is
+   * shared, but filters removed from the VSFilterModel are erased from every layer.
+   */
+  struct SharedValuesLayer
+  {
+    std::shared_ptr<SharedValuesLayer> m_Parent;
+    VSFilterViewSettings::ValuesMap m_Values;
+    int m_Depth = 1;
+  };
+
+  using SharedValuesPointer = std::shared_ptr<SharedValuesLayer>;
+
+  /**
+   * @brief Returns a shared layer containing this model's current view values.  Filters
+   * changed since the last layer are moved into a new layer that this model also uses,
+   * so every split starts from an empty set of changes.  Once the chain grows too deep
+   * the new layer is flattened into a single layer without a parent.
+   * @return
+   */
+  SharedValuesPointer createSharedValues() const;
+
+  /**
+   * @brief Erases the given filter from every shared layer
+   * @param filter
+   */
+  void pruneSharedValues(VSAbstractFilter* filter);
+
+  /**
+   * @brief Records changes to the given VSFilterViewSettings for the next shared layer
+   * @param viewSettings
+   */
+  void trackValueChanges(VSFilterViewSettings* viewSettings) const;
+
   VSFilterModel* m_FilterModel = nullptr;
   mutable VSFilterViewSettings::Map m_FilterViewSettings;
+  mutable SharedValuesPointer m_SharedValues = nullptr;
+  mutable std::set<VSAbstractFilter*> m_ChangedFilters;
 };
 
 Q_DECLARE_METATYPE(VSFilterViewModel)
@@ -35,11 +35,15 @@
 
 #include "VSFilterViewSettings.h"
 
+#include <algorithm>
+
+#include <QtCore/QRegExp>
 #include <QtWidgets/QColorDialog>
 #include <QtWidgets/QInputDialog>
 
 #include <vtkAbstractArray.h>
 #include <vtkActor.h>
+#include <vtkAlgorithm.h>
 #include <vtkCellData.h>
 #include <vtkColorTransferFunction.h>
 #include <vtkDataSetMapper.h>
@@ -47,11 +51,16 @@
 #include <vtkImageData.h>
 #include <vtkImageProperty.h>
 #include <vtkImageSliceMapper.h>
+#include <vtkInformation.h>
+#include <vtkInformationDoubleVectorKey.h>
+#include <vtkInformationIdTypeKey.h>
+#include <vtkInformationObjectBaseKey.h>
 #include <vtkMapper.h>
 #include <vtkPointData.h>
 #include <vtkProperty.h>
 #include <vtkTextProperty.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
 
@@ -59,6 +68,52 @@ double* VSFilterViewSettings::NULL_COLOR = new double[3]{ 0.0, 0.0, 0.0 };
 QIcon* VSFilterViewSettings::m_SolidColorIcon = nullptr;
 QIcon* VSFilterViewSettings::m_CellDataIcon = nullptr;
 QIcon* VSFilterViewSettings::m_PointDataIcon = nullptr;
+int VSFilterViewSettings::m_ResourceReleaseDelay = 30000;
+const double VSFilterViewSettings::CategoricalIdThreshold = 1024.0;
+
+namespace
+{
+/**
+ * @brief Stores the last generated IPF colors in the Euler angle array's information
+ * @return
+ */
+vtkInformationObjectBaseKey* IPFColorsKey()
+{
+  static vtkInformationObjectBaseKey* key = new vtkInformationObjectBaseKey("IPF_COLORS", "VSFilterViewSettings", "vtkUnsignedCharArray");
+  return key;
+}
+
+/**
+ * @brief Stores the reference direction in the IPF color array's information
+ * @return
+ */
+vtkInformationDoubleVectorKey* IPFDirectionKey()
+{
+  static vtkInformationDoubleVectorKey* key = new vtkInformationDoubleVectorKey("IPF_DIRECTION", "VSFilterViewSettings", 3);
+  return key;
+}
+
+/**
+ * @brief Stores the phase array the IPF colors were generated with
+ * @return
+ */
+vtkInformationObjectBaseKey* IPFPhasesKey()
+{
+  static vtkInformationObjectBaseKey* key = new vtkInformationObjectBaseKey("IPF_PHASES", "VSFilterViewSettings", "vtkDataArray");
+  return key;
+}
+
+/**
+ * @brief Stores the latest modification time of the Euler angles and phases the IPF
+ * colors were generated from
+ * @return
+ */
+vtkInformationIdTypeKey* IPFSourceTimeKey()
+{
+  static vtkInformationIdTypeKey* key = new vtkInformationIdTypeKey("IPF_SOURCE_TIME", "VSFilterViewSettings");
+  return key;
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -71,6 +126,7 @@ VSFilterViewSettings::VSFilterViewSettings()
 , m_Representation(Representation::Invalid)
 {
   setupStaticIcons();
+  setupValueTracking();
 }
 
 // -----------------------------------------------------------------------------
@@ -81,9 +137,9 @@ VSFilterViewSettings::VSFilterViewSettings(VSAbstractFilter* filter)
 , m_ShowFilter(true)
 {
   setupStaticIcons();
+  setupValueTracking();
 
   connectFilter(filter);
-  setupActions();
   bool isSIMPL = dynamic_cast<VSSIMPLDataContainerFilter*>(filter);
   setupActors(isSIMPL);
   if(false == isSIMPL)
@@ -92,6 +148,42 @@ VSFilterViewSettings::VSFilterViewSettings(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewSettings::VSFilterViewSettings(VSAbstractFilter* filter, const ValuesPointer& values)
+: QObject(nullptr)
+, m_ShowFilter(values->m_Visible)
+, m_ActiveArrayName(values->m_ActiveArrayName)
+, m_ActiveComponent(values->m_ActiveComponent)
+, m_MapColors(values->m_MapColors)
+, m_Alpha(values->m_Alpha)
+{
+  setupStaticIcons();
+  setupValueTracking();
+
+  connectFilter(filter);
+
+  // Hidden filters do not create their rendering resources until they are first shown
+  if(values->m_Visible || values->m_Selected)
+  {
+    setupActors();
+    applyValues(*values);
+  }
+  else
+  {
+    m_Representation = values->m_Representation;
+    m_ScalarBarSetting = values->m_ScalarBarSetting;
+    m_ScalarBarVisible = values->m_ScalarBarVisible;
+    m_GridVisible = values->m_GridVisible;
+    m_ReleasedValues = values;
+  }
+
+  // The shared record still describes this view until one of its values changes
+  m_Values = values;
+  m_ValuesLookupTable = values->m_LookupTable;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -103,8 +195,8 @@ VSFilterViewSettings::VSFilterViewSettings(const VSFilterViewSettings& copy)
   , m_MapColors(copy.m_MapColors)
   , m_Alpha(copy.m_Alpha)
 {
+  setupValueTracking();
   connectFilter(copy.m_Filter);
-  setupActions();
   setupActors();
   setScalarBarVisible(copy.isScalarBarVisible());
   setRepresentation(copy.getRepresentation());
@@ -157,6 +249,323 @@ void VSFilterViewSettings::deepCopy(VSFilterViewSettings* target)
   setPointSize(target->getPointSize());
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewSettings::ValuesPointer VSFilterViewSettings::getValues() const
+{
+  if(isReleased())
+  {
+    return m_ReleasedValues;
+  }
+  if(m_Values)
+  {
+    return m_Values;
+  }
+
+  std::shared_ptr<Values> values = std::make_shared<Values>();
+  values->m_Visible = m_ShowFilter;
+  values->m_ActiveArrayName = m_ActiveArrayName;
+  values->m_ActiveComponent = m_ActiveComponent;
+  values->m_MapColors = m_MapColors;
+  values->m_Representation = getRepresentation();
+  values->m_Alpha = m_Alpha;
+  values->m_ScalarBarSetting = m_ScalarBarSetting;
+  values->m_ScalarBarVisible = isScalarBarVisible();
+  values->m_GridVisible = m_GridVisible;
+  values->m_Selected = m_Selected;
+  values->m_SolidColor = getSolidColor();
+  values->m_PointSize = getPointSize();
+  values->m_IPFDirection = m_IPFDirection;
+  values->m_LookupTableMode = m_LookupTableMode;
+
+  if(m_LookupTable)
+  {
+    if(nullptr == m_ValuesLookupTable)
+    {
+      m_ValuesLookupTable.reset(m_LookupTable->deepCopy());
+    }
+    values->m_LookupTable = m_ValuesLookupTable;
+  }
+
+  m_Values = values;
+  return values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setupValueTracking()
+{
+  connect(this, &VSFilterViewSettings::visibilityChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::gridVisibilityChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::pointSizeChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::alphaChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::showScalarBarChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::scalarBarSettingChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::representationChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::mapColorsChanged, this, [=] { invalidateValues(); });
+  connect(this, &VSFilterViewSettings::solidColorChanged, this, [=] { invalidateValues(); });
+
+  // These also rescale or replace the lookup table
+  connect(this, &VSFilterViewSettings::activeArrayNameChanged, this, [=] { invalidateValues(true); });
+  connect(this, &VSFilterViewSettings::activeComponentIndexChanged, this, [=] { invalidateValues(true); });
+  connect(this, &VSFilterViewSettings::lookupTableModeChanged, this, [=] { invalidateValues(true); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::invalidateValues(bool lookupTable)
+{
+  m_Values = nullptr;
+  if(lookupTable)
+  {
+    m_ValuesLookupTable = nullptr;
+  }
+
+  emit valuesChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::applyValues(const Values& values)
+{
+  setVisible(values.m_Visible);
+  m_LookupTableMode = values.m_LookupTableMode;
+  if(values.m_ActiveArrayName == VSIPFColorGenerator::ArrayName(values.m_IPFDirection))
+  {
+    setIPFColoring(values.m_IPFDirection);
+  }
+  else
+  {
+    setActiveArrayName(values.m_ActiveArrayName);
+  }
+  setActiveComponentIndex(values.m_ActiveComponent);
+  setMapColors(values.m_MapColors);
+  setScalarBarVisible(values.m_ScalarBarVisible);
+  setScalarBarSetting(values.m_ScalarBarSetting);
+  m_Selected = values.m_Selected;
+  setAlpha(values.m_Alpha);
+  setSolidColor(values.m_SolidColor);
+  setRepresentation(values.m_Representation);
+  setPointSize(values.m_PointSize);
+  setGridVisible(values.m_GridVisible);
+
+  if(m_LookupTable && values.m_LookupTable)
+  {
+    m_LookupTable->copy(*(values.m_LookupTable));
+  }
+
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::createResources()
+{
+  if(m_ReleaseTimer)
+  {
+    m_ReleaseTimer->stop();
+  }
+
+  if(nullptr == m_Filter)
+  {
+    return;
+  }
+
+  if(isReleased())
+  {
+    ValuesPointer values = m_ReleasedValues;
+    m_ReleasedValues = nullptr;
+
+    setupActors(false);
+    applyValues(*values);
+    m_Values = values;
+    m_ValuesLookupTable = values->m_LookupTable;
+  }
+  else if(false == isValid())
+  {
+    bool isSIMPL = dynamic_cast<VSSIMPLDataContainerFilter*>(m_Filter);
+    setupActors(isSIMPL);
+    if(false == isSIMPL)
+    {
+      setRepresentation(Representation::Default);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::releaseResources()
+{
+  if(isReleased() || false == isValid() || m_ShowFilter || m_Selected)
+  {
+    return;
+  }
+
+  if(m_ReleaseTimer)
+  {
+    m_ReleaseTimer->stop();
+  }
+
+  ValuesPointer values = getValues();
+
+  if(m_ScalarBarWidget)
+  {
+    m_ScalarBarWidget->SetEnabled(0);
+  }
+
+  m_Mapper = nullptr;
+  m_Actor = nullptr;
+  m_RenderGeometry = nullptr;
+  m_ScalarBarWidget = nullptr;
+  m_ScalarBarActor = nullptr;
+  m_CubeAxesActor = nullptr;
+  m_CategoricalTable = nullptr;
+  m_IndexedTable = nullptr;
+  m_CategoricalColors = false;
+  m_ActorType = ActorType::Invalid;
+
+  // IPF colors are found again or regenerated when the view is shown
+  m_IPFColors = nullptr;
+
+  if(m_LookupTable)
+  {
+    delete m_LookupTable;
+    m_LookupTable = nullptr;
+  }
+
+  // Actions are recreated the next time they are requested
+  if(m_SetColorAction)
+  {
+    m_SetColorAction->deleteLater();
+    m_SetColorAction = nullptr;
+  }
+  if(m_SetOpacityAction)
+  {
+    m_SetOpacityAction->deleteLater();
+    m_SetOpacityAction = nullptr;
+  }
+  if(m_ToggleScalarBarAction)
+  {
+    m_ToggleScalarBarAction->deleteLater();
+    m_ToggleScalarBarAction = nullptr;
+  }
+
+  m_ReleasedValues = values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::isReleased() const
+{
+  return nullptr != m_ReleasedValues;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::scheduleResourceRelease()
+{
+  if(m_ShowFilter || m_Selected || m_ResourceReleaseDelay < 0 || false == isValid())
+  {
+    if(m_ReleaseTimer)
+    {
+      m_ReleaseTimer->stop();
+    }
+    return;
+  }
+
+  if(nullptr == m_ReleaseTimer)
+  {
+    m_ReleaseTimer = new QTimer(this);
+    m_ReleaseTimer->setSingleShot(true);
+    connect(m_ReleaseTimer, &QTimer::timeout, this, &VSFilterViewSettings::releaseResources);
+  }
+
+  m_ReleaseTimer->start(m_ResourceReleaseDelay);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSFilterViewSettings::getResourceMemorySize() const
+{
+  if(nullptr == m_RenderGeometry)
+  {
+    return 0;
+  }
+
+  unsigned long size = m_RenderGeometry->getMemorySize();
+  if(m_IPFColors)
+  {
+    size += m_IPFColors->GetActualMemorySize();
+  }
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSFilterViewSettings::getResourceReport() const
+{
+  QStringList resources;
+  if(m_Mapper)
+  {
+    resources << "Mapper";
+  }
+  if(m_Actor)
+  {
+    resources << "Actor";
+  }
+  if(m_LookupTable)
+  {
+    resources << "LookupTable";
+  }
+  if(m_ScalarBarWidget)
+  {
+    resources << "ScalarBar";
+  }
+  if(m_CubeAxesActor)
+  {
+    resources << "CubeAxes";
+  }
+  if(m_SetColorAction || m_SetOpacityAction || m_ToggleScalarBarAction)
+  {
+    resources << "Actions";
+  }
+
+  QString state = isReleased() ? "Released" : (isValid() ? "Allocated" : "Empty");
+  QString report = QString("%1 [%2%3]: %4").arg(getFilterName()).arg(state).arg(m_ShowFilter ? ", Visible" : "").arg(resources.isEmpty() ? "None" : resources.join(", "));
+  if(m_RenderGeometry)
+  {
+    report += QString(" | Geometry %1 KiB shared by %2 view(s)").arg(m_RenderGeometry->getMemorySize()).arg(m_RenderGeometry.use_count());
+  }
+
+  return report;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::SetResourceReleaseDelay(int msec)
+{
+  m_ResourceReleaseDelay = msec;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSFilterViewSettings::GetResourceReleaseDelay()
+{
+  return m_ResourceReleaseDelay;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -270,7 +679,7 @@ void VSFilterViewSettings::setupActions()
 
   m_ToggleScalarBarAction = new QAction("Enable Scalar Bar", this);
   m_ToggleScalarBarAction->setCheckable(true);
-  m_ToggleScalarBarAction->setChecked(false);
+  m_ToggleScalarBarAction->setChecked(m_ScalarBarVisible);
   connect(m_ToggleScalarBarAction, &QAction::toggled, [=](bool checked) { setScalarBarVisible(checked); });
 }
 
@@ -351,6 +760,10 @@ QStringList VSFilterViewSettings::getArrayNames() const
   {
     QStringList arrayNames = m_Filter->getArrayNames();
     arrayNames.prepend("Solid Colors");
+    if(m_IPFColors && false == arrayNames.contains(m_IPFColors->GetName()))
+    {
+      arrayNames.push_back(m_IPFColors->GetName());
+    }
     return arrayNames;
   }
 
@@ -452,6 +865,219 @@ bool VSFilterViewSettings::hasMulipleComponents()
   return numComp > 1;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::hasOrientationData() const
+{
+  return nullptr != getEulerAngles();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSIPFColorGenerator::Direction VSFilterViewSettings::getIPFReferenceDirection() const
+{
+  return m_IPFDirection;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataArray* VSFilterViewSettings::getEulerAngles() const
+{
+  if(nullptr == m_Filter || nullptr == m_Filter->getOutput())
+  {
+    return nullptr;
+  }
+
+  vtkDataSet* dataSet = m_Filter->getOutput();
+  vtkDataSetAttributes* attributes = isPointData() ? static_cast<vtkDataSetAttributes*>(dataSet->GetPointData()) : dataSet->GetCellData();
+  if(nullptr == attributes)
+  {
+    return nullptr;
+  }
+
+  // DREAM3D names the array EulerAngles but renamed arrays are still recognized
+  vtkDataArray* eulers = attributes->GetArray("EulerAngles");
+  if(VSIPFColorGenerator::IsEulerArray(eulers))
+  {
+    return eulers;
+  }
+
+  int numArrays = attributes->GetNumberOfArrays();
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkDataArray* array = attributes->GetArray(i);
+    if(array && array->GetName() && QString(array->GetName()).contains("Euler", Qt::CaseInsensitive) && VSIPFColorGenerator::IsEulerArray(array))
+    {
+      return array;
+    }
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataArray* VSFilterViewSettings::getPhases() const
+{
+  vtkDataSet* dataSet = m_Filter->getOutput();
+  vtkDataSetAttributes* attributes = isPointData() ? static_cast<vtkDataSetAttributes*>(dataSet->GetPointData()) : dataSet->GetCellData();
+  if(nullptr == attributes)
+  {
+    return nullptr;
+  }
+
+  // DREAM3D filters let the phase array be renamed, so any integer array named for phases is used
+  int numArrays = attributes->GetNumberOfArrays();
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkDataArray* array = attributes->GetArray(i);
+    if(nullptr == array || nullptr == array->GetName() || 1 != array->GetNumberOfComponents())
+    {
+      continue;
+    }
+
+    const int dataType = array->GetDataType();
+    if(VTK_FLOAT != dataType && VTK_DOUBLE != dataType && QString(array->GetName()).contains("Phase", Qt::CaseInsensitive))
+    {
+      return array;
+    }
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkUnsignedCharArray) VSFilterViewSettings::getIPFColors(const VSIPFColorGenerator::Direction& direction)
+{
+  vtkDataArray* eulers = getEulerAngles();
+  if(nullptr == eulers)
+  {
+    return nullptr;
+  }
+
+  vtkDataArray* phases = getPhases();
+
+  // Stored colors are only valid for the direction, Euler angles, and phases they were generated from
+  vtkMTimeType sourceTime = eulers->GetMTime();
+  if(phases)
+  {
+    sourceTime = std::max(sourceTime, phases->GetMTime());
+  }
+
+  vtkUnsignedCharArray* storedColors = vtkUnsignedCharArray::SafeDownCast(eulers->GetInformation()->Get(IPFColorsKey()));
+  if(storedColors && storedColors->GetNumberOfTuples() == eulers->GetNumberOfTuples())
+  {
+    vtkInformation* info = storedColors->GetInformation();
+    const double* storedDirection = info->Get(IPFDirectionKey());
+    if(storedDirection && std::equal(direction.begin(), direction.end(), storedDirection) && info->Get(IPFPhasesKey()) == phases &&
+       static_cast<vtkMTimeType>(info->Get(IPFSourceTimeKey())) == sourceTime)
+    {
+      return storedColors;
+    }
+  }
+
+  VSIPFColorGenerator generator;
+  generator.setEulerAngles(eulers);
+  generator.setPhases(phases);
+
+  // Crystal structures are ensemble data and are not part of the vtkDataSet
+  VSAbstractFilter* dataFilter = m_Filter;
+  while(dataFilter && nullptr == dynamic_cast<VSSIMPLDataContainerFilter*>(dataFilter))
+  {
+    dataFilter = dataFilter->getParentFilter();
+  }
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(dataFilter);
+  if(dcFilter && dcFilter->getWrappedDataContainer())
+  {
+    generator.setCrystalStructures(VSIPFColorGenerator::FindCrystalStructures(dcFilter->getWrappedDataContainer()->m_DataContainer));
+  }
+
+  VTK_PTR(vtkUnsignedCharArray) colors = generator.generate(direction);
+  if(colors)
+  {
+    // Only the latest colors are kept with the output.  Views showing other directions keep their own.
+    vtkInformation* info = colors->GetInformation();
+    info->Set(IPFDirectionKey(), direction.data(), 3);
+    info->Set(IPFPhasesKey(), phases);
+    info->Set(IPFSourceTimeKey(), static_cast<vtkIdType>(sourceTime));
+    eulers->GetInformation()->Set(IPFColorsKey(), colors);
+  }
+  return colors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::isColoringByIPF() const
+{
+  return !m_ActiveArrayName.isNull() && m_ActiveArrayName == VSIPFColorGenerator::ArrayName(m_IPFDirection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::restoreIPFColors()
+{
+  if(false == isColoringByIPF() || nullptr == m_RenderGeometry || m_RenderGeometry->isShared())
+  {
+    return;
+  }
+
+  // Colors that no longer match the output are skipped by the render geometry
+  m_IPFColors = getIPFColors(m_IPFDirection);
+  m_RenderGeometry->setAdditionalArray(m_IPFColors, isPointData());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::clearIPFColors()
+{
+  if(nullptr == m_IPFColors)
+  {
+    return;
+  }
+
+  m_IPFColors = nullptr;
+  if(m_RenderGeometry && false == m_RenderGeometry->isShared())
+  {
+    useRenderGeometry(VSRenderGeometry::Acquire(m_Filter));
+  }
+
+  emit arrayNamesChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::useRenderGeometry(VSRenderGeometry::Pointer geometry)
+{
+  m_RenderGeometry = geometry;
+  m_RenderGeometry->updateInputPort(m_Filter);
+
+  vtkDataSetMapper* mapper = getDataSetMapper();
+  if(nullptr == mapper)
+  {
+    return;
+  }
+
+  if(getRepresentation() == Representation::Outline)
+  {
+    mapper->SetInputConnection(m_RenderGeometry->getOutlineOutputPort());
+  }
+  else
+  {
+    mapper->SetInputConnection(m_RenderGeometry->getSurfaceOutputPort());
+  }
+  m_RenderGeometry->updateSurface();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -460,6 +1086,22 @@ VSFilterViewSettings::ColorMapping VSFilterViewSettings::getMapColors()
   return m_MapColors;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSFilterViewSettings::LookupTableMode VSFilterViewSettings::getLookupTableMode() const
+{
+  return m_LookupTableMode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFilterViewSettings::isUsingCategoricalColors() const
+{
+  return m_CategoricalColors;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -473,7 +1115,7 @@ double VSFilterViewSettings::getAlpha()
 // -----------------------------------------------------------------------------
 bool VSFilterViewSettings::isScalarBarVisible() const
 {
-  return m_ScalarBarWidget && m_ToggleScalarBarAction->isChecked();
+  return m_ScalarBarWidget && m_ScalarBarVisible;
 }
 
 // -----------------------------------------------------------------------------
@@ -514,8 +1156,18 @@ void VSFilterViewSettings::setScalarBarSetting(ScalarBarSetting setting)
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::setIsSelected(bool selected)
 {
-  m_Selected = selected;
+  if(selected)
+  {
+    createResources();
+  }
+
+  if(selected != m_Selected)
+  {
+    m_Selected = selected;
+    invalidateValues();
+  }
   updateScalarBarVisibility();
+  scheduleResourceRelease();
 }
 
 // -----------------------------------------------------------------------------
@@ -615,14 +1267,27 @@ void VSFilterViewSettings::hide()
 // -----------------------------------------------------------------------------
 void VSFilterViewSettings::setVisible(bool visible)
 {
+  if(visible)
+  {
+    createResources();
+  }
+
   if(false == isValid())
   {
     return;
   }
 
   m_ShowFilter = visible;
+  m_Filter->setDisplayedBy(this, visible);
+
+  // Input changes received while hidden are applied once the filter is shown again
+  if(m_ShowFilter && m_InputPortPending)
+  {
+    updateInputPort(m_Filter);
+  }
 
   emit visibilityChanged(m_ShowFilter);
+  scheduleResourceRelease();
 }
 
 // -----------------------------------------------------------------------------
@@ -693,6 +1358,12 @@ vtkDataArray* VSFilterViewSettings::getArrayAtIndex(int index)
 // -----------------------------------------------------------------------------
 vtkDataArray* VSFilterViewSettings::getArrayByName(QString name) const
 {
+  // IPF colors are only part of this view's render geometry
+  if(m_IPFColors && name == m_IPFColors->GetName())
+  {
+    return m_IPFColors;
+  }
+
   vtkDataSet* dataSet = m_Filter->getOutput();
   if(nullptr == dataSet)
   {
@@ -730,6 +1401,7 @@ void VSFilterViewSettings::setActiveArrayName(QString name)
   // Check for Solid Color
   if(name.isNull())
   {
+    clearIPFColors();
     getDataSetMapper()->SelectColorArray(-1);
     m_ActiveArrayName = QString::null;
 
@@ -747,6 +1419,10 @@ void VSFilterViewSettings::setActiveArrayName(QString name)
     return;
   }
 
+  if(dataArray != m_IPFColors)
+  {
+    clearIPFColors();
+  }
   m_ActiveArrayName = name;
 
   emit activeArrayNameChanged(m_ActiveArrayName);
@@ -793,6 +1469,7 @@ void VSFilterViewSettings::setActiveComponentIndex(int index)
   // Set array component index in the vtkDataSetMapper
   int numComponents = dataArray->GetNumberOfComponents();
   mapper->ColorByArrayComponent(qPrintable(m_ActiveArrayName), index);
+  updateLookupTable();
   mapper->Update();
   updateColorMode();
 
@@ -822,6 +1499,42 @@ void VSFilterViewSettings::setActiveComponentIndex(int index)
   emit activeComponentIndexChanged(m_ActiveComponent);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setIPFColoring(const VSIPFColorGenerator::Direction& direction)
+{
+  if(nullptr == getDataSetMapper())
+  {
+    return;
+  }
+
+  VTK_PTR(vtkUnsignedCharArray) colors = getIPFColors(direction);
+  if(nullptr == colors)
+  {
+    return;
+  }
+
+  // Other views and filters share the output, so the colors are added to this view's own geometry
+  m_IPFColors = colors;
+  m_IPFDirection = direction;
+  if(nullptr == m_RenderGeometry || m_RenderGeometry->isShared())
+  {
+    VSRenderGeometry::Pointer geometry = VSRenderGeometry::Create(m_Filter);
+    geometry->setAdditionalArray(colors, isPointData());
+    useRenderGeometry(geometry);
+  }
+  else
+  {
+    m_RenderGeometry->setAdditionalArray(colors, isPointData());
+    m_RenderGeometry->updateSurface();
+  }
+
+  emit arrayNamesChanged();
+  setActiveArrayName(QString(colors->GetName()));
+  emit requiresRender();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -930,6 +1643,80 @@ void VSFilterViewSettings::setMapColors(ColorMapping mapColors)
   emit requiresRender();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::setLookupTableMode(LookupTableMode mode)
+{
+  if(false == isValid())
+  {
+    return;
+  }
+
+  m_LookupTableMode = mode;
+
+  updateLookupTable();
+  updateColorMode();
+  emit lookupTableModeChanged(m_LookupTableMode);
+  emit requiresRender();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFilterViewSettings::updateLookupTable()
+{
+  vtkDataSetMapper* mapper = getDataSetMapper();
+  if(nullptr == mapper || nullptr == m_LookupTable)
+  {
+    return;
+  }
+
+  vtkDataArray* dataArray = getDataArray();
+  int component = (dataArray && dataArray->GetNumberOfComponents() == 1) ? 0 : m_ActiveComponent;
+
+  bool categorical = false;
+  switch(m_LookupTableMode)
+  {
+  case LookupTableMode::Categorical:
+    categorical = (nullptr != dataArray) && (component >= 0);
+    break;
+  case LookupTableMode::Automatic:
+    categorical = VSCategoricalLookupTable::IsCategoricalArray(dataArray, component, CategoricalIdThreshold);
+    break;
+  case LookupTableMode::Continuous:
+  default:
+    break;
+  }
+
+  if(categorical)
+  {
+    if(nullptr == m_CategoricalTable)
+    {
+      m_CategoricalTable = VTK_PTR(VSCategoricalLookupTable)::New();
+    }
+
+    double range[2];
+    dataArray->GetRange(range, component);
+    m_CategoricalTable->SetRange(range[0], range[1]);
+  }
+  vtkScalarsToColors* lookupTable = categorical ? static_cast<vtkScalarsToColors*>(m_CategoricalTable) : m_LookupTable->getColorTransferFunction().Get();
+
+  // Feature and ensemble arrays are colored once per feature instead of once per cell
+  if(dynamic_cast<VSIndexedArray*>(dataArray))
+  {
+    if(nullptr == m_IndexedTable)
+    {
+      m_IndexedTable = VTK_PTR(VSIndexedLookupTable)::New();
+    }
+    m_IndexedTable->SetLookupTable(lookupTable);
+    lookupTable = m_IndexedTable;
+  }
+  mapper->SetLookupTable(lookupTable);
+
+  m_CategoricalColors = categorical;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1005,6 +1792,7 @@ void VSFilterViewSettings::invertScalarBar()
   }
 
   m_LookupTable->invert();
+  invalidateValues(true);
   emit requiresRender();
 }
 
@@ -1019,6 +1807,7 @@ void VSFilterViewSettings::loadPresetColors(const QJsonObject& colors)
   }
 
   m_LookupTable->parseRgbJson(colors);
+  invalidateValues(true);
   emit requiresRender();
 }
 
@@ -1045,7 +1834,11 @@ void VSFilterViewSettings::setScalarBarVisible(bool visible)
     return;
   }
 
-  m_ToggleScalarBarAction->setChecked(visible);
+  m_ScalarBarVisible = visible;
+  if(m_ToggleScalarBarAction)
+  {
+    m_ToggleScalarBarAction->setChecked(visible);
+  }
   emit showScalarBarChanged(visible);
 }
 
@@ -1065,7 +1858,8 @@ void VSFilterViewSettings::updateScalarBarVisibility()
     return;
   }
 
-  if(false == isMappingColors())
+  // A scalar bar has no meaning for randomly colored IDs
+  if(false == isMappingColors() || m_CategoricalColors)
   {
     setScalarBarVisible(false);
   }
@@ -1095,6 +1889,7 @@ void VSFilterViewSettings::setupActors(bool outline)
   if(nullptr == outputData)
   {
     m_ShowFilter = false;
+    m_Filter->setDisplayedBy(this, false);
     return;
   }
 
@@ -1230,8 +2025,8 @@ void VSFilterViewSettings::setupDataSetActors()
   vtkActor* actor;
   if(ActorType::Image2D == m_ActorType || nullptr == m_Actor)
   {
-    m_DataSetFilter = VTK_PTR(vtkDataSetSurfaceFilter)::New();
-    m_OutlineFilter = VTK_PTR(vtkOutlineFilter)::New();
+    // The surface and outline are shared with every other view of this filter
+    m_RenderGeometry = VSRenderGeometry::Acquire(m_Filter);
     mapper = vtkDataSetMapper::New();
     mapper->ReleaseDataFlagOn();
     actor = vtkActor::New();
@@ -1262,16 +2057,15 @@ void VSFilterViewSettings::setupDataSetActors()
     actor = vtkActor::SafeDownCast(m_Actor);
   }
 
-  m_DataSetFilter->SetInputConnection(m_Filter->getTransformedOutputPort());
-  m_OutlineFilter->SetInputConnection(m_Filter->getOutputPort());
+  m_RenderGeometry->updateInputPort(m_Filter);
 
   if(getRepresentation() == Representation::Outline)
   {
-    mapper->SetInputConnection(m_OutlineFilter->GetOutputPort());
+    mapper->SetInputConnection(m_RenderGeometry->getOutlineOutputPort());
   }
   else
   {
-    mapper->SetInputConnection(m_DataSetFilter->GetOutputPort());
+    mapper->SetInputConnection(m_RenderGeometry->getSurfaceOutputPort());
   }
   
   actor->SetMapper(mapper);
@@ -1352,10 +2146,19 @@ void VSFilterViewSettings::updateInputPort(VSAbstractFilter* filter)
     return;
   }
 
-  if(m_DataSetFilter)
+  if(m_RenderGeometry)
   {
-    m_DataSetFilter->SetInputConnection(filter->getTransformedOutputPort());
-    m_DataSetFilter->Update();
+    // Updating the surface executes the filter, so hidden filters wait until they are shown
+    if(false == m_ShowFilter)
+    {
+      m_InputPortPending = true;
+      return;
+    }
+
+    m_InputPortPending = false;
+    restoreIPFColors();
+    m_RenderGeometry->updateInputPort(filter);
+    m_RenderGeometry->updateSurface();
   }
   else
   {
@@ -1375,7 +2178,8 @@ void VSFilterViewSettings::updateTransform()
     return;
   }
 
-  if(ActorType::Image2D == m_ActorType || Representation::Outline == m_Representation)
+  bool localSurface = m_RenderGeometry && m_RenderGeometry->isSurfaceLocal();
+  if(ActorType::Image2D == m_ActorType || Representation::Outline == m_Representation || localSurface)
   {
     VSTransform* transform = m_Filter->getTransform();
     m_Actor->SetPosition(transform->getPosition());
@@ -1405,6 +2209,7 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
     disconnect(m_Filter, &VSAbstractFilter::arrayNamesChanged, this, &VSFilterViewSettings::arrayNamesChanged);
     disconnect(m_Filter, &VSAbstractFilter::scalarNamesChanged, this, &VSFilterViewSettings::scalarNamesChanged);
     disconnect(m_Filter, &VSAbstractFilter::dataImported, this, &VSFilterViewSettings::dataLoaded);
+    m_Filter->setDisplayedBy(this, false);
 
     if(dynamic_cast<VSAbstractDataFilter*>(m_Filter))
     {
@@ -1422,6 +2227,7 @@ void VSFilterViewSettings::connectFilter(VSAbstractFilter* filter)
     connect(filter, &VSAbstractFilter::arrayNamesChanged, this, &VSFilterViewSettings::arrayNamesChanged);
     connect(filter, &VSAbstractFilter::scalarNamesChanged, this, &VSFilterViewSettings::scalarNamesChanged);
     connect(filter, &VSAbstractFilter::dataImported, this, &VSFilterViewSettings::dataLoaded);
+    filter->setDisplayedBy(this, m_ShowFilter);
 
     if(filter->getArrayNames().size() < 1)
     {
@@ -1615,12 +2421,12 @@ void VSFilterViewSettings::setRepresentation(const Representation& type)
   m_Representation = type;
   if(type == Representation::Outline)
   {
-    getDataSetMapper()->SetInputConnection(m_OutlineFilter->GetOutputPort());
+    getDataSetMapper()->SetInputConnection(m_RenderGeometry->getOutlineOutputPort());
     actor->GetProperty()->SetRepresentation(static_cast<int>(Representation::Wireframe));
   }
   else
   {
-    getDataSetMapper()->SetInputConnection(m_DataSetFilter->GetOutputPort());
+    getDataSetMapper()->SetInputConnection(m_RenderGeometry->getSurfaceOutputPort());
 
     if(type == Representation::SurfaceWithEdges)
     {
@@ -1716,10 +2522,18 @@ void VSFilterViewSettings::copySettings(VSFilterViewSettings* copy)
   }
 
   setVisible(copy->m_ShowFilter);
-  setActiveArrayName(copy->m_ActiveArrayName);
+  m_LookupTableMode = copy->m_LookupTableMode;
+  if(copy->isColoringByIPF())
+  {
+    setIPFColoring(copy->m_IPFDirection);
+  }
+  else
+  {
+    setActiveArrayName(copy->m_ActiveArrayName);
+  }
   setActiveComponentIndex(copy->m_ActiveComponent);
   setMapColors(copy->m_MapColors);
-  setScalarBarVisible(copy->m_ToggleScalarBarAction->isChecked());
+  setScalarBarVisible(copy->m_ScalarBarVisible);
   setScalarBarSetting(copy->m_ScalarBarSetting);
   m_Selected = copy->m_Selected;
   setAlpha(copy->m_Alpha);
@@ -1730,6 +2544,7 @@ void VSFilterViewSettings::copySettings(VSFilterViewSettings* copy)
   if(hasUi && m_ScalarBarWidget)
   {
     m_LookupTable->copy(*(copy->m_LookupTable));
+    invalidateValues(true);
   }
 
   emit requiresRender();
@@ -1740,6 +2555,8 @@ void VSFilterViewSettings::copySettings(VSFilterViewSettings* copy)
 // -----------------------------------------------------------------------------
 QMenu* VSFilterViewSettings::getRepresentationMenu()
 {
+  createResources();
+
   QMenu* representationMenu = new QMenu("Representation");
 
   QAction* outlineAction = representationMenu->addAction("Outline");
@@ -1775,6 +2592,8 @@ QMenu* VSFilterViewSettings::getRepresentationMenu()
 // -----------------------------------------------------------------------------
 QMenu* VSFilterViewSettings::getColorByMenu()
 {
+  createResources();
+
   QMenu* arrayMenu = new QMenu("Colory By");
   QStringList arrayNames = getFilter()->getArrayNames();
   int numArrays = arrayNames.size();
@@ -1804,6 +2623,8 @@ QMenu* VSFilterViewSettings::getColorByMenu()
 // -----------------------------------------------------------------------------
 QMenu* VSFilterViewSettings::getArrayComponentMenu()
 {
+  createResources();
+
   QMenu* componentMenu = new QMenu("Array Component");
   QStringList componentList = m_Filter->getComponentList(getActiveArrayName());
   int count = componentList.size();
@@ -1829,6 +2650,8 @@ QMenu* VSFilterViewSettings::getArrayComponentMenu()
 // -----------------------------------------------------------------------------
 QMenu* VSFilterViewSettings::getMapScalarsMenu()
 {
+  createResources();
+
   QMenu* mapScalarsMenu = new QMenu("Map Scalars");
 
   QAction* mapAllAction = mapScalarsMenu->addAction("Always");
@@ -1849,11 +2672,76 @@ QMenu* VSFilterViewSettings::getMapScalarsMenu()
   return mapScalarsMenu;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMenu* VSFilterViewSettings::getIPFColorMenu()
+{
+  createResources();
+
+  QMenu* ipfMenu = new QMenu("IPF Colors");
+
+  const std::vector<std::pair<QString, VSIPFColorGenerator::Direction>> directions = {
+      {"Sample X [100]", {{1.0, 0.0, 0.0}}}, {"Sample Y [010]", {{0.0, 1.0, 0.0}}}, {"Sample Z [001]", {{0.0, 0.0, 1.0}}}};
+  bool customDirection = isColoringByIPF();
+  for(const auto& direction : directions)
+  {
+    VSIPFColorGenerator::Direction value = direction.second;
+    bool checked = isColoringByIPF() && m_IPFDirection == value;
+    customDirection = customDirection && !checked;
+
+    QAction* directionAction = ipfMenu->addAction(direction.first);
+    directionAction->setCheckable(true);
+    directionAction->setChecked(checked);
+    connect(directionAction, &QAction::triggered, [=] { setIPFColoring(value); });
+  }
+
+  ipfMenu->addSeparator();
+
+  QAction* customAction = ipfMenu->addAction("Custom Direction...");
+  customAction->setCheckable(true);
+  customAction->setChecked(customDirection);
+  connect(customAction, &QAction::triggered, [=] {
+    QString current = QString("%1 %2 %3").arg(m_IPFDirection[0]).arg(m_IPFDirection[1]).arg(m_IPFDirection[2]);
+    bool ok = false;
+    QString text = QInputDialog::getText(nullptr, "IPF Reference Direction", "Sample direction (x y z):", QLineEdit::Normal, current, &ok);
+    if(false == ok)
+    {
+      return;
+    }
+
+    QStringList values = text.split(QRegExp("[\\s,]+"), QString::SkipEmptyParts);
+    if(values.size() != 3)
+    {
+      return;
+    }
+
+    VSIPFColorGenerator::Direction direction;
+    for(int i = 0; i < 3; i++)
+    {
+      direction[i] = values[i].toDouble(&ok);
+      if(false == ok)
+      {
+        return;
+      }
+    }
+    setIPFColoring(direction);
+  });
+
+  return ipfMenu;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 QAction* VSFilterViewSettings::getSetColorAction()
 {
+  createResources();
+  if(nullptr == m_SetColorAction)
+  {
+    setupActions();
+  }
+
   return m_SetColorAction;
 }
 
@@ -1862,6 +2750,12 @@ QAction* VSFilterViewSettings::getSetColorAction()
 // -----------------------------------------------------------------------------
 QAction* VSFilterViewSettings::getSetOpacityAction()
 {
+  createResources();
+  if(nullptr == m_SetOpacityAction)
+  {
+    setupActions();
+  }
+
   return m_SetOpacityAction;
 }
 
@@ -1870,6 +2764,12 @@ QAction* VSFilterViewSettings::getSetOpacityAction()
 // -----------------------------------------------------------------------------
 QAction* VSFilterViewSettings::getToggleScalarBarAction()
 {
+  createResources();
+  if(nullptr == m_ToggleScalarBarAction)
+  {
+    setupActions();
+  }
+
   return m_ToggleScalarBarAction;
 }
 
@@ -36,9 +36,11 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <QtCore/QObject>
+#include <QtCore/QTimer>
 #include <QtGui/QColor>
 #include <QtGui/QIcon>
 #include <QtWidgets/QAction>
@@ -47,12 +49,14 @@
 #include <vtkAbstractMapper3D.h>
 #include <vtkActor.h>
 #include <vtkCubeAxesActor.h>
-#include <vtkDataSetSurfaceFilter.h>
-#include <vtkOutlineFilter.h>
 #include <vtkScalarBarActor.h>
 #include <vtkScalarBarWidget.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSIPFColorGenerator.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSCategoricalLookupTable.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSIndexedLookupTable.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSRenderGeometry.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -124,14 +128,55 @@ public:
     Never
   };
 
+  enum class LookupTableMode : int
+  {
+    Automatic = 0,
+    Continuous,
+    Categorical
+  };
+
   Q_ENUMS(Representation)
   Q_ENUMS(ActorType)
   Q_ENUMS(ColorMapping)
   Q_ENUMS(ScalarBarSetting)
+  Q_ENUMS(LookupTableMode)
 
   Q_PROPERTY(Representation representation READ getRepresentation WRITE setRepresentation NOTIFY representationChanged)
   Q_PROPERTY(ColorMapping mapColors READ getMapColors WRITE setMapColors NOTIFY mapColorsChanged)
   Q_PROPERTY(ScalarBarSetting scalarBarSetting READ getScalarBarSetting WRITE setScalarBarSetting NOTIFY scalarBarSettingChanged)
+  Q_PROPERTY(LookupTableMode lookupTableMode READ getLookupTableMode WRITE setLookupTableMode NOTIFY lookupTableModeChanged)
+
+  /**
+   * @brief Integer arrays covering at least this many IDs are colored categorically when
+   * the lookup table mode is Automatic
+   */
+  static const double CategoricalIdThreshold;
+
+  /**
+   * @brief Plain record of the user-facing view values.  Records are immutable once
+   * shared so that split views can reference the same record until one of them changes.
+   */
+  struct Values
+  {
+    bool m_Visible = true;
+    QString m_ActiveArrayName;
+    int m_ActiveComponent = -1;
+    ColorMapping m_MapColors = ColorMapping::NonColors;
+    Representation m_Representation = Representation::Default;
+    double m_Alpha = 1.0;
+    ScalarBarSetting m_ScalarBarSetting = ScalarBarSetting::OnSelection;
+    bool m_ScalarBarVisible = false;
+    bool m_GridVisible = false;
+    bool m_Selected = false;
+    QColor m_SolidColor;
+    int m_PointSize = 1;
+    VSIPFColorGenerator::Direction m_IPFDirection = {{0.0, 0.0, 1.0}};
+    LookupTableMode m_LookupTableMode = LookupTableMode::Automatic;
+    std::shared_ptr<VSLookupTableController> m_LookupTable;
+  };
+
+  using ValuesPointer = std::shared_ptr<const Values>;
+  using ValuesMap = std::map<VSAbstractFilter*, ValuesPointer>;
 
   VSFilterViewSettings();
 
@@ -141,6 +186,13 @@ public:
    */
   VSFilterViewSettings(VSAbstractFilter* filter);
 
+  /**
+   * @brief Constructor that applies a shared Values record instead of copying another VSFilterViewSettings
+   * @param filter
+   * @param values
+   */
+  VSFilterViewSettings(VSAbstractFilter* filter, const ValuesPointer& values);
+
   /**
    * @brief Copy constructor
    * @param copy
@@ -158,6 +210,64 @@ public:
    */
   void deepCopy(VSFilterViewSettings* target);
 
+  /**
+   * @brief Returns a snapshot of the current view values.  The snapshot is kept until
+   * the values change, and the lookup table is only copied again after it changes.
+   * @return
+   */
+  ValuesPointer getValues() const;
+
+  /**
+   * @brief Applies the given view values
+   * @param values
+   */
+  void applyValues(const Values& values);
+
+  /**
+   * @brief Creates the mapper, actor, lookup table, scalar bar, and render geometry
+   * if they have not been created yet or were released while the filter was hidden.
+   */
+  void createResources();
+
+  /**
+   * @brief Releases the mapper, actor, lookup table, scalar bar, render geometry,
+   * and QActions while keeping a snapshot of the current values for when they are
+   * created again.  Does nothing if the filter is visible or selected.
+   */
+  void releaseResources();
+
+  /**
+   * @brief Returns true if the rendering resources have been released
+   * @return
+   */
+  bool isReleased() const;
+
+  /**
+   * @brief Returns the approximate memory in kibibytes held by the rendering resources
+   * that are unique to this view.  The shared surface and outline are reported separately.
+   * @return
+   */
+  unsigned long getResourceMemorySize() const;
+
+  /**
+   * @brief Returns a single line describing which resources are allocated for debugging.
+   * @return
+   */
+  QString getResourceReport() const;
+
+  /**
+   * @brief Sets the number of milliseconds a hidden, unselected filter keeps its
+   * rendering resources before they are released.  Negative values disable releasing.
+   * @param msec
+   */
+  static void SetResourceReleaseDelay(int msec);
+
+  /**
+   * @brief Returns the number of milliseconds before a hidden filter's resources are released.
+   * @return
+   */
+  static int GetResourceReleaseDelay();
+
   /**
    * @brief Returns a pointer to the VSAbstractFilter
    * @return
@@ -257,12 +367,37 @@ public:
    */
   bool hasMulipleComponents();
 
+  /**
+   * @brief Returns true if the filter output has an Euler angle array that can be used
+   * for IPF coloring
+   * @return
+   */
+  bool hasOrientationData() const;
+
+  /**
+   * @brief Returns the sample reference direction last used for IPF coloring
+   * @return
+   */
+  VSIPFColorGenerator::Direction getIPFReferenceDirection() const;
+
   /**
    * @brief Returns the ColorMapping value for mapping filter values to a lookup table.
    * @return
    */
   ColorMapping getMapColors();
 
+  /**
+   * @brief Returns the lookup table mode
+   * @return
+   */
+  LookupTableMode getLookupTableMode() const;
+
+  /**
+   * @brief Returns true if the active array is mapped through the categorical lookup table
+   * @return
+   */
+  bool isUsingCategoricalColors() const;
+
   /**
    * @brief Returns tha alpha transparency used for the displaying the actor
    */
@@ -408,6 +543,12 @@ public:
    */
   QMenu* getMapScalarsMenu();
 
+  /**
+   * @brief Returns a QMenu for coloring by IPF colors along common reference directions
+   * @return
+   */
+  QMenu* getIPFColorMenu();
+
   /**
    * @brief Returns an action allowing the user to pick the solid color.
    * @return
@@ -479,12 +620,28 @@ public slots:
    */
   void setActiveComponentIndex(int index);
 
+  /**
+   * @brief Colors by the inverse pole figure colors for the given sample reference direction.
+   * The colors are generated from the Euler angles the first time a direction is used and
+   * kept until the Euler angles change.  The colors belong to this view and are added to its
+   * own copy of the render geometry, never to the filter output.
+   * @param direction
+   */
+  void setIPFColoring(const VSIPFColorGenerator::Direction& direction);
+
   /**
    * @brief Updates whether or not the data values are mapped to the lookup table for this view
    * @param mapColors
    */
   void setMapColors(ColorMapping mapColors);
 
+  /**
+   * @brief Sets whether values are mapped through the continuous color transfer function,
+   * the categorical lookup table, or whichever suits the active array.
+   * @param mode
+   */
+  void setLookupTableMode(LookupTableMode mode);
+
   /**
    * @brief Sets the object's alpha transparency
    * @param alpha
@@ -568,6 +725,7 @@ signals:
 
   void representationChanged(const Representation&);
   void mapColorsChanged(const ColorMapping&);
+  void lookupTableModeChanged(const LookupTableMode&);
 
   void renderPointSpheresChanged(const bool&);
   void solidColorChanged();
@@ -576,6 +734,7 @@ signals:
   void actorsUpdated();
   void dataLoaded();
   void swappingActors(vtkProp3D* oldProp, vtkProp3D* newProp);
+  void valuesChanged();
 
 protected:
   /**
@@ -608,6 +767,12 @@ protected:
    */
   void setupActions();
 
+  /**
+   * @brief Starts the timer releasing rendering resources if the filter is hidden and
+   * not selected.  Stops the timer otherwise.
+   */
+  void scheduleResourceRelease();
+
   /**
    * @brief Returns the vtkDataSetMapper if the ActorType is DataSet and the settings are valid.
    * Returns nullptr otherwise.
@@ -664,6 +829,17 @@ protected:
    */
   void connectFilter(VSAbstractFilter* filter);
 
+  /**
+   * @brief Connects the value change signals so the getValues snapshot is rebuilt after a change
+   */
+  void setupValueTracking();
+
+  /**
+   * @brief Discards the getValues snapshot and emits valuesChanged
+   * @param lookupTable True if the lookup table changed as well
+   */
+  void invalidateValues(bool lookupTable = false);
+
   /**
    * @brief Handles the target filter being deleted.
    */
@@ -724,19 +900,75 @@ protected:
    */
   void updateScalarBarVisibility();
 
+  /**
+   * @brief Returns the Euler angle array used for IPF coloring or nullptr if there is none
+   * @return
+   */
+  vtkDataArray* getEulerAngles() const;
+
+  /**
+   * @brief Returns the single component integer array of phases alongside the Euler angles
+   * or nullptr if there is none
+   * @return
+   */
+  vtkDataArray* getPhases() const;
+
+  /**
+   * @brief Returns the IPF colors for the given direction.  The colors last generated are
+   * stored with the filter output's Euler angles so every view of the filter shares them, and
+   * they are generated again when the direction, Euler angles, or phases change.
+   * @param direction
+   * @return
+   */
+  VTK_PTR(vtkUnsignedCharArray) getIPFColors(const VSIPFColorGenerator::Direction& direction);
+
+  /**
+   * @brief Regenerates the active IPF colors after the filter output changed.  This is only
+   * called while the view is shown so hidden filters are never executed for their colors.
+   */
+  void restoreIPFColors();
+
+  /**
+   * @brief Stops coloring by IPF colors and returns to the render geometry shared with
+   * every other view of the filter
+   */
+  void clearIPFColors();
+
+  /**
+   * @brief Uses the given render geometry and connects the mapper to it
+   * @param geometry
+   */
+  void useRenderGeometry(VSRenderGeometry::Pointer geometry);
+
+  /**
+   * @brief Returns true if the active array is the generated IPF color array
+   * @return
+   */
+  bool isColoringByIPF() const;
+
+  /**
+   * @brief Switches the mapper between the continuous and categorical lookup tables
+   * according to the lookup table mode and the active array
+   */
+  void updateLookupTable();
+
 private:
   VSAbstractFilter* m_Filter = nullptr;
   ActorType m_ActorType = ActorType::Invalid;
-  VTK_PTR(vtkDataSetSurfaceFilter) m_DataSetFilter = nullptr;
+  VSRenderGeometry::Pointer m_RenderGeometry = nullptr;
   bool m_ShowFilter = true;
+  bool m_InputPortPending = false;
   QString m_ActiveArrayName;
   int m_ActiveComponent = -1;
   ColorMapping m_MapColors = ColorMapping::NonColors;
   Representation m_Representation = Representation::Default;
   VTK_PTR(vtkAbstractMapper3D) m_Mapper = nullptr;
   VTK_PTR(vtkProp3D) m_Actor = nullptr;
-  VTK_PTR(vtkOutlineFilter) m_OutlineFilter = nullptr;
   VSLookupTableController* m_LookupTable = nullptr;
+  VTK_PTR(VSCategoricalLookupTable) m_CategoricalTable = nullptr;
+  VTK_PTR(VSIndexedLookupTable) m_IndexedTable = nullptr;
+  LookupTableMode m_LookupTableMode = LookupTableMode::Automatic;
+  bool m_CategoricalColors = false;
   ScalarBarSetting m_ScalarBarSetting = ScalarBarSetting::OnSelection;
   double m_Alpha = 1.0;
   VTK_PTR(vtkScalarBarActor) m_ScalarBarActor = nullptr;
@@ -745,6 +977,14 @@ private:
   VTK_PTR(vtkCubeAxesActor) m_CubeAxesActor = nullptr;
   bool m_GridVisible = false;
   bool m_Selected = false;
+  bool m_ScalarBarVisible = false;
+  ValuesPointer m_ReleasedValues = nullptr;
+  mutable ValuesPointer m_Values = nullptr;
+  mutable std::shared_ptr<VSLookupTableController> m_ValuesLookupTable = nullptr;
+  QTimer* m_ReleaseTimer = nullptr;
+  VSIPFColorGenerator::Direction m_IPFDirection = {{0.0, 0.0, 1.0}};
+  VTK_PTR(vtkUnsignedCharArray) m_IPFColors = nullptr;
+  static int m_ResourceReleaseDelay;
 
   QAction* m_SetColorAction = nullptr;
   QAction* m_SetOpacityAction = nullptr;
@@ -0,0 +1,1030 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageRegionReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QMutexLocker>
+
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReader.h"
+
+namespace
+{
+struct RegionArray
+{
+  QString m_DataContainer;
+  QString m_AttributeMatrix;
+  QString m_Name;
+  QString m_TypeName;
+  QVector<size_t> m_CompDims;
+};
+
+struct VoxelBox
+{
+  size_t m_Start[3];
+  size_t m_Dims[3];
+};
+
+/**
+ * @brief Returns the primitive type name from a DataArray object type such as "DataArray<float>".
+ * Returns an empty string for other array types.
+ * @param objectType
+ * @return
+ */
+QString DataArrayTypeName(const QString& objectType)
+{
+  const QString prefix = "DataArray<";
+  if(false == objectType.startsWith(prefix) || false == objectType.endsWith(">"))
+  {
+    return QString();
+  }
+
+  return objectType.mid(prefix.size(), objectType.size() - prefix.size() - 1);
+}
+
+/**
+ * @brief Returns the native HDF5 type used to read the given primitive type.  Returns -1 for
+ * unsupported types.
+ * @param typeName
+ * @return
+ */
+hid_t NativeType(const QString& typeName)
+{
+  if(typeName == "float")
+  {
+    return H5T_NATIVE_FLOAT;
+  }
+  if(typeName == "double")
+  {
+    return H5T_NATIVE_DOUBLE;
+  }
+  if(typeName == "int8_t")
+  {
+    return H5T_NATIVE_INT8;
+  }
+  // SIMPL stores bool arrays as uint8_t
+  if(typeName == "uint8_t" || typeName == "bool")
+  {
+    return H5T_NATIVE_UINT8;
+  }
+  if(typeName == "int16_t")
+  {
+    return H5T_NATIVE_INT16;
+  }
+  if(typeName == "uint16_t")
+  {
+    return H5T_NATIVE_UINT16;
+  }
+  if(typeName == "int32_t")
+  {
+    return H5T_NATIVE_INT32;
+  }
+  if(typeName == "uint32_t")
+  {
+    return H5T_NATIVE_UINT32;
+  }
+  if(typeName == "int64_t")
+  {
+    return H5T_NATIVE_INT64;
+  }
+  if(typeName == "uint64_t")
+  {
+    return H5T_NATIVE_UINT64;
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Reads a box of voxels sampled at the given stride from a SIMPL cell array into the
+ * buffer.  The box start, stride, and dimensions are given in X, Y, Z order.
+ * @param fileId
+ * @param path
+ * @param start
+ * @param stride
+ * @param dims
+ * @param memType
+ * @param buffer
+ * @return
+ */
+herr_t ReadHyperslab(hid_t fileId, const QString& path, const size_t start[3], const size_t stride[3], const size_t dims[3], hid_t memType, void* buffer)
+{
+  hid_t datasetId = H5Dopen(fileId, path.toLatin1().constData(), H5P_DEFAULT);
+  if(datasetId < 0)
+  {
+    return -1;
+  }
+
+  herr_t err = -1;
+  hid_t fileSpaceId = H5Dget_space(datasetId);
+  int rank = H5Sget_simple_extent_ndims(fileSpaceId);
+  if(rank >= 3)
+  {
+    // SIMPL stores the tuple dimensions slowest first (Z, Y, X) followed by the component dimensions
+    std::vector<hsize_t> counts(rank);
+    H5Sget_simple_extent_dims(fileSpaceId, counts.data(), nullptr);
+    std::vector<hsize_t> offsets(rank, 0);
+    std::vector<hsize_t> strides(rank, 1);
+    for(int axis = 0; axis < 3; axis++)
+    {
+      offsets[2 - axis] = start[axis];
+      strides[2 - axis] = stride[axis];
+      counts[2 - axis] = dims[axis];
+    }
+
+    err = H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offsets.data(), strides.data(), counts.data(), nullptr);
+    if(err >= 0)
+    {
+      hid_t memSpaceId = H5Screate_simple(rank, counts.data(), nullptr);
+      err = H5Dread(datasetId, memType, memSpaceId, fileSpaceId, H5P_DEFAULT, buffer);
+      H5Sclose(memSpaceId);
+    }
+  }
+
+  H5Sclose(fileSpaceId);
+  H5Dclose(datasetId);
+  return err;
+}
+
+/**
+ * @brief Copies every voxel of the source box into the target volume at the given offset
+ * @param source
+ * @param sourceDims
+ * @param target
+ * @param targetDims
+ * @param offset
+ * @param elementSize
+ */
+void CopyBox(const char* source, const size_t sourceDims[3], char* target, const size_t targetDims[3], const size_t offset[3], size_t elementSize)
+{
+  const size_t rowSize = sourceDims[0] * elementSize;
+  for(size_t z = 0; z < sourceDims[2]; z++)
+  {
+    for(size_t y = 0; y < sourceDims[1]; y++)
+    {
+      const size_t sourceIndex = (z * sourceDims[1] + y) * sourceDims[0];
+      const size_t targetIndex = ((z + offset[2]) * targetDims[1] + (y + offset[1])) * targetDims[0] + offset[0];
+      std::memcpy(target + targetIndex * elementSize, source + sourceIndex * elementSize, rowSize);
+    }
+  }
+}
+
+/**
+ * @brief Returns the boxes of a volume that are not covered by an inner box at the given offset.
+ * Slabs along Z come first, then the rows along Y and columns along X beside the inner box.
+ * @param offset
+ * @param innerDims
+ * @param dims
+ * @return
+ */
+std::vector<VoxelBox> MissingBoxes(const size_t offset[3], const size_t innerDims[3], const size_t dims[3])
+{
+  std::vector<VoxelBox> boxes;
+  const size_t end[3] = {offset[0] + innerDims[0], offset[1] + innerDims[1], offset[2] + innerDims[2]};
+
+  if(offset[2] > 0)
+  {
+    boxes.push_back({{0, 0, 0}, {dims[0], dims[1], offset[2]}});
+  }
+  if(end[2] < dims[2])
+  {
+    boxes.push_back({{0, 0, end[2]}, {dims[0], dims[1], dims[2] - end[2]}});
+  }
+  if(offset[1] > 0)
+  {
+    boxes.push_back({{0, 0, offset[2]}, {dims[0], offset[1], innerDims[2]}});
+  }
+  if(end[1] < dims[1])
+  {
+    boxes.push_back({{0, end[1], offset[2]}, {dims[0], dims[1] - end[1], innerDims[2]}});
+  }
+  if(offset[0] > 0)
+  {
+    boxes.push_back({{0, offset[1], offset[2]}, {offset[0], innerDims[1], innerDims[2]}});
+  }
+  if(end[0] < dims[0])
+  {
+    boxes.push_back({{end[0], offset[1], offset[2]}, {dims[0] - end[0], innerDims[1], innerDims[2]}});
+  }
+
+  return boxes;
+}
+
+/**
+ * @brief Returns the dimensions of an ImageGeom
+ * @param geom
+ * @param dims
+ */
+void GetDimensions(ImageGeom::Pointer geom, size_t dims[3])
+{
+  std::tuple<size_t, size_t, size_t> geomDims = geom->getDimensions();
+  dims[0] = std::get<0>(geomDims);
+  dims[1] = std::get<1>(geomDims);
+  dims[2] = std::get<2>(geomDims);
+}
+
+/**
+ * @brief Reads the region of a single cell array into the buffer converted to the given memory type
+ * @param filePath
+ * @param dcName
+ * @param arrayInfo
+ * @param region
+ * @param memType
+ * @param buffer
+ * @param errorMessage
+ * @return
+ */
+bool ReadArrayRegionAs(const QString& filePath, const QString& dcName, const VSImageArrayInfo& arrayInfo, const VSImageRegion& region, hid_t memType, void* buffer, QString& errorMessage)
+{
+  hid_t fileId = QH5Utilities::openFile(filePath, true);
+  if(fileId < 0)
+  {
+    errorMessage = QObject::tr("The file '%1' could not be opened.").arg(filePath);
+    return false;
+  }
+
+  size_t dims[3];
+  region.getDimensions(dims);
+  QString path = QString("/%1/%2/%3/%4").arg(SIMPL::StringConstants::DataContainerGroupName).arg(dcName).arg(arrayInfo.m_AttributeMatrix).arg(arrayInfo.m_Name);
+  herr_t err = ReadHyperslab(fileId, path, region.m_Min, region.m_Stride, dims, memType, buffer);
+  QH5Utilities::closeFile(fileId);
+
+  if(err < 0)
+  {
+    errorMessage = QObject::tr("The region of interest of '%1' could not be read from '%2'.").arg(path).arg(filePath);
+    return false;
+  }
+
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegion VSImageRegion::clamped(const size_t dims[3]) const
+{
+  VSImageRegion region;
+  for(int axis = 0; axis < 3; axis++)
+  {
+    const size_t last = (dims[axis] > 0) ? dims[axis] - 1 : 0;
+    const size_t stride = std::max<size_t>(m_Stride[axis], 1);
+    const size_t min = std::min(m_Min[axis], last);
+    const size_t max = std::min(std::max(m_Max[axis], min), last);
+
+    // The last voxel is moved back onto the stride
+    region.m_Min[axis] = min;
+    region.m_Max[axis] = min + ((max - min) / stride) * stride;
+    region.m_Stride[axis] = stride;
+  }
+
+  return region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegion::getDimensions(size_t dims[3]) const
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    dims[axis] = (m_Max[axis] < m_Min[axis]) ? 0 : (m_Max[axis] - m_Min[axis]) / std::max<size_t>(m_Stride[axis], 1) + 1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImageRegion::getNumberOfVoxels() const
+{
+  size_t dims[3];
+  getDimensions(dims);
+  return dims[0] * dims[1] * dims[2];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageRegion::contains(const VSImageRegion& other) const
+{
+  for(int axis = 0; axis < 3; axis++)
+  {
+    const size_t stride = std::max<size_t>(m_Stride[axis], 1);
+    if(other.m_Min[axis] < m_Min[axis] || other.m_Max[axis] > m_Max[axis] || (other.m_Min[axis] - m_Min[axis]) % stride != 0)
+    {
+      return false;
+    }
+    if(other.m_Max[axis] > other.m_Min[axis] && other.m_Stride[axis] % stride != 0)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageRegion::isWholeVolume(const size_t dims[3]) const
+{
+  VSImageRegion region = clamped(dims);
+  for(int axis = 0; axis < 3; axis++)
+  {
+    if(region.m_Min[axis] != 0 || region.m_Stride[axis] != 1 || region.m_Max[axis] + 1 < dims[axis])
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject VSImageRegion::toJson() const
+{
+  QJsonArray minArray;
+  QJsonArray maxArray;
+  QJsonArray strideArray;
+  for(int axis = 0; axis < 3; axis++)
+  {
+    minArray.append(static_cast<double>(m_Min[axis]));
+    maxArray.append(static_cast<double>(m_Max[axis]));
+    strideArray.append(static_cast<double>(m_Stride[axis]));
+  }
+
+  QJsonObject json;
+  json["Min"] = minArray;
+  json["Max"] = maxArray;
+  json["Stride"] = strideArray;
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegion VSImageRegion::FromJson(const QJsonObject& json)
+{
+  VSImageRegion region;
+  QJsonArray minArray = json["Min"].toArray();
+  QJsonArray maxArray = json["Max"].toArray();
+  QJsonArray strideArray = json["Stride"].toArray();
+  for(int axis = 0; axis < 3; axis++)
+  {
+    if(axis < minArray.size())
+    {
+      region.m_Min[axis] = static_cast<size_t>(minArray.at(axis).toDouble());
+    }
+    if(axis < maxArray.size())
+    {
+      region.m_Max[axis] = static_cast<size_t>(maxArray.at(axis).toDouble());
+    }
+    if(axis < strideArray.size())
+    {
+      region.m_Stride[axis] = std::max<size_t>(static_cast<size_t>(strideArray.at(axis).toDouble()), 1);
+    }
+  }
+
+  return region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImageArrayInfo::getNumberOfComponents() const
+{
+  size_t count = 1;
+  for(size_t dim : m_CompDims)
+  {
+    count *= dim;
+  }
+
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImageArrayInfo::getTypeSize() const
+{
+  hid_t nativeType = NativeType(m_TypeName);
+  if(nativeType < 0)
+  {
+    return 0;
+  }
+
+  return H5Tget_size(nativeType);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject VSImageArrayInfo::toJson() const
+{
+  QJsonArray compDims;
+  for(size_t dim : m_CompDims)
+  {
+    compDims.append(static_cast<double>(dim));
+  }
+
+  QJsonObject json;
+  json["Attribute Matrix"] = m_AttributeMatrix;
+  json["Name"] = m_Name;
+  json["Type"] = m_TypeName;
+  json["Component Dimensions"] = compDims;
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageArrayInfo VSImageArrayInfo::FromJson(const QJsonObject& json)
+{
+  VSImageArrayInfo arrayInfo;
+  arrayInfo.m_AttributeMatrix = json["Attribute Matrix"].toString();
+  arrayInfo.m_Name = json["Name"].toString();
+  arrayInfo.m_TypeName = json["Type"].toString();
+
+  QJsonArray compDims = json["Component Dimensions"].toArray();
+  for(const QJsonValue& dim : compDims)
+  {
+    arrayInfo.m_CompDims.push_back(static_cast<size_t>(dim.toDouble()));
+  }
+  if(arrayInfo.m_CompDims.isEmpty())
+  {
+    arrayInfo.m_CompDims.push_back(1);
+  }
+
+  return arrayInfo;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMutex& VSImageRegionReader::GetHDF5Lock()
+{
+  static QMutex lock(QMutex::Recursive);
+  return lock;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageGeom::Pointer VSImageRegionReader::ReadImageGeometry(const QString& filePath, const QString& dcName)
+{
+  QMutexLocker locker(&GetHDF5Lock());
+  SIMPLH5DataReader reader;
+  if(false == reader.openFile(filePath))
+  {
+    return nullptr;
+  }
+
+  int err = 0;
+  DataContainerArrayProxy proxy = reader.readDataContainerArrayStructure(nullptr, err);
+  if(err < 0 || false == proxy.dataContainers.contains(dcName))
+  {
+    return nullptr;
+  }
+
+  // Only the DataContainer and its geometry are read
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = proxy.dataContainers.begin(); dcIter != proxy.dataContainers.end(); dcIter++)
+  {
+    DataContainerProxy& dcProxy = dcIter.value();
+    dcProxy.flag = (dcProxy.name == dcName) ? Qt::Checked : Qt::Unchecked;
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); amIter++)
+    {
+      amIter.value().flag = Qt::Unchecked;
+    }
+  }
+
+  if(proxy.dataContainers.value(dcName).dcType != static_cast<unsigned int>(IGeometry::Type::Image))
+  {
+    return nullptr;
+  }
+
+  DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(proxy, false);
+  if(nullptr == dca || nullptr == dca->getDataContainer(dcName))
+  {
+    return nullptr;
+  }
+
+  return dca->getDataContainer(dcName)->getGeometryAs<ImageGeom>();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer VSImageRegionReader::ReadDataContainerArray(const QString& filePath, DataContainerArrayProxy proxy, const VSImageRegion& region, QString& errorMessage)
+{
+  QMap<QString, VSImageRegion> regions;
+  for(const DataContainerProxy& dcProxy : proxy.dataContainers)
+  {
+    if(dcProxy.flag != Qt::Unchecked && dcProxy.dcType == static_cast<unsigned int>(IGeometry::Type::Image))
+    {
+      regions[dcProxy.name] = region;
+    }
+  }
+
+  return ReadDataContainerArray(filePath, proxy, regions, errorMessage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer VSImageRegionReader::ReadDataContainerArray(const QString& filePath, DataContainerArrayProxy proxy, const QMap<QString, VSImageRegion>& regions, QString& errorMessage)
+{
+  QMutexLocker locker(&GetHDF5Lock());
+
+  // Cell arrays of ImageGeom DataContainers are removed from the proxy and read by region afterwards
+  std::vector<RegionArray> regionArrays;
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = proxy.dataContainers.begin(); dcIter != proxy.dataContainers.end(); dcIter++)
+  {
+    DataContainerProxy& dcProxy = dcIter.value();
+    if(dcProxy.flag == Qt::Unchecked || dcProxy.dcType != static_cast<unsigned int>(IGeometry::Type::Image) || false == regions.contains(dcProxy.name))
+    {
+      continue;
+    }
+
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); amIter++)
+    {
+      AttributeMatrixProxy& amProxy = amIter.value();
+      if(amProxy.flag == Qt::Unchecked || amProxy.amType != AttributeMatrix::Type::Cell)
+      {
+        continue;
+      }
+
+      for(QMap<QString, DataArrayProxy>::iterator daIter = amProxy.dataArrays.begin(); daIter != amProxy.dataArrays.end(); daIter++)
+      {
+        DataArrayProxy& daProxy = daIter.value();
+        if(daProxy.flag == Qt::Unchecked)
+        {
+          continue;
+        }
+
+        QString typeName = DataArrayTypeName(daProxy.objectType);
+        if(NativeType(typeName) >= 0)
+        {
+          regionArrays.push_back({dcProxy.name, amProxy.name, daProxy.name, typeName, daProxy.compDims});
+        }
+        daProxy.flag = Qt::Unchecked;
+      }
+    }
+  }
+
+  DataContainerArray::Pointer dca = nullptr;
+  {
+    SIMPLH5DataReader reader;
+    if(false == reader.openFile(filePath))
+    {
+      errorMessage = QObject::tr("The file '%1' could not be opened.").arg(filePath);
+      return nullptr;
+    }
+
+    dca = reader.readSIMPLDataUsingProxy(proxy, false);
+  }
+  if(nullptr == dca)
+  {
+    errorMessage = QObject::tr("The data structure of '%1' could not be read.").arg(filePath);
+    return nullptr;
+  }
+
+  QMap<QString, VSImageRegion> dcRegions;
+  QList<DataContainer::Pointer> dataContainers = dca->getDataContainers();
+  for(DataContainer::Pointer dc : dataContainers)
+  {
+    ImageGeom::Pointer geom = dc->getGeometryAs<ImageGeom>();
+    if(nullptr == geom || false == regions.contains(dc->getName()))
+    {
+      continue;
+    }
+
+    size_t dims[3];
+    GetDimensions(geom, dims);
+    VSImageRegion dcRegion = regions[dc->getName()].clamped(dims);
+    ApplyRegion(geom, geom, dcRegion);
+    dcRegions[dc->getName()] = dcRegion;
+
+    dcRegion.getDimensions(dims);
+    QVector<size_t> tupleDims = {dims[0], dims[1], dims[2]};
+    DataContainer::AttributeMatrixMap_t amMap = dc->getAttributeMatrices();
+    for(AttributeMatrix::Pointer am : amMap)
+    {
+      if(am && am->getType() == AttributeMatrix::Type::Cell)
+      {
+        am->setTupleDimensions(tupleDims);
+      }
+    }
+  }
+
+  hid_t fileId = QH5Utilities::openFile(filePath, true);
+  if(fileId < 0)
+  {
+    errorMessage = QObject::tr("The file '%1' could not be opened.").arg(filePath);
+    return nullptr;
+  }
+
+  for(const RegionArray& regionArray : regionArrays)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(regionArray.m_DataContainer);
+    if(nullptr == dc || false == dcRegions.contains(regionArray.m_DataContainer) || nullptr == dc->getAttributeMatrix(regionArray.m_AttributeMatrix))
+    {
+      continue;
+    }
+
+    VSImageRegion dcRegion = dcRegions[regionArray.m_DataContainer];
+    size_t dims[3];
+    dcRegion.getDimensions(dims);
+    QVector<size_t> tupleDims = {dims[0], dims[1], dims[2]};
+    IDataArray::Pointer array = CreateDataArray(regionArray.m_TypeName, tupleDims, regionArray.m_CompDims, regionArray.m_Name);
+    if(nullptr == array)
+    {
+      continue;
+    }
+
+    QString path = QString("/%1/%2/%3/%4").arg(SIMPL::StringConstants::DataContainerGroupName).arg(regionArray.m_DataContainer).arg(regionArray.m_AttributeMatrix).arg(regionArray.m_Name);
+    if(ReadHyperslab(fileId, path, dcRegion.m_Min, dcRegion.m_Stride, dims, NativeType(regionArray.m_TypeName), array->getVoidPointer(0)) < 0)
+    {
+      errorMessage = QObject::tr("The region of interest of '%1' could not be read from '%2'.").arg(path).arg(filePath);
+      QH5Utilities::closeFile(fileId);
+      return nullptr;
+    }
+
+    dc->getAttributeMatrix(regionArray.m_AttributeMatrix)->addAttributeArray(regionArray.m_Name, array);
+  }
+
+  QH5Utilities::closeFile(fileId);
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<VSImageRegion> VSImageRegionReader::CreateRefinementLevels(const VSImageRegion& region, size_t maxCoarseVoxels)
+{
+  QList<VSImageRegion> levels;
+  levels.push_back(region);
+
+  VSImageRegion level = region;
+  size_t factor = 1;
+  while(level.getNumberOfVoxels() > std::max<size_t>(maxCoarseVoxels, 1))
+  {
+    // Stop once every axis is down to a single voxel
+    size_t dims[3];
+    level.getDimensions(dims);
+    if(dims[0] <= 1 && dims[1] <= 1 && dims[2] <= 1)
+    {
+      break;
+    }
+
+    factor *= 2;
+    for(int axis = 0; axis < 3; axis++)
+    {
+      level.m_Stride[axis] = region.m_Stride[axis] * factor;
+      level.m_Max[axis] = region.m_Min[axis] + ((region.m_Max[axis] - region.m_Min[axis]) / level.m_Stride[axis]) * level.m_Stride[axis];
+    }
+    levels.push_front(level);
+  }
+
+  return levels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<VSImageArrayInfo> VSImageRegionReader::GetCellArrays(const DataContainerProxy& dcProxy)
+{
+  QList<VSImageArrayInfo> arrays;
+  for(const AttributeMatrixProxy& amProxy : dcProxy.attributeMatricies)
+  {
+    if(amProxy.flag == Qt::Unchecked || amProxy.amType != AttributeMatrix::Type::Cell)
+    {
+      continue;
+    }
+
+    for(const DataArrayProxy& daProxy : amProxy.dataArrays)
+    {
+      QString typeName = DataArrayTypeName(daProxy.objectType);
+      if(daProxy.flag != Qt::Unchecked && NativeType(typeName) >= 0)
+      {
+        arrays.push_back({amProxy.name, daProxy.name, typeName, daProxy.compDims});
+      }
+    }
+  }
+
+  return arrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageRegionReader::FindCellArray(const DataContainerProxy& dcProxy, const QString& amName, const QString& arrayName, VSImageArrayInfo& arrayInfo)
+{
+  if(false == dcProxy.attributeMatricies.contains(amName))
+  {
+    return false;
+  }
+
+  AttributeMatrixProxy amProxy = dcProxy.attributeMatricies.value(amName);
+  if(amProxy.amType != AttributeMatrix::Type::Cell || false == amProxy.dataArrays.contains(arrayName))
+  {
+    return false;
+  }
+
+  DataArrayProxy daProxy = amProxy.dataArrays.value(arrayName);
+  QString typeName = DataArrayTypeName(daProxy.objectType);
+  if(NativeType(typeName) < 0)
+  {
+    return false;
+  }
+
+  arrayInfo = {amName, arrayName, typeName, daProxy.compDims};
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionReader::UncheckCellArrays(DataContainerProxy& dcProxy)
+{
+  for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); amIter++)
+  {
+    AttributeMatrixProxy& amProxy = amIter.value();
+    if(amProxy.amType != AttributeMatrix::Type::Cell)
+    {
+      continue;
+    }
+
+    for(QMap<QString, DataArrayProxy>::iterator daIter = amProxy.dataArrays.begin(); daIter != amProxy.dataArrays.end(); daIter++)
+    {
+      daIter.value().flag = Qt::Unchecked;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageRegionReader::ReadArrayRegion(const QString& filePath, const QString& dcName, const VSImageArrayInfo& arrayInfo, const VSImageRegion& region, void* buffer, QString& errorMessage)
+{
+  QMutexLocker locker(&GetHDF5Lock());
+  return ReadArrayRegionAs(filePath, dcName, arrayInfo, region, NativeType(arrayInfo.m_TypeName), buffer, errorMessage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageRegionReader::ReadArrayRegionValues(const QString& filePath, const QString& dcName, const VSImageArrayInfo& arrayInfo, const VSImageRegion& region, std::vector<double>& values,
+                                                QString& errorMessage)
+{
+  if(NativeType(arrayInfo.m_TypeName) < 0)
+  {
+    errorMessage = QObject::tr("'%1' is not a numeric array.").arg(arrayInfo.m_Name);
+    return false;
+  }
+
+  // HDF5 converts the stored values while reading
+  values.resize(region.getNumberOfVoxels() * arrayInfo.getNumberOfComponents());
+  QMutexLocker locker(&GetHDF5Lock());
+  return ReadArrayRegionAs(filePath, dcName, arrayInfo, region, H5T_NATIVE_DOUBLE, values.data(), errorMessage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainer::Pointer VSImageRegionReader::ExpandDataContainer(const QString& filePath, DataContainer::Pointer dc, const VSImageRegion& oldRegion, const VSImageRegion& newRegion, QString& errorMessage)
+{
+  if(nullptr == dc)
+  {
+    return nullptr;
+  }
+
+  // The geometry and every expanded array are read without another thread's reads in between
+  QMutexLocker locker(&GetHDF5Lock());
+  ImageGeom::Pointer fullGeom = ReadImageGeometry(filePath, dc->getName());
+  if(nullptr == fullGeom)
+  {
+    errorMessage = QObject::tr("The ImageGeom of Data Container '%1' could not be read from '%2'.").arg(dc->getName()).arg(filePath);
+    return nullptr;
+  }
+
+  size_t fullDims[3];
+  GetDimensions(fullGeom, fullDims);
+  VSImageRegion oldClamped = oldRegion.clamped(fullDims);
+  VSImageRegion newClamped = newRegion.clamped(fullDims);
+
+  size_t oldDims[3];
+  size_t newDims[3];
+  oldClamped.getDimensions(oldDims);
+  newClamped.getDimensions(newDims);
+
+  // Voxels in memory are kept only if they are sampled by the new region at the same stride
+  bool aligned = true;
+  size_t offset[3] = {0, 0, 0};
+  for(int axis = 0; axis < 3; axis++)
+  {
+    const size_t stride = newClamped.m_Stride[axis];
+    aligned = aligned && oldClamped.m_Stride[axis] == stride && oldClamped.m_Min[axis] >= newClamped.m_Min[axis] && (oldClamped.m_Min[axis] - newClamped.m_Min[axis]) % stride == 0;
+    if(aligned)
+    {
+      offset[axis] = (oldClamped.m_Min[axis] - newClamped.m_Min[axis]) / stride;
+      aligned = offset[axis] + oldDims[axis] <= newDims[axis];
+    }
+  }
+
+  std::vector<VoxelBox> wholeRegion = {{{0, 0, 0}, {newDims[0], newDims[1], newDims[2]}}};
+  std::vector<VoxelBox> missingBoxes = aligned ? MissingBoxes(offset, oldDims, newDims) : wholeRegion;
+
+  DataContainer::Pointer newDc = DataContainer::New(dc->getName());
+  ImageGeom::Pointer geom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  ApplyRegion(geom, fullGeom, newClamped);
+  newDc->setGeometry(geom);
+
+  hid_t fileId = QH5Utilities::openFile(filePath, true);
+  if(fileId < 0)
+  {
+    errorMessage = QObject::tr("The file '%1' could not be opened.").arg(filePath);
+    return nullptr;
+  }
+
+  QVector<size_t> tupleDims = {newDims[0], newDims[1], newDims[2]};
+  const size_t oldCount = oldDims[0] * oldDims[1] * oldDims[2];
+  DataContainer::AttributeMatrixMap_t amMap = dc->getAttributeMatrices();
+  for(AttributeMatrix::Pointer am : amMap)
+  {
+    if(nullptr == am)
+    {
+      continue;
+    }
+
+    // Feature and ensemble matrices do not depend on the region
+    if(am->getType() != AttributeMatrix::Type::Cell)
+    {
+      newDc->addAttributeMatrix(am->getName(), am);
+      continue;
+    }
+
+    AttributeMatrix::Pointer newAm = AttributeMatrix::New(tupleDims, am->getName(), AttributeMatrix::Type::Cell);
+    QList<QString> arrayNames = am->getAttributeArrayNames();
+    for(const QString& arrayName : arrayNames)
+    {
+      IDataArray::Pointer oldArray = am->getAttributeArray(arrayName);
+      QString typeName = oldArray ? oldArray->getTypeAsString() : QString();
+      IDataArray::Pointer newArray = CreateDataArray(typeName, tupleDims, oldArray ? oldArray->getComponentDimensions() : QVector<size_t>(), arrayName);
+      if(nullptr == newArray)
+      {
+        continue;
+      }
+
+      const size_t elementSize = static_cast<size_t>(oldArray->getTypeSize()) * oldArray->getNumberOfComponents();
+      char* target = static_cast<char*>(newArray->getVoidPointer(0));
+      bool keepVoxels = aligned && oldArray->getNumberOfTuples() == oldCount;
+      if(keepVoxels)
+      {
+        CopyBox(static_cast<char*>(oldArray->getVoidPointer(0)), oldDims, target, newDims, offset, elementSize);
+      }
+
+      QString path = QString("/%1/%2/%3/%4").arg(SIMPL::StringConstants::DataContainerGroupName).arg(dc->getName()).arg(am->getName()).arg(arrayName);
+      for(const VoxelBox& box : (keepVoxels ? missingBoxes : wholeRegion))
+      {
+        size_t start[3];
+        for(int axis = 0; axis < 3; axis++)
+        {
+          start[axis] = newClamped.m_Min[axis] + box.m_Start[axis] * newClamped.m_Stride[axis];
+        }
+
+        std::vector<char> buffer(box.m_Dims[0] * box.m_Dims[1] * box.m_Dims[2] * elementSize);
+        if(ReadHyperslab(fileId, path, start, newClamped.m_Stride, box.m_Dims, NativeType(typeName), buffer.data()) < 0)
+        {
+          errorMessage = QObject::tr("The region of interest of '%1' could not be read from '%2'.").arg(path).arg(filePath);
+          QH5Utilities::closeFile(fileId);
+          return nullptr;
+        }
+
+        CopyBox(buffer.data(), box.m_Dims, target, newDims, box.m_Start, elementSize);
+      }
+
+      newAm->addAttributeArray(arrayName, newArray);
+    }
+
+    newDc->addAttributeMatrix(newAm->getName(), newAm);
+  }
+
+  QH5Utilities::closeFile(fileId);
+  return newDc;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageRegionReader::ApplyRegion(ImageGeom::Pointer geom, ImageGeom::Pointer fullGeom, const VSImageRegion& region)
+{
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  float res[3] = {1.0f, 1.0f, 1.0f};
+  fullGeom->getOrigin(origin);
+  fullGeom->getResolution(res);
+
+  size_t dims[3];
+  region.getDimensions(dims);
+
+  // Each voxel read stands in for the voxels skipped by the stride after it
+  geom->setDimensions(dims[0], dims[1], dims[2]);
+  geom->setOrigin(origin[0] + region.m_Min[0] * res[0], origin[1] + region.m_Min[1] * res[1], origin[2] + region.m_Min[2] * res[2]);
+  geom->setResolution(res[0] * region.m_Stride[0], res[1] * region.m_Stride[1], res[2] * region.m_Stride[2]);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer VSImageRegionReader::CreateDataArray(const QString& typeName, const QVector<size_t>& tupleDims, const QVector<size_t>& compDims, const QString& name)
+{
+  if(typeName == "float")
+  {
+    return FloatArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "double")
+  {
+    return DoubleArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "int8_t")
+  {
+    return Int8ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "uint8_t")
+  {
+    return UInt8ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "bool")
+  {
+    return BoolArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "int16_t")
+  {
+    return Int16ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "uint16_t")
+  {
+    return UInt16ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "int32_t")
+  {
+    return Int32ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "uint32_t")
+  {
+    return UInt32ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "int64_t")
+  {
+    return Int64ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+  if(typeName == "uint64_t")
+  {
+    return UInt64ArrayType::CreateArray(tupleDims, compDims, name, true);
+  }
+
+  return nullptr;
+}
@@ -0,0 +1,324 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImageRegion VSImageRegionReader.h SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h
+ * @brief This struct describes a region of interest within an ImageGeom by its first and last voxel
+ * indices along each axis and the stride between the voxels read.  The last voxel is inclusive and
+ * only voxels at first + n * stride are part of the region.  The default region covers any volume.
+ */
+struct SIMPLVtkLib_EXPORT VSImageRegion
+{
+  size_t m_Min[3] = {0, 0, 0};
+  size_t m_Max[3] = {SIZE_MAX, SIZE_MAX, SIZE_MAX};
+  size_t m_Stride[3] = {1, 1, 1};
+
+  /**
+   * @brief Returns a copy of the region limited to a volume of the given dimensions
+   * @param dims
+   * @return
+   */
+  VSImageRegion clamped(const size_t dims[3]) const;
+
+  /**
+   * @brief Returns the number of voxels read along each axis
+   * @param dims
+   */
+  void getDimensions(size_t dims[3]) const;
+
+  /**
+   * @brief Returns the total number of voxels read
+   * @return
+   */
+  size_t getNumberOfVoxels() const;
+
+  /**
+   * @brief Returns true if every voxel of the given region is also read by this region
+   * @param other
+   * @return
+   */
+  bool contains(const VSImageRegion& other) const;
+
+  /**
+   * @brief Returns true if the region reads every voxel of a volume with the given dimensions
+   * @param dims
+   * @return
+   */
+  bool isWholeVolume(const size_t dims[3]) const;
+
+  /**
+   * @brief Writes the region to json
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Reads a region from json
+   * @param json
+   * @return
+   */
+  static VSImageRegion FromJson(const QJsonObject& json);
+};
+
+/**
+ * @class VSImageArrayInfo VSImageRegionReader.h SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h
+ * @brief This struct describes a cell DataArray of an ImageGeom DataContainer that is read from
+ * file on demand instead of being kept in memory.
+ */
+struct SIMPLVtkLib_EXPORT VSImageArrayInfo
+{
+  QString m_AttributeMatrix;
+  QString m_Name;
+  QString m_TypeName;
+  QVector<size_t> m_CompDims;
+
+  /**
+   * @brief Returns the number of values stored for each voxel
+   * @return
+   */
+  size_t getNumberOfComponents() const;
+
+  /**
+   * @brief Returns the number of bytes used by each component or 0 for unsupported types
+   * @return
+   */
+  size_t getTypeSize() const;
+
+  /**
+   * @brief Writes the array description to json
+   * @return
+   */
+  QJsonObject toJson() const;
+
+  /**
+   * @brief Reads an array description from json
+   * @param json
+   * @return
+   */
+  static VSImageArrayInfo FromJson(const QJsonObject& json);
+};
+
+/**
+ * @class VSImageRefinement VSImageRegionReader.h SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h
+ * @brief This struct describes the levels still to be read while an ImageGeom is imported progressively.
+ * The levels are ordered from coarse to fine and the last level is the region the user asked for.
+ * Only the arrays already in memory are read for the intermediate levels while the proxy's arrays
+ * are read for the last level.
+ */
+struct SIMPLVtkLib_EXPORT VSImageRefinement
+{
+  DataContainerArrayProxy m_Proxy;
+  QList<VSImageRegion> m_Levels;
+};
+
+/**
+ * @class VSImageRegionReader VSImageRegionReader.h SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h
+ * @brief This class reads regions of interest of ImageGeom DataContainers from .dream3d files.
+ * The file structure and geometry are read through SIMPLH5DataReader, but each selected cell array
+ * is read as a single HDF5 hyperslab covering the region so only the requested voxels are read from
+ * disk.  The geometry's dimensions, origin, and resolution are adjusted to the region.  DataContainers
+ * with other geometries are read in full.  Only DataArrays can be read by region; other cell arrays
+ * such as StringDataArrays are skipped.  Every read holds the process-wide HDF5 lock.
+ */
+class SIMPLVtkLib_EXPORT VSImageRegionReader
+{
+public:
+  virtual ~VSImageRegionReader() = default;
+
+  /**
+   * @brief Returns the lock that serializes HDF5 access for the whole process.  HDF5 is not
+   * guaranteed to be thread safe, so code that opens a file with SIMPLH5DataReader must hold
+   * this lock until the reader is destroyed.  The lock is recursive so the functions below,
+   * which take it themselves, can be called while it is held.
+   * @return
+   */
+  static QMutex& GetHDF5Lock();
+
+  /**
+   * @brief Reads the full ImageGeom of the named DataContainer without any arrays.  Returns
+   * nullptr if the DataContainer does not have an ImageGeom.
+   * @param filePath
+   * @param dcName
+   * @return
+   */
+  static ImageGeom::Pointer ReadImageGeometry(const QString& filePath, const QString& dcName);
+
+  /**
+   * @brief Reads the checked items of the proxy with each ImageGeom DataContainer limited to the
+   * given region.  Returns nullptr and sets the error message if the file could not be read.
+   * @param filePath
+   * @param proxy
+   * @param region
+   * @param errorMessage
+   * @return
+   */
+  static DataContainerArray::Pointer ReadDataContainerArray(const QString& filePath, DataContainerArrayProxy proxy, const VSImageRegion& region, QString& errorMessage);
+
+  /**
+   * @brief Reads the checked items of the proxy with each ImageGeom DataContainer found in the map
+   * limited to its region.  Other DataContainers are read in full.  Returns nullptr and sets the
+   * error message if the file could not be read.
+   * @param filePath
+   * @param proxy
+   * @param regions
+   * @param errorMessage
+   * @return
+   */
+  static DataContainerArray::Pointer ReadDataContainerArray(const QString& filePath, DataContainerArrayProxy proxy, const QMap<QString, VSImageRegion>& regions, QString& errorMessage);
+
+  /**
+   * @brief Returns the levels used to read a region progressively, ordered from coarse to fine.
+   * The stride of the first level is the region's stride multiplied by the smallest power of two
+   * that reads no more than the given number of voxels.  Each following level halves the stride
+   * until the last level, which is the region itself.
+   * @param region
+   * @param maxCoarseVoxels
+   * @return
+   */
+  static QList<VSImageRegion> CreateRefinementLevels(const VSImageRegion& region, size_t maxCoarseVoxels);
+
+  /**
+   * @brief Returns the checked cell DataArrays of the DataContainer proxy that can be read by region
+   * @param dcProxy
+   * @return
+   */
+  static QList<VSImageArrayInfo> GetCellArrays(const DataContainerProxy& dcProxy);
+
+  /**
+   * @brief Unchecks every cell array of the DataContainer so that only its geometry is read
+   * @param dcProxy
+   */
+  static void UncheckCellArrays(DataContainerProxy& dcProxy);
+
+  /**
+   * @brief Fills in the description of the named cell array regardless of whether it is checked.
+   * Returns false if the array is not a supported cell array of the DataContainer.
+   * @param dcProxy
+   * @param amName
+   * @param arrayName
+   * @param arrayInfo
+   * @return
+   */
+  static bool FindCellArray(const DataContainerProxy& dcProxy, const QString& amName, const QString& arrayName, VSImageArrayInfo& arrayInfo);
+
+  /**
+   * @brief Reads the region of a single cell array into the buffer.  The buffer must hold the
+   * region's voxels and their components ordered with X varying fastest.  Returns false and sets
+   * the error message if the array could not be read.
+   * @param filePath
+   * @param dcName
+   * @param arrayInfo
+   * @param region
+   * @param buffer
+   * @param errorMessage
+   * @return
+   */
+  static bool ReadArrayRegion(const QString& filePath, const QString& dcName, const VSImageArrayInfo& arrayInfo, const VSImageRegion& region, void* buffer, QString& errorMessage);
+
+  /**
+   * @brief Reads the region of a single cell array converted to double values.  The values are
+   * ordered as they are by ReadArrayRegion.  Returns false and sets the error message if the
+   * array could not be read.
+   * @param filePath
+   * @param dcName
+   * @param arrayInfo
+   * @param region
+   * @param values
+   * @param errorMessage
+   * @return
+   */
+  static bool ReadArrayRegionValues(const QString& filePath, const QString& dcName, const VSImageArrayInfo& arrayInfo, const VSImageRegion& region, std::vector<double>& values,
+                                    QString& errorMessage);
+
+  /**
+   * @brief Creates a copy of a DataContainer previously read for the old region expanded to
+   * the new region.  Voxels already in memory are copied and only the missing slabs are read
+   * from the file.  The new region must use the same stride and line up with the old region,
+   * otherwise the whole new region is read.  Returns nullptr and sets the error message if the
+   * file could not be read.
+   * @param filePath
+   * @param dc
+   * @param oldRegion
+   * @param newRegion
+   * @param errorMessage
+   * @return
+   */
+  static DataContainer::Pointer ExpandDataContainer(const QString& filePath, DataContainer::Pointer dc, const VSImageRegion& oldRegion, const VSImageRegion& newRegion, QString& errorMessage);
+
+protected:
+  VSImageRegionReader() = default;
+
+  /**
+   * @brief Sets the geometry's dimensions, origin, and resolution to those of the region within
+   * the full geometry
+   * @param geom
+   * @param fullGeom
+   * @param region
+   */
+  static void ApplyRegion(ImageGeom::Pointer geom, ImageGeom::Pointer fullGeom, const VSImageRegion& region);
+
+  /**
+   * @brief Creates a DataArray of the given primitive type name such as "float" or "int32_t".
+   * Returns nullptr for unsupported types.
+   * @param typeName
+   * @param tupleDims
+   * @param compDims
+   * @param name
+   * @return
+   */
+  static IDataArray::Pointer CreateDataArray(const QString& typeName, const QVector<size_t>& tupleDims, const QVector<size_t>& compDims, const QString& name);
+
+private:
+  VSImageRegionReader(const VSImageRegionReader&); // Copy Constructor Not Implemented
+  void operator=(const VSImageRegionReader&);      // Operator '=' Not Implemented
+};
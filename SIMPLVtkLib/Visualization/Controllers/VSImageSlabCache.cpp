@@ -0,0 +1,399 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSImageSlabCache.h"
+
+#include <algorithm>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+
+#include <QtCore/QObject>
+#include <QtConcurrent/QtConcurrentRun>
+
+namespace
+{
+const size_t DefaultMaxSize = 512ull * 1024 * 1024;
+
+/**
+ * @brief Returns the VTK type used to store the given primitive type or -1 if it is not supported
+ * @param typeName
+ * @return
+ */
+int VtkType(const QString& typeName)
+{
+  if(typeName == "float")
+  {
+    return VTK_FLOAT;
+  }
+  if(typeName == "double")
+  {
+    return VTK_DOUBLE;
+  }
+  if(typeName == "int8_t")
+  {
+    return VTK_SIGNED_CHAR;
+  }
+  if(typeName == "uint8_t" || typeName == "bool")
+  {
+    return VTK_UNSIGNED_CHAR;
+  }
+  if(typeName == "int16_t")
+  {
+    return VTK_SHORT;
+  }
+  if(typeName == "uint16_t")
+  {
+    return VTK_UNSIGNED_SHORT;
+  }
+  if(typeName == "int32_t")
+  {
+    return VTK_INT;
+  }
+  if(typeName == "uint32_t")
+  {
+    return VTK_UNSIGNED_INT;
+  }
+  if(typeName == "int64_t")
+  {
+    return VTK_LONG_LONG;
+  }
+  if(typeName == "uint64_t")
+  {
+    return VTK_UNSIGNED_LONG_LONG;
+  }
+
+  return -1;
+}
+} // namespace
+
+VSImageSlabCache* VSImageSlabCache::m_Self = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSImageSlabRequest::getKey() const
+{
+  return QString("%1|%2|%3|%4|%5|%6").arg(m_FilePath).arg(m_DataContainer).arg(m_Array.m_AttributeMatrix).arg(m_Array.m_Name).arg(m_Axis).arg(static_cast<qulonglong>(m_Index));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSlabRequest VSImageSlabRequest::withIndex(size_t index) const
+{
+  VSImageSlabRequest request = *this;
+  request.m_Index = index;
+  return request;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSlabCache::VSImageSlabCache()
+: m_CacheLock(1)
+, m_MaxSize(DefaultMaxSize)
+, m_Generation(0)
+{
+  // A single prefetch thread leaves the file free for the slab being viewed between reads
+  m_PrefetchPool.setMaxThreadCount(1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageSlabCache* VSImageSlabCache::Instance()
+{
+  if(nullptr == m_Self)
+  {
+    m_Self = new VSImageSlabCache();
+  }
+
+  return m_Self;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImageSlabCache::getMaxSize() const
+{
+  return m_MaxSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::setMaxSize(size_t maxSize)
+{
+  m_CacheLock.acquire();
+  m_MaxSize = maxSize;
+  evictSlabs();
+  m_CacheLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSImageSlabCache::getSize() const
+{
+  m_CacheLock.acquire();
+  size_t size = m_Size;
+  m_CacheLock.release();
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSImageSlabCache::findSlab(const VSImageSlabRequest& request)
+{
+  QString key = request.getKey();
+  m_Generation++;
+
+  m_CacheLock.acquire();
+  VTK_PTR(vtkImageData) slab = nullptr;
+  if(m_Entries.contains(key))
+  {
+    m_UsageOrder.remove(key);
+    m_UsageOrder.push_back(key);
+    slab = m_Entries[key].first;
+  }
+  m_CacheLock.release();
+
+  return slab;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSImageSlabCache::getSlab(const VSImageSlabRequest& request, QString& errorMessage)
+{
+  QString key = request.getKey();
+
+  VTK_PTR(vtkImageData) cachedSlab = findSlab(request);
+  if(cachedSlab)
+  {
+    return cachedSlab;
+  }
+
+  // Slabs are read under the process-wide HDF5 lock.  Stale prefetches skip their read once they
+  // have the lock, and a prefetch of the same slab may finish while waiting for it.
+  QMutex& readLock = VSImageRegionReader::GetHDF5Lock();
+  readLock.lock();
+  m_CacheLock.acquire();
+  bool found = m_Entries.contains(key);
+  VTK_PTR(vtkImageData) slab = found ? m_Entries[key].first : nullptr;
+  m_CacheLock.release();
+  if(false == found)
+  {
+    slab = readSlab(request, errorMessage);
+  }
+  readLock.unlock();
+
+  if(slab && false == found)
+  {
+    m_CacheLock.acquire();
+    insertSlab(key, slab);
+    m_CacheLock.release();
+  }
+
+  return slab;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::prefetch(const VSImageSlabRequest& request)
+{
+  QString key = request.getKey();
+
+  m_CacheLock.acquire();
+  bool cached = m_Entries.contains(key);
+  bool queued = m_PendingKeys.contains(key);
+  if(false == cached)
+  {
+    // Requesting a slab that is already queued keeps it from being skipped
+    m_PendingKeys[key] = m_Generation;
+  }
+  m_CacheLock.release();
+
+  if(false == cached && false == queued)
+  {
+    QtConcurrent::run(&m_PrefetchPool, this, &VSImageSlabCache::prefetchSlab, request);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSImageSlabCache::isPrefetchCurrent(const QString& key) const
+{
+  return m_PendingKeys.contains(key) && m_PendingKeys[key] == m_Generation;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::prefetchSlab(VSImageSlabRequest request)
+{
+  QString key = request.getKey();
+
+  QMutex& readLock = VSImageRegionReader::GetHDF5Lock();
+  readLock.lock();
+  m_CacheLock.acquire();
+  bool skip = m_Entries.contains(key) || false == isPrefetchCurrent(key);
+  m_CacheLock.release();
+
+  QString errorMessage;
+  VTK_PTR(vtkImageData) slab = skip ? nullptr : readSlab(request, errorMessage);
+  readLock.unlock();
+
+  m_CacheLock.acquire();
+  if(slab)
+  {
+    insertSlab(key, slab);
+  }
+  m_PendingKeys.remove(key);
+  m_CacheLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkImageData) VSImageSlabCache::readSlab(const VSImageSlabRequest& request, QString& errorMessage)
+{
+  int vtkType = VtkType(request.m_Array.m_TypeName);
+  if(vtkType < 0 || request.m_Axis < 0 || request.m_Axis > 2 || request.m_Index >= request.m_Dims[request.m_Axis])
+  {
+    errorMessage = QObject::tr("The slab of '%1' could not be read because it is outside of the volume or of an unsupported type.").arg(request.m_Array.m_Name);
+    return nullptr;
+  }
+
+  VSImageRegion region;
+  for(int axis = 0; axis < 3; axis++)
+  {
+    region.m_Min[axis] = (axis == request.m_Axis) ? request.m_Index : 0;
+    region.m_Max[axis] = (axis == request.m_Axis) ? request.m_Index : request.m_Dims[axis] - 1;
+  }
+
+  size_t dims[3];
+  region.getDimensions(dims);
+
+  VTK_PTR(vtkDataArray) dataArray;
+  dataArray.TakeReference(vtkDataArray::CreateDataArray(vtkType));
+  dataArray->SetName(qPrintable(request.m_Array.m_Name));
+  dataArray->SetNumberOfComponents(static_cast<int>(request.m_Array.getNumberOfComponents()));
+  dataArray->SetNumberOfTuples(static_cast<vtkIdType>(dims[0] * dims[1] * dims[2]));
+  if(false == VSImageRegionReader::ReadArrayRegion(request.m_FilePath, request.m_DataContainer, request.m_Array, region, dataArray->GetVoidPointer(0), errorMessage))
+  {
+    return nullptr;
+  }
+
+  // The slab covers its voxels' cells, so the image has one more point than cell along each axis
+  VTK_NEW(vtkImageData, slab);
+  slab->SetDimensions(static_cast<int>(dims[0] + 1), static_cast<int>(dims[1] + 1), static_cast<int>(dims[2] + 1));
+  slab->SetSpacing(request.m_Spacing);
+  double origin[3] = {request.m_Origin[0], request.m_Origin[1], request.m_Origin[2]};
+  origin[request.m_Axis] += request.m_Index * request.m_Spacing[request.m_Axis];
+  slab->SetOrigin(origin);
+  slab->GetCellData()->AddArray(dataArray);
+  slab->GetCellData()->SetActiveScalars(dataArray->GetName());
+  return slab;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::insertSlab(const QString& key, VTK_PTR(vtkImageData) slab)
+{
+  if(m_Entries.contains(key))
+  {
+    return;
+  }
+
+  size_t size = static_cast<size_t>(slab->GetActualMemorySize()) * 1024;
+  m_Entries[key] = std::make_pair(slab, size);
+  m_UsageOrder.push_back(key);
+  m_Size += size;
+
+  evictSlabs();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::evictSlabs()
+{
+  // The most recently used slab is kept even if it is larger than the limit
+  while(m_Size > m_MaxSize && m_UsageOrder.size() > 1)
+  {
+    QString key = m_UsageOrder.front();
+    m_UsageOrder.pop_front();
+    m_Size -= m_Entries.take(key).second;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::clear(const QString& filePath)
+{
+  m_CacheLock.acquire();
+  for(std::list<QString>::iterator iter = m_UsageOrder.begin(); iter != m_UsageOrder.end();)
+  {
+    if(iter->startsWith(filePath + "|"))
+    {
+      m_Size -= m_Entries.take(*iter).second;
+      iter = m_UsageOrder.erase(iter);
+    }
+    else
+    {
+      iter++;
+    }
+  }
+  m_CacheLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSImageSlabCache::clear()
+{
+  m_CacheLock.acquire();
+  m_Entries.clear();
+  m_UsageOrder.clear();
+  m_Size = 0;
+  m_CacheLock.release();
+}
@@ -0,0 +1,218 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+#include <list>
+
+#include <vtkImageData.h>
+
+#include <QtCore/QMap>
+#include <QtCore/QSemaphore>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSImageSlabRequest VSImageSlabCache.h SIMPLVtkLib/Visualization/Controllers/VSImageSlabCache.h
+ * @brief This struct describes a single voxel thick slab of a cell array perpendicular to one of
+ * the axes of an ImageGeom stored in a .dream3d file.  The geometry values describe the full volume.
+ */
+struct SIMPLVtkLib_EXPORT VSImageSlabRequest
+{
+  QString m_FilePath;
+  QString m_DataContainer;
+  VSImageArrayInfo m_Array;
+  size_t m_Dims[3] = {0, 0, 0};
+  double m_Origin[3] = {0.0, 0.0, 0.0};
+  double m_Spacing[3] = {1.0, 1.0, 1.0};
+  int m_Axis = 2;
+  size_t m_Index = 0;
+
+  /**
+   * @brief Returns the key the slab is stored under
+   * @return
+   */
+  QString getKey() const;
+
+  /**
+   * @brief Returns a copy of the request for another slab along the same axis
+   * @param index
+   * @return
+   */
+  VSImageSlabRequest withIndex(size_t index) const;
+};
+
+/**
+ * @class VSImageSlabCache VSImageSlabCache.h SIMPLVtkLib/Visualization/Controllers/VSImageSlabCache.h
+ * @brief This class reads slabs of ImageGeom cell arrays from .dream3d files for viewing sections
+ * of volumes that are not kept in memory.  Each slab is read as a single HDF5 hyperslab and
+ * returned as a vtkImageData one cell thick.  The most recently used slabs are kept until the
+ * cache grows past its size limit.  Slabs can be prefetched on a background thread so that
+ * neighbouring sections are ready before they are requested.  Each slab requested through
+ * findSlab or getSlab starts a new generation, and prefetches not requested again since then
+ * are skipped so that they never delay the slab being viewed.
+ */
+class SIMPLVtkLib_EXPORT VSImageSlabCache
+{
+public:
+  /**
+   * @brief Returns the shared slab cache
+   * @return
+   */
+  static VSImageSlabCache* Instance();
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSImageSlabCache() = default;
+
+  /**
+   * @brief Returns the maximum number of bytes kept in memory
+   * @return
+   */
+  size_t getMaxSize() const;
+
+  /**
+   * @brief Sets the maximum number of bytes kept in memory.  The least recently used slabs
+   * are removed until the cache fits.
+   * @param maxSize
+   */
+  void setMaxSize(size_t maxSize);
+
+  /**
+   * @brief Returns the number of bytes currently kept in memory
+   * @return
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Returns the requested slab if it is already cached without reading from file.
+   * Prefetches requested before this call are skipped unless they are requested again.
+   * @param request
+   * @return
+   */
+  VTK_PTR(vtkImageData) findSlab(const VSImageSlabRequest& request);
+
+  /**
+   * @brief Returns the requested slab, reading it from file if it is not already cached.
+   * Prefetches requested before this call are skipped unless they are requested again.
+   * Returns nullptr and sets the error message if the slab could not be read.
+   * @param request
+   * @param errorMessage
+   * @return
+   */
+  VTK_PTR(vtkImageData) getSlab(const VSImageSlabRequest& request, QString& errorMessage);
+
+  /**
+   * @brief Reads the requested slab on a background thread unless it is already cached or being
+   * read.  Prefetches are read one at a time in the order they were requested.
+   * @param request
+   */
+  void prefetch(const VSImageSlabRequest& request);
+
+  /**
+   * @brief Removes every slab read from the given file
+   * @param filePath
+   */
+  void clear(const QString& filePath);
+
+  /**
+   * @brief Removes every slab
+   */
+  void clear();
+
+protected:
+  /**
+   * @brief Constructor
+   */
+  VSImageSlabCache();
+
+  /**
+   * @brief Reads the slab from file.  Reads are performed one at a time.
+   * @param request
+   * @param errorMessage
+   * @return
+   */
+  VTK_PTR(vtkImageData) readSlab(const VSImageSlabRequest& request, QString& errorMessage);
+
+  /**
+   * @brief Reads and stores a slab on a background thread unless it has not been requested
+   * since the last findSlab or getSlab call
+   * @param request
+   */
+  void prefetchSlab(VSImageSlabRequest request);
+
+  /**
+   * @brief Returns true if the prefetch for the key was requested in the current generation.
+   * The cache lock must be held by the caller.
+   * @param key
+   * @return
+   */
+  bool isPrefetchCurrent(const QString& key) const;
+
+  /**
+   * @brief Stores the slab and removes the least recently used slabs until the cache fits
+   * its size limit.  The cache lock must be held by the caller.
+   * @param key
+   * @param slab
+   */
+  void insertSlab(const QString& key, VTK_PTR(vtkImageData) slab);
+
+  /**
+   * @brief Removes least recently used slabs until the cache fits its size limit.  The cache
+   * lock must be held by the caller.
+   */
+  void evictSlabs();
+
+private:
+  using CacheEntry = std::pair<VTK_PTR(vtkImageData), size_t>;
+
+  static VSImageSlabCache* m_Self;
+
+  mutable QSemaphore m_CacheLock;
+  size_t m_MaxSize;
+  size_t m_Size = 0;
+  QMap<QString, CacheEntry> m_Entries;
+  std::list<QString> m_UsageOrder;
+  QMap<QString, int> m_PendingKeys;
+  std::atomic<int> m_Generation;
+  QThreadPool m_PrefetchPool;
+};
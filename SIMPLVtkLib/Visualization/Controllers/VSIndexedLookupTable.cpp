@@ -0,0 +1,295 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSIndexedLookupTable.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <vtkDataArray.h>
+#include <vtkSMPTools.h>
+#include <vtkUnsignedCharArray.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSIndexedDataArray.hpp"
+
+namespace
+{
+/**
+ * @brief Copies each tuple's color from the source color at its index.  Indices outside
+ * of the source use the given fallback color.
+ * @param indices
+ * @param numTuples
+ * @param sourceColors
+ * @param numSourceTuples
+ * @param fallback
+ * @param numComps
+ * @param colors
+ */
+template <typename T>
+void GatherColors(const T* indices, vtkIdType numTuples, const unsigned char* sourceColors, vtkIdType numSourceTuples, const unsigned char* fallback, int numComps,
+                  unsigned char* colors)
+{
+  vtkSMPTools::For(0, numTuples, [=](vtkIdType begin, vtkIdType end) {
+    for(vtkIdType i = begin; i < end; i++)
+    {
+      const vtkIdType index = static_cast<vtkIdType>(indices[i]);
+      const unsigned char* color = (index < 0 || index >= numSourceTuples) ? fallback : sourceColors + index * numComps;
+      std::memcpy(colors + i * numComps, color, numComps);
+    }
+  });
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSIndexedLookupTable* VSIndexedLookupTable::New()
+{
+  return new VSIndexedLookupTable();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSIndexedLookupTable::VSIndexedLookupTable()
+: vtkScalarsToColors()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Lookup Table: " << m_LookupTable.Get() << endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::SetLookupTable(vtkScalarsToColors* lookupTable)
+{
+  if(lookupTable != m_LookupTable)
+  {
+    m_LookupTable = lookupTable;
+    Modified();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkScalarsToColors* VSIndexedLookupTable::GetLookupTable() const
+{
+  return m_LookupTable;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkUnsignedCharArray* VSIndexedLookupTable::MapScalars(vtkDataArray* scalars, int colorMode, int component, int outputFormat)
+{
+  return MapScalars(static_cast<vtkAbstractArray*>(scalars), colorMode, component, outputFormat);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkUnsignedCharArray* VSIndexedLookupTable::MapScalars(vtkAbstractArray* scalars, int colorMode, int component, int outputFormat)
+{
+  if(nullptr == m_LookupTable)
+  {
+    return Superclass::MapScalars(scalars, colorMode, component, outputFormat);
+  }
+
+  VSIndexedArray* indexedArray = dynamic_cast<VSIndexedArray*>(scalars);
+  if(nullptr == indexedArray)
+  {
+    return m_LookupTable->MapScalars(scalars, colorMode, component, outputFormat);
+  }
+
+  vtkDataArray* source = indexedArray->GetSource();
+  vtkDataArray* indices = indexedArray->GetIndices();
+  vtkUnsignedCharArray* sourceColors = m_LookupTable->MapScalars(source, colorMode, component, outputFormat);
+  if(nullptr == sourceColors)
+  {
+    return nullptr;
+  }
+
+  // VSIndexedDataArray reads 0 for indices outside of the source
+  VTK_PTR(vtkDataArray) zero;
+  zero.TakeReference(source->NewInstance());
+  zero->SetNumberOfComponents(source->GetNumberOfComponents());
+  zero->SetNumberOfTuples(1);
+  for(int i = 0; i < source->GetNumberOfComponents(); i++)
+  {
+    zero->SetComponent(0, i, 0.0);
+  }
+  vtkUnsignedCharArray* zeroColor = m_LookupTable->MapScalars(zero, colorMode, component, outputFormat);
+
+  const int numComps = sourceColors->GetNumberOfComponents();
+  const vtkIdType numTuples = indices->GetNumberOfTuples();
+  vtkUnsignedCharArray* colors = vtkUnsignedCharArray::New();
+  colors->SetNumberOfComponents(numComps);
+  colors->SetNumberOfTuples(numTuples);
+
+  const unsigned char* sourcePtr = sourceColors->GetPointer(0);
+  const unsigned char* zeroPtr = zeroColor->GetPointer(0);
+  unsigned char* colorPtr = colors->GetPointer(0);
+  switch(indices->GetDataType())
+  {
+    vtkTemplateMacro(GatherColors(static_cast<const VTK_TT*>(indices->GetVoidPointer(0)), numTuples, sourcePtr, sourceColors->GetNumberOfTuples(), zeroPtr, numComps, colorPtr));
+  default:
+    break;
+  }
+
+  sourceColors->Delete();
+  zeroColor->Delete();
+  return colors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkMTimeType VSIndexedLookupTable::GetMTime()
+{
+  vtkMTimeType time = Superclass::GetMTime();
+  if(m_LookupTable)
+  {
+    time = std::max(time, m_LookupTable->GetMTime());
+  }
+  return time;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::Build()
+{
+  if(m_LookupTable)
+  {
+    m_LookupTable->Build();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::SetRange(double min, double max)
+{
+  if(m_LookupTable)
+  {
+    m_LookupTable->SetRange(min, max);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double* VSIndexedLookupTable::GetRange()
+{
+  return m_LookupTable ? m_LookupTable->GetRange() : Superclass::GetRange();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::SetAlpha(double alpha)
+{
+  Superclass::SetAlpha(alpha);
+  if(m_LookupTable)
+  {
+    m_LookupTable->SetAlpha(alpha);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSIndexedLookupTable::IsOpaque()
+{
+  return m_LookupTable ? m_LookupTable->IsOpaque() : Superclass::IsOpaque();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::GetColor(double v, double rgb[3])
+{
+  if(m_LookupTable)
+  {
+    m_LookupTable->GetColor(v, rgb);
+    return;
+  }
+  Superclass::GetColor(v, rgb);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double VSIndexedLookupTable::GetOpacity(double v)
+{
+  return m_LookupTable ? m_LookupTable->GetOpacity(v) : Superclass::GetOpacity(v);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const unsigned char* VSIndexedLookupTable::MapValue(double v)
+{
+  return m_LookupTable ? m_LookupTable->MapValue(v) : Superclass::MapValue(v);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSIndexedLookupTable::MapScalarsThroughTable2(void* input, unsigned char* output, int inputDataType, int numberOfValues, int inputIncrement, int outputFormat)
+{
+  if(m_LookupTable)
+  {
+    m_LookupTable->MapScalarsThroughTable2(input, output, inputDataType, numberOfValues, inputIncrement, outputFormat);
+    return;
+  }
+  Superclass::MapScalarsThroughTable2(input, output, inputDataType, numberOfValues, inputIncrement, outputFormat);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkIdType VSIndexedLookupTable::GetNumberOfAvailableColors()
+{
+  return m_LookupTable ? m_LookupTable->GetNumberOfAvailableColors() : Superclass::GetNumberOfAvailableColors();
+}
@@ -0,0 +1,105 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <vtkScalarsToColors.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSIndexedLookupTable VSIndexedLookupTable.h SIMPLVtkLib/Visualization/Controllers/VSIndexedLookupTable.h
+ * @brief This class colors VSIndexedDataArrays without reading them value by value.  The
+ * source array is mapped through the wrapped lookup table once per source tuple and each
+ * tuple's color is copied from its source tuple's color through the index array.  Every
+ * other array and call is passed to the wrapped lookup table.
+ */
+class SIMPLVtkLib_EXPORT VSIndexedLookupTable : public vtkScalarsToColors
+{
+public:
+  static VSIndexedLookupTable* New();
+  vtkTypeMacro(VSIndexedLookupTable, vtkScalarsToColors)
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * @brief Sets the lookup table used to map values
+   * @param lookupTable
+   */
+  void SetLookupTable(vtkScalarsToColors* lookupTable);
+
+  /**
+   * @brief Returns the lookup table used to map values
+   * @return
+   */
+  vtkScalarsToColors* GetLookupTable() const;
+
+  /**
+   * @brief Maps the scalars to colors.  VSIndexedDataArrays are mapped through their source array.
+   * @param scalars
+   * @param colorMode
+   * @param component
+   * @param outputFormat
+   * @return
+   */
+  vtkUnsignedCharArray* MapScalars(vtkDataArray* scalars, int colorMode, int component, int outputFormat = VTK_RGBA) override;
+  vtkUnsignedCharArray* MapScalars(vtkAbstractArray* scalars, int colorMode, int component, int outputFormat = VTK_RGBA) override;
+
+  /**
+   * @brief The remaining vtkScalarsToColors methods are passed to the wrapped lookup table
+   */
+  vtkMTimeType GetMTime() override;
+  void Build() override;
+  void SetRange(double min, double max) override;
+  using vtkScalarsToColors::SetRange;
+  double* GetRange() override;
+  void SetAlpha(double alpha) override;
+  int IsOpaque() override;
+  void GetColor(double v, double rgb[3]) override;
+  double GetOpacity(double v) override;
+  const unsigned char* MapValue(double v) override;
+  void MapScalarsThroughTable2(void* input, unsigned char* output, int inputDataType, int numberOfValues, int inputIncrement, int outputFormat) override;
+  vtkIdType GetNumberOfAvailableColors() override;
+
+protected:
+  VSIndexedLookupTable();
+  ~VSIndexedLookupTable() override = default;
+
+private:
+  VTK_PTR(vtkScalarsToColors) m_LookupTable = nullptr;
+
+  VSIndexedLookupTable(const VSIndexedLookupTable&) = delete; // Copy Constructor Not Implemented
+  void operator=(const VSIndexedLookupTable&) = delete;       // Operator '=' Not Implemented
+};
@@ -0,0 +1,421 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSMemoryManager.h"
+
+#include <algorithm>
+
+#include <vtkDataSet.h>
+#include <vtkFieldData.h>
+#include <vtkPointSet.h>
+#include <vtkPoints.h>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QThread>
+
+#include "SIMPLVtkLib/Visualization/Controllers/VSRenderGeometry.h"
+
+namespace
+{
+const unsigned long DefaultBudget = 4ul * 1024 * 1024;
+const int MaxHistoryLength = 100;
+
+/**
+ * @brief Adds every array in the field data to the list
+ * @param fieldData
+ * @param arrays
+ */
+void CollectArrays(vtkFieldData* fieldData, std::vector<vtkAbstractArray*>& arrays)
+{
+  if(nullptr == fieldData)
+  {
+    return;
+  }
+
+  for(int i = 0; i < fieldData->GetNumberOfArrays(); i++)
+  {
+    vtkAbstractArray* array = fieldData->GetAbstractArray(i);
+    if(array)
+    {
+      arrays.push_back(array);
+    }
+  }
+}
+} // namespace
+
+VSMemoryManager* VSMemoryManager::m_Self = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSMemoryManager::VSMemoryManager()
+: QObject(nullptr)
+, m_FilterLock(1)
+, m_Budget(DefaultBudget)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSMemoryManager* VSMemoryManager::Instance()
+{
+  if(nullptr == m_Self)
+  {
+    m_Self = new VSMemoryManager();
+  }
+
+  return m_Self;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMemoryManager::isEnabled() const
+{
+  return m_Enabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::setEnabled(bool enabled)
+{
+  m_Enabled = enabled;
+  enforceBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSMemoryManager::getBudget() const
+{
+  return m_Budget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::setBudget(unsigned long budget)
+{
+  m_Budget = budget;
+  enforceBudget();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::addFilter(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  // Filters may be created on import threads
+  connect(filter, &QObject::destroyed, this, &VSMemoryManager::filterDestroyed, Qt::DirectConnection);
+
+  m_FilterLock.acquire();
+  m_LastUsed[filter] = m_UseCounter++;
+  m_FilterLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::filterDestroyed(QObject* filter)
+{
+  // The filter is already partially destroyed so it is only compared as a QObject
+  m_FilterLock.acquire();
+  for(auto iter = m_LastUsed.begin(); iter != m_LastUsed.end(); iter++)
+  {
+    if(static_cast<QObject*>(iter->first) == filter)
+    {
+      m_LastUsed.erase(iter);
+      break;
+    }
+  }
+  m_FilterLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::outputUsed(VSAbstractFilter* filter)
+{
+  m_FilterLock.acquire();
+  auto iter = m_LastUsed.find(filter);
+  if(iter != m_LastUsed.end())
+  {
+    iter->second = m_UseCounter++;
+  }
+  m_FilterLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::outputUpdated(VSAbstractFilter* filter)
+{
+  outputUsed(filter);
+
+  // Outputs are only released from the thread that displays them
+  if(QThread::currentThread() == thread())
+  {
+    enforceBudget();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSMemoryManager::CountMemory(vtkDataObject* dataObject, std::set<vtkObject*>& counted)
+{
+  if(nullptr == dataObject || false == counted.insert(dataObject).second)
+  {
+    return 0;
+  }
+
+  std::vector<vtkAbstractArray*> arrays;
+  CollectArrays(dataObject->GetFieldData(), arrays);
+
+  vtkDataSet* dataSet = vtkDataSet::SafeDownCast(dataObject);
+  if(dataSet)
+  {
+    CollectArrays(dataSet->GetPointData(), arrays);
+    CollectArrays(dataSet->GetCellData(), arrays);
+  }
+
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataObject);
+  if(pointSet && pointSet->GetPoints() && pointSet->GetPoints()->GetData())
+  {
+    arrays.push_back(pointSet->GetPoints()->GetData());
+  }
+
+  // Arrays shallow copied between outputs are only attributed to the first output counted
+  unsigned long size = dataObject->GetActualMemorySize();
+  for(vtkAbstractArray* array : arrays)
+  {
+    unsigned long arraySize = array->GetActualMemorySize();
+    size -= std::min(size, arraySize);
+    if(counted.insert(array).second)
+    {
+      size += arraySize;
+    }
+  }
+
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<VSAbstractFilter*> VSMemoryManager::getFiltersByDepth() const
+{
+  std::vector<std::pair<int, VSAbstractFilter*>> depths;
+  m_FilterLock.acquire();
+  for(const auto& lastUsed : m_LastUsed)
+  {
+    int depth = 0;
+    for(VSAbstractFilter* parent = lastUsed.first->getParentFilter(); parent; parent = parent->getParentFilter())
+    {
+      depth++;
+    }
+    depths.push_back(std::make_pair(depth, lastUsed.first));
+  }
+  m_FilterLock.release();
+
+  std::stable_sort(depths.begin(), depths.end(), [](const std::pair<int, VSAbstractFilter*>& a, const std::pair<int, VSAbstractFilter*>& b) { return a.first < b.first; });
+
+  std::vector<VSAbstractFilter*> filters;
+  filters.reserve(depths.size());
+  for(const auto& depth : depths)
+  {
+    filters.push_back(depth.second);
+  }
+  return filters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSMemoryManager::calculateUsage(std::map<VSAbstractFilter*, unsigned long>& filterUsage)
+{
+  filterUsage.clear();
+
+  std::set<vtkObject*> counted;
+  unsigned long total = 0;
+  std::vector<VSAbstractFilter*> filters = getFiltersByDepth();
+  for(VSAbstractFilter* filter : filters)
+  {
+    unsigned long size = CountMemory(filter->getResidentOutput(), counted);
+    size += CountMemory(filter->getResidentTransformedOutput(), counted);
+    size += VSRenderGeometry::GetSharedMemorySize(filter);
+
+    filterUsage[filter] = size;
+    total += size;
+  }
+
+  return total;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSMemoryManager::getUsage()
+{
+  std::map<VSAbstractFilter*, unsigned long> filterUsage;
+  return calculateUsage(filterUsage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMemoryManager::enforceBudget()
+{
+  if(false == m_Enabled || m_Enforcing)
+  {
+    return;
+  }
+
+  std::map<VSAbstractFilter*, unsigned long> filterUsage;
+  unsigned long usage = calculateUsage(filterUsage);
+  if(usage <= m_Budget)
+  {
+    emit memoryUsageChanged();
+    return;
+  }
+
+  m_Enforcing = true;
+
+  std::vector<std::pair<unsigned long long, VSAbstractFilter*>> usageOrder;
+  m_FilterLock.acquire();
+  for(const auto& lastUsed : m_LastUsed)
+  {
+    usageOrder.push_back(std::make_pair(lastUsed.second, lastUsed.first));
+  }
+  m_FilterLock.release();
+  std::sort(usageOrder.begin(), usageOrder.end());
+
+  for(const auto& lastUsed : usageOrder)
+  {
+    if(usage <= m_Budget)
+    {
+      break;
+    }
+
+    VSAbstractFilter* filter = lastUsed.second;
+    unsigned long filterSize = filterUsage[filter];
+    if(0 == filterSize || false == filter->releaseOutput())
+    {
+      continue;
+    }
+
+    // Shared arrays may now be attributed to another filter so the usage is counted again
+    unsigned long previousUsage = usage;
+    usage = calculateUsage(filterUsage);
+
+    m_EvictionCount++;
+    m_EvictionHistory.push_back(QString("%1  Released %2 (%3 KiB held, %4 KiB freed)")
+                                    .arg(QDateTime::currentDateTime().toString(Qt::ISODate))
+                                    .arg(filter->getText())
+                                    .arg(filterSize)
+                                    .arg(previousUsage - std::min(previousUsage, usage)));
+    while(m_EvictionHistory.size() > MaxHistoryLength)
+    {
+      m_EvictionHistory.pop_front();
+    }
+  }
+
+  m_Enforcing = false;
+  emit memoryUsageChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSMemoryManager::getEvictionCount() const
+{
+  return m_EvictionCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList VSMemoryManager::getEvictionHistory() const
+{
+  return m_EvictionHistory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSMemoryManager::createReport()
+{
+  std::map<VSAbstractFilter*, unsigned long> filterUsage;
+  unsigned long usage = calculateUsage(filterUsage);
+
+  QStringList lines;
+  lines << QString("Filter Outputs: %1 KiB used of %2 KiB budget%3").arg(usage).arg(m_Budget).arg(m_Enabled ? "" : " (not enforced)");
+
+  std::vector<VSAbstractFilter*> filters = getFiltersByDepth();
+  for(VSAbstractFilter* filter : filters)
+  {
+    QStringList states;
+    if(filter->isDisplayed())
+    {
+      states << "Visible";
+    }
+    if(filter->isOutputDirty())
+    {
+      states << "Not Executed";
+    }
+    if(filter->canReleaseOutput())
+    {
+      states << "Releasable";
+    }
+
+    QString state = states.isEmpty() ? QString() : QString(" [%1]").arg(states.join(", "));
+    lines << QString("  %1%2: %3 KiB").arg(filter->getText()).arg(state).arg(filterUsage[filter]);
+  }
+
+  lines << QString("Released Outputs: %1").arg(m_EvictionCount);
+  for(const QString& eviction : m_EvictionHistory)
+  {
+    lines << "  " + eviction;
+  }
+
+  return lines.join("\n");
+}
@@ -0,0 +1,198 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <vtkDataObject.h>
+
+#include <QtCore/QObject>
+#include <QtCore/QSemaphore>
+#include <QtCore/QStringList>
+
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSMemoryManager VSMemoryManager.h SIMPLVtkLib/Visualization/Controllers/VSMemoryManager.h
+ * @brief This class keeps the memory held by visual filter outputs within a budget.  Usage
+ * covers each filter's output, its vtkTransformFilter output, and the shared surface and
+ * outline geometry extracted for its views.  Arrays shared between outputs are only counted
+ * once.  When a filter finishes executing and the usage is over budget, the least recently
+ * used outputs that are hidden and can be generated again are released.  Released filters
+ * execute again the next time their output is requested.
+ */
+class SIMPLVtkLib_EXPORT VSMemoryManager : public QObject
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Returns the shared memory manager
+   * @return
+   */
+  static VSMemoryManager* Instance();
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSMemoryManager() = default;
+
+  /**
+   * @brief Returns true if outputs are released when over budget.  Returns false otherwise.
+   * @return
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Sets whether or not outputs are released when over budget
+   * @param enabled
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * @brief Returns the memory budget in kibibytes
+   * @return
+   */
+  unsigned long getBudget() const;
+
+  /**
+   * @brief Sets the memory budget in kibibytes and releases outputs until the usage fits
+   * @param budget
+   */
+  void setBudget(unsigned long budget);
+
+  /**
+   * @brief Starts tracking the given filter
+   * @param filter
+   */
+  void addFilter(VSAbstractFilter* filter);
+
+  /**
+   * @brief Marks the filter's output as the most recently used
+   * @param filter
+   */
+  void outputUsed(VSAbstractFilter* filter);
+
+  /**
+   * @brief Marks the filter's output as the most recently used and releases other outputs
+   * if the usage is over budget
+   * @param filter
+   */
+  void outputUpdated(VSAbstractFilter* filter);
+
+  /**
+   * @brief Returns the memory in kibibytes currently held by every tracked filter
+   * @return
+   */
+  unsigned long getUsage();
+
+  /**
+   * @brief Returns the number of outputs released since the application started
+   * @return
+   */
+  int getEvictionCount() const;
+
+  /**
+   * @brief Returns a description of each released output, oldest first
+   * @return
+   */
+  QStringList getEvictionHistory() const;
+
+  /**
+   * @brief Returns a report of the current usage per filter followed by the eviction history
+   * @return
+   */
+  QString createReport();
+
+  /**
+   * @brief Releases the least recently used outputs until the usage fits within the budget
+   */
+  void enforceBudget();
+
+signals:
+  void memoryUsageChanged();
+
+protected:
+  /**
+   * @brief Constructor
+   */
+  VSMemoryManager();
+
+  /**
+   * @brief Returns the memory in kibibytes held by the data object that is not part of an
+   * array or data object already in the counted set.  Counted objects are added to the set.
+   * @param dataObject
+   * @param counted
+   * @return
+   */
+  static unsigned long CountMemory(vtkDataObject* dataObject, std::set<vtkObject*>& counted);
+
+  /**
+   * @brief Returns the tracked filters with parents ahead of their children
+   * @return
+   */
+  std::vector<VSAbstractFilter*> getFiltersByDepth() const;
+
+  /**
+   * @brief Calculates the memory attributed to each tracked filter and returns the total
+   * @param filterUsage
+   * @return
+   */
+  unsigned long calculateUsage(std::map<VSAbstractFilter*, unsigned long>& filterUsage);
+
+protected slots:
+  /**
+   * @brief Stops tracking a destroyed filter
+   * @param filter
+   */
+  void filterDestroyed(QObject* filter);
+
+private:
+  static VSMemoryManager* m_Self;
+
+  mutable QSemaphore m_FilterLock;
+  std::map<VSAbstractFilter*, unsigned long long> m_LastUsed;
+  unsigned long long m_UseCounter = 0;
+  bool m_Enabled = true;
+  bool m_Enforcing = false;
+  unsigned long m_Budget;
+  int m_EvictionCount = 0;
+  QStringList m_EvictionHistory;
+};
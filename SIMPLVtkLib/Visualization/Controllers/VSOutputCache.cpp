@@ -0,0 +1,441 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSOutputCache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <QtConcurrent/QtConcurrentRun>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSDataSetSnapshot.h"
+
+namespace
+{
+const QString SnapshotSuffix = "vtc";
+const qint64 DefaultMaxSize = 1ll * 1024 * 1024 * 1024;
+const qint64 DefaultMinExecuteTime = 1000;
+} // namespace
+
+VSOutputCache* VSOutputCache::m_Self = nullptr;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOutputCache::VSOutputCache()
+: m_CacheLock(1)
+, m_MaxSize(DefaultMaxSize)
+, m_MinExecuteTime(DefaultMinExecuteTime)
+, m_HitCount(0)
+, m_MissCount(0)
+{
+  m_Directory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/FilterOutputs";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSOutputCache* VSOutputCache::Instance()
+{
+  if(nullptr == m_Self)
+  {
+    m_Self = new VSOutputCache();
+  }
+
+  return m_Self;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOutputCache::isEnabled() const
+{
+  return m_Enabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::setEnabled(bool enabled)
+{
+  m_Enabled = enabled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSOutputCache::getDirectory() const
+{
+  m_CacheLock.acquire();
+  QString directory = m_Directory;
+  m_CacheLock.release();
+  return directory;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::setDirectory(const QString& directory)
+{
+  m_CacheLock.acquire();
+  m_Directory = directory;
+  m_Entries.clear();
+  m_Size = 0;
+  m_IndexLoaded = false;
+  m_CacheLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 VSOutputCache::getMaxSize() const
+{
+  return m_MaxSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::setMaxSize(qint64 maxSize)
+{
+  m_CacheLock.acquire();
+  m_MaxSize = maxSize;
+  loadIndex();
+  evictSnapshots();
+  m_CacheLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 VSOutputCache::getMinExecuteTime() const
+{
+  return m_MinExecuteTime;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::setMinExecuteTime(qint64 msecs)
+{
+  m_MinExecuteTime = msecs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 VSOutputCache::getSize()
+{
+  m_CacheLock.acquire();
+  loadIndex();
+  qint64 size = m_Size;
+  m_CacheLock.release();
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSOutputCache::getCount()
+{
+  m_CacheLock.acquire();
+  loadIndex();
+  int count = m_Entries.size();
+  m_CacheLock.release();
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSOutputCache::getHitCount() const
+{
+  return m_HitCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSOutputCache::getMissCount() const
+{
+  return m_MissCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::resetCounts()
+{
+  m_HitCount = 0;
+  m_MissCount = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSOutputCache::getFilePath(const QByteArray& key) const
+{
+  return m_Directory + "/" + QString::fromLatin1(key.toHex()) + "." + SnapshotSuffix;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::loadIndex()
+{
+  if(m_IndexLoaded)
+  {
+    return;
+  }
+
+  m_IndexLoaded = true;
+  m_Entries.clear();
+  m_Size = 0;
+
+  // File modification times carry the usage order between sessions
+  QDir dir(m_Directory);
+  QFileInfoList fileInfos = dir.entryInfoList(QStringList("*." + SnapshotSuffix), QDir::Files);
+  for(const QFileInfo& fileInfo : fileInfos)
+  {
+    QByteArray key = QByteArray::fromHex(fileInfo.completeBaseName().toLatin1());
+    m_Entries[key] = CacheEntry(fileInfo.size(), fileInfo.lastModified().toMSecsSinceEpoch());
+    m_Size += fileInfo.size();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSOutputCache::contains(const QByteArray& key)
+{
+  if(false == m_Enabled || key.isEmpty())
+  {
+    return false;
+  }
+
+  m_CacheLock.acquire();
+  loadIndex();
+  bool found = m_Entries.contains(key);
+  m_CacheLock.release();
+  return found;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSOutputCache::find(const QByteArray& key)
+{
+  if(false == m_Enabled || key.isEmpty())
+  {
+    return nullptr;
+  }
+
+  m_CacheLock.acquire();
+  loadIndex();
+  bool found = m_Entries.contains(key);
+  QString filePath = getFilePath(key);
+  m_CacheLock.release();
+
+  if(false == found)
+  {
+    m_MissCount++;
+    return nullptr;
+  }
+
+  // The output's arrays point into the mapped snapshot and keep it mapped while they are used
+  VTK_PTR(vtkDataSet) output;
+  qint64 size = 0;
+  std::shared_ptr<const char> data = VSDataSetSnapshot::MapFile(filePath, size);
+  if(data)
+  {
+    output = VSDataSetSnapshot::Deserialize(data.get(), size, data);
+  }
+  data = nullptr;
+
+  m_CacheLock.acquire();
+  if(output)
+  {
+    QDateTime now = QDateTime::currentDateTime();
+    QFile file(filePath);
+    if(file.open(QIODevice::Append))
+    {
+      file.setFileTime(now, QFileDevice::FileModificationTime);
+      file.close();
+    }
+    if(m_Entries.contains(key))
+    {
+      m_Entries[key].second = now.toMSecsSinceEpoch();
+    }
+    m_HitCount++;
+  }
+  else
+  {
+    // Unreadable snapshots are removed so they are generated again
+    QFile::remove(filePath);
+    if(m_Entries.contains(key))
+    {
+      m_Size -= m_Entries[key].first;
+      m_Entries.remove(key);
+    }
+    m_MissCount++;
+  }
+  m_CacheLock.release();
+
+  return output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::store(const QByteArray& key, vtkDataSet* output, qint64 executeMSecs)
+{
+  if(false == m_Enabled || key.isEmpty() || nullptr == output || executeMSecs < m_MinExecuteTime)
+  {
+    return;
+  }
+
+  m_CacheLock.acquire();
+  loadIndex();
+  bool skip = m_Entries.contains(key) || m_PendingKeys.contains(key);
+  if(false == skip)
+  {
+    m_PendingKeys.insert(key);
+  }
+  m_CacheLock.release();
+
+  if(skip)
+  {
+    return;
+  }
+
+  // The snapshot is written from a shallow copy so the filter can execute again in the meantime
+  VTK_PTR(vtkDataSet) outputCopy;
+  outputCopy.TakeReference(output->NewInstance());
+  outputCopy->ShallowCopy(output);
+
+  QtConcurrent::run(this, &VSOutputCache::writeSnapshot, key, outputCopy);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::writeSnapshot(QByteArray key, VTK_PTR(vtkDataSet) output)
+{
+  m_CacheLock.acquire();
+  QString directory = m_Directory;
+  QString filePath = getFilePath(key);
+  m_CacheLock.release();
+
+  // The snapshot is written straight to the file and dropped if it is larger than the whole cache
+  bool written = false;
+  qint64 snapshotSize = 0;
+  if(QDir().mkpath(directory))
+  {
+    QSaveFile file(filePath);
+    if(file.open(QIODevice::WriteOnly) && VSDataSetSnapshot::Serialize(output, &file))
+    {
+      snapshotSize = file.size();
+      written = snapshotSize <= m_MaxSize && file.commit();
+    }
+  }
+
+  m_CacheLock.acquire();
+  m_PendingKeys.remove(key);
+  // Skip the entry if the directory was changed while writing
+  if(written && directory == m_Directory)
+  {
+    if(m_Entries.contains(key))
+    {
+      m_Size -= m_Entries[key].first;
+    }
+    m_Entries[key] = CacheEntry(snapshotSize, QDateTime::currentMSecsSinceEpoch());
+    m_Size += snapshotSize;
+    evictSnapshots();
+  }
+  m_CacheLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::evictSnapshots()
+{
+  if(m_Size <= m_MaxSize)
+  {
+    return;
+  }
+
+  std::vector<std::pair<qint64, QByteArray>> usageOrder;
+  usageOrder.reserve(m_Entries.size());
+  for(auto iter = m_Entries.constBegin(); iter != m_Entries.constEnd(); iter++)
+  {
+    usageOrder.push_back(std::make_pair(iter.value().second, iter.key()));
+  }
+  std::sort(usageOrder.begin(), usageOrder.end());
+
+  for(const auto& usage : usageOrder)
+  {
+    if(m_Size <= m_MaxSize)
+    {
+      break;
+    }
+
+    QFile::remove(getFilePath(usage.second));
+    m_Size -= m_Entries[usage.second].first;
+    m_Entries.remove(usage.second);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSOutputCache::clear()
+{
+  m_CacheLock.acquire();
+  loadIndex();
+  for(auto iter = m_Entries.constBegin(); iter != m_Entries.constEnd(); iter++)
+  {
+    QFile::remove(getFilePath(iter.key()));
+  }
+  m_Entries.clear();
+  m_Size = 0;
+  m_CacheLock.release();
+}
@@ -0,0 +1,235 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <atomic>
+
+#include <vtkDataSet.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMap>
+#include <QtCore/QSemaphore>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSOutputCache VSOutputCache.h SIMPLVtkLib/Visualization/Controllers/VSOutputCache.h
+ * @brief This class stores filter outputs in a content addressed cache directory so outputs
+ * generated once are reused whenever the same input and parameters are applied again, including
+ * after the application restarts.  Outputs are stored as VSDataSetSnapshots named after the
+ * VSAbstractFilter::getOutputKey() they were generated for.  Snapshots are written on a
+ * background thread.  The least recently used snapshots are removed once the cache grows
+ * past its size limit.  The cache is disabled until setEnabled is called, and only outputs
+ * that took longer than the minimum execution time to generate are stored.
+ */
+class SIMPLVtkLib_EXPORT VSOutputCache
+{
+public:
+  /**
+   * @brief Returns the shared output cache
+   * @return
+   */
+  static VSOutputCache* Instance();
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSOutputCache() = default;
+
+  /**
+   * @brief Returns true if the cache is used.  Returns false otherwise.  The cache is
+   * disabled by default.
+   * @return
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief Sets whether or not the cache is used
+   * @param enabled
+   */
+  void setEnabled(bool enabled);
+
+  /**
+   * @brief Returns the cache directory
+   * @return
+   */
+  QString getDirectory() const;
+
+  /**
+   * @brief Sets the cache directory.  Snapshots already stored in the directory are used.
+   * @param directory
+   */
+  void setDirectory(const QString& directory);
+
+  /**
+   * @brief Returns the maximum number of bytes stored in the cache directory
+   * @return
+   */
+  qint64 getMaxSize() const;
+
+  /**
+   * @brief Sets the maximum number of bytes stored in the cache directory.  The least
+   * recently used snapshots are removed until the cache fits.
+   * @param maxSize
+   */
+  void setMaxSize(qint64 maxSize);
+
+  /**
+   * @brief Returns the number of milliseconds an output must take to generate before it is stored
+   * @return
+   */
+  qint64 getMinExecuteTime() const;
+
+  /**
+   * @brief Sets the number of milliseconds an output must take to generate before it is
+   * stored.  Outputs that are cheaper to generate than to serialize are never stored.
+   * @param msecs
+   */
+  void setMinExecuteTime(qint64 msecs);
+
+  /**
+   * @brief Returns the number of bytes currently stored in the cache directory
+   * @return
+   */
+  qint64 getSize();
+
+  /**
+   * @brief Returns the number of snapshots currently stored in the cache directory
+   * @return
+   */
+  int getCount();
+
+  /**
+   * @brief Returns the number of lookups that found a stored output
+   * @return
+   */
+  int getHitCount() const;
+
+  /**
+   * @brief Returns the number of lookups that did not find a stored output
+   * @return
+   */
+  int getMissCount() const;
+
+  /**
+   * @brief Resets the hit and miss counts
+   */
+  void resetCounts();
+
+  /**
+   * @brief Returns true if an output is stored under the given key without reading it
+   * @param key
+   * @return
+   */
+  bool contains(const QByteArray& key);
+
+  /**
+   * @brief Returns the output stored under the given key or nullptr if none was found.
+   * Snapshots are read and decoded by the calling thread, so this should not be called
+   * from the GUI thread.
+   * @param key
+   * @return
+   */
+  VTK_PTR(vtkDataSet) find(const QByteArray& key);
+
+  /**
+   * @brief Stores the output under the given key on a background thread.  Outputs that took
+   * less than the minimum execution time to generate and outputs that are already stored or
+   * being stored are skipped.
+   * @param key
+   * @param output
+   * @param executeMSecs
+   */
+  void store(const QByteArray& key, vtkDataSet* output, qint64 executeMSecs);
+
+  /**
+   * @brief Removes every stored output
+   */
+  void clear();
+
+protected:
+  /**
+   * @brief Constructor
+   */
+  VSOutputCache();
+
+  /**
+   * @brief Reads the snapshots already stored in the cache directory.  The cache lock must
+   * be held by the caller.
+   */
+  void loadIndex();
+
+  /**
+   * @brief Returns the file path used for the given key
+   * @param key
+   * @return
+   */
+  QString getFilePath(const QByteArray& key) const;
+
+  /**
+   * @brief Serializes and writes the output to the cache directory
+   * @param key
+   * @param output
+   */
+  void writeSnapshot(QByteArray key, VTK_PTR(vtkDataSet) output);
+
+  /**
+   * @brief Removes least recently used snapshots until the cache fits its size limit.  The
+   * cache lock must be held by the caller.
+   */
+  void evictSnapshots();
+
+private:
+  using CacheEntry = std::pair<qint64, qint64>;
+
+  static VSOutputCache* m_Self;
+
+  mutable QSemaphore m_CacheLock;
+  bool m_Enabled = false;
+  bool m_IndexLoaded = false;
+  QString m_Directory;
+  qint64 m_MaxSize;
+  qint64 m_MinExecuteTime;
+  qint64 m_Size = 0;
+  QMap<QByteArray, CacheEntry> m_Entries;
+  QSet<QByteArray> m_PendingKeys;
+  std::atomic<int> m_HitCount;
+  std::atomic<int> m_MissCount;
+};
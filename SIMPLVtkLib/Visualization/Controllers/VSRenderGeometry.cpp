@@ -0,0 +1,322 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSRenderGeometry.h"
+
+#include <vtkAlgorithm.h>
+#include <vtkDataSetSurfaceFilter.h>
+#include <vtkImageData.h>
+#include <vtkPolyData.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSImageSurfaceFilter.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSTetrahedralGeom.h"
+#include "SIMPLVtkLib/SIMPLBridge/VSTetrahedralSurfaceFilter.h"
+
+std::map<VSAbstractFilter*, std::weak_ptr<VSRenderGeometry>> VSRenderGeometry::m_SharedGeometry;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderGeometry::Pointer VSRenderGeometry::Acquire(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return nullptr;
+  }
+
+  // Reuse the existing geometry as long as it still belongs to the same filter
+  auto iter = m_SharedGeometry.find(filter);
+  if(iter != m_SharedGeometry.end())
+  {
+    Pointer geometry = iter->second.lock();
+    if(geometry && geometry->getFilter() == filter)
+    {
+      return geometry;
+    }
+  }
+
+  Pointer geometry(new VSRenderGeometry(filter));
+  geometry->m_Shared = true;
+  m_SharedGeometry[filter] = geometry;
+  return geometry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderGeometry::Pointer VSRenderGeometry::Create(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return nullptr;
+  }
+
+  return Pointer(new VSRenderGeometry(filter));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t VSRenderGeometry::GetSharedCount()
+{
+  return m_SharedGeometry.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSRenderGeometry::GetSharedMemorySize(VSAbstractFilter* filter)
+{
+  auto iter = m_SharedGeometry.find(filter);
+  if(iter == m_SharedGeometry.end())
+  {
+    return 0;
+  }
+
+  Pointer geometry = iter->second.lock();
+  if(nullptr == geometry || geometry->getFilter() != filter)
+  {
+    return 0;
+  }
+
+  return geometry->getMemorySize();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderGeometry::VSRenderGeometry(VSAbstractFilter* filter)
+: m_Filter(filter)
+, m_FilterKey(filter)
+, m_OutlineFilter(VTK_PTR(vtkOutlineFilter)::New())
+{
+  updateInputPort(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSRenderGeometry::~VSRenderGeometry()
+{
+  if(false == m_Shared)
+  {
+    return;
+  }
+
+  // Only remove the map entry if it has not already been replaced
+  auto iter = m_SharedGeometry.find(m_FilterKey);
+  if(iter != m_SharedGeometry.end() && iter->second.expired())
+  {
+    m_SharedGeometry.erase(iter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSRenderGeometry::getFilter() const
+{
+  return m_Filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSRenderGeometry::getSurfaceOutputPort()
+{
+  if(m_PassThroughSurface && m_ArrayFilter)
+  {
+    return m_ArrayFilter->GetOutputPort();
+  }
+  if(m_PassThroughSurface && m_Filter)
+  {
+    return m_Filter->getTransformedOutputPort();
+  }
+
+  return m_SurfaceFilter->GetOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSRenderGeometry::getOutlineOutputPort()
+{
+  return m_OutlineFilter->GetOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderGeometry::updateInputPort(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  // Surface meshes such as TriangleGeom and QuadGeom are already vtkPolyData so running
+  // them through vtkDataSetSurfaceFilter would only copy every cell.
+  VTK_PTR(vtkDataSet) output = filter->getOutput();
+  m_PassThroughSurface = (nullptr != vtkPolyData::SafeDownCast(output));
+
+  // Tetrahedral meshes find their boundary faces from SIMPL's elements containing vertex
+  // list instead of hashing every face
+  bool isTetrahedral = (nullptr != VSTetrahedralGrid::SafeDownCast(output));
+
+  // Images only generate their boundary faces and skip the transformed structured grid copy
+  m_LocalSurface = (nullptr != vtkImageData::SafeDownCast(output));
+
+  if(isTetrahedral)
+  {
+    if(nullptr == VSTetrahedralSurfaceFilter::SafeDownCast(m_SurfaceFilter))
+    {
+      m_SurfaceFilter.TakeReference(VSTetrahedralSurfaceFilter::New());
+    }
+  }
+  else if(m_LocalSurface)
+  {
+    if(nullptr == VSImageSurfaceFilter::SafeDownCast(m_SurfaceFilter))
+    {
+      m_SurfaceFilter.TakeReference(VSImageSurfaceFilter::New());
+    }
+  }
+  else if(nullptr == vtkDataSetSurfaceFilter::SafeDownCast(m_SurfaceFilter))
+  {
+    m_SurfaceFilter.TakeReference(vtkDataSetSurfaceFilter::New());
+  }
+
+  vtkAlgorithmOutput* surfaceInput = m_LocalSurface ? filter->getOutputPort() : filter->getTransformedOutputPort();
+  if(m_ArrayFilter)
+  {
+    m_ArrayFilter->SetInputConnection(surfaceInput);
+    surfaceInput = m_ArrayFilter->GetOutputPort();
+  }
+
+  if(m_PassThroughSurface)
+  {
+    m_SurfaceFilter->RemoveAllInputConnections(0);
+  }
+  else
+  {
+    m_SurfaceFilter->SetInputConnection(surfaceInput);
+  }
+  m_OutlineFilter->SetInputConnection(filter->getOutputPort());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderGeometry::updateSurface()
+{
+  if(m_PassThroughSurface)
+  {
+    vtkAlgorithmOutput* surfacePort = getSurfaceOutputPort();
+    if(surfacePort && surfacePort->GetProducer())
+    {
+      surfacePort->GetProducer()->Update();
+    }
+    return;
+  }
+
+  m_SurfaceFilter->Update();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSRenderGeometry::setAdditionalArray(vtkDataArray* array, bool pointData)
+{
+  if(m_Shared || (nullptr == array && nullptr == m_ArrayFilter))
+  {
+    return;
+  }
+
+  bool connect = (nullptr == m_ArrayFilter);
+  if(connect)
+  {
+    m_ArrayFilter = VTK_PTR(VSAppendArrayFilter)::New();
+  }
+  m_ArrayFilter->SetArray(array);
+  m_ArrayFilter->SetPointData(pointData);
+
+  if(connect && m_Filter)
+  {
+    updateInputPort(m_Filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSRenderGeometry::isShared() const
+{
+  return m_Shared;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSRenderGeometry::isSurfacePassedThrough() const
+{
+  return m_PassThroughSurface;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSRenderGeometry::isSurfaceLocal() const
+{
+  return m_LocalSurface;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned long VSRenderGeometry::getMemorySize() const
+{
+  unsigned long size = 0;
+
+  // A passed through surface belongs to the filter
+  if(false == m_PassThroughSurface && m_SurfaceFilter->GetOutput())
+  {
+    size += m_SurfaceFilter->GetOutput()->GetActualMemorySize();
+  }
+  if(m_OutlineFilter->GetOutput())
+  {
+    size += m_OutlineFilter->GetOutput()->GetActualMemorySize();
+  }
+
+  return size;
+}
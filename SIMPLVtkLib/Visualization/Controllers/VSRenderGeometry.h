@@ -0,0 +1,190 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+
+#include <QtCore/QPointer>
+
+#include <vtkAlgorithmOutput.h>
+#include <vtkOutlineFilter.h>
+#include <vtkPolyDataAlgorithm.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSAppendArrayFilter.h"
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSRenderGeometry VSRenderGeometry.h SIMPLVtkLib/Visualization/Controllers/VSRenderGeometry.h
+ * @brief This class holds the render geometry extracted from a VSAbstractFilter's output.
+ * This includes the external surface and outline along with the arrays they carry for
+ * coloring.  A single instance is shared by every VSFilterViewSettings for a given filter
+ * so that split views do not extract and store the same surface multiple times.  Each view
+ * only owns its actor, mapper, and lookup table.  Instances are reference counted and
+ * released once the last view using them is destroyed.  Because the shared VTK pipeline
+ * only re-executes when the filter output's modification time changes, every view sees
+ * the same up-to-date geometry.  TetrahedralGeom outputs use VSTetrahedralSurfaceFilter
+ * and vtkImageData outputs use VSImageSurfaceFilter instead of vtkDataSetSurfaceFilter.
+ * Image surfaces are extracted from the untransformed output and are left in local
+ * coordinates so the transform has to be applied to the actor.  Views that color by an
+ * array of their own create unshared geometry that adds the array to a shallow copy of
+ * the output before extracting the surface.
+ */
+class SIMPLVtkLib_EXPORT VSRenderGeometry
+{
+public:
+  using Pointer = std::shared_ptr<VSRenderGeometry>;
+
+  /**
+   * @brief Returns the shared render geometry for the given filter, creating it if
+   * no view currently uses it.
+   * @param filter
+   * @return
+   */
+  static Pointer Acquire(VSAbstractFilter* filter);
+
+  /**
+   * @brief Creates render geometry for the given filter that is not shared with any other view
+   * @param filter
+   * @return
+   */
+  static Pointer Create(VSAbstractFilter* filter);
+
+  /**
+   * @brief Returns the number of filters with shared render geometry in use
+   * @return
+   */
+  static size_t GetSharedCount();
+
+  /**
+   * @brief Returns the memory in kibibytes used by the shared render geometry for the
+   * given filter or 0 if no view currently uses it.
+   * @param filter
+   * @return
+   */
+  static unsigned long GetSharedMemorySize(VSAbstractFilter* filter);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSRenderGeometry();
+
+  /**
+   * @brief Returns the filter the render geometry is extracted from
+   * @return
+   */
+  VSAbstractFilter* getFilter() const;
+
+  /**
+   * @brief Returns the output port for the filter's external surface.  Filters whose
+   * output is already vtkPolyData return their transformed output port directly.
+   * @return
+   */
+  vtkAlgorithmOutput* getSurfaceOutputPort();
+
+  /**
+   * @brief Returns the output port for the filter's outline
+   * @return
+   */
+  vtkAlgorithmOutput* getOutlineOutputPort();
+
+  /**
+   * @brief Connects the surface and outline to the given filter's output.  Reconnecting
+   * the current output does not cause the geometry to be extracted again.
+   * @param filter
+   */
+  void updateInputPort(VSAbstractFilter* filter);
+
+  /**
+   * @brief Brings the external surface up to date with the filter output
+   */
+  void updateSurface();
+
+  /**
+   * @brief Adds the array to the surface without modifying the filter output.  Passing
+   * nullptr removes it.  Shared geometry cannot carry additional arrays.
+   * @param array
+   * @param pointData
+   */
+  void setAdditionalArray(vtkDataArray* array, bool pointData);
+
+  /**
+   * @brief Returns true if the geometry is shared by every view of the filter
+   * @return
+   */
+  bool isShared() const;
+
+  /**
+   * @brief Returns true if the filter output is used as the surface without extraction
+   * @return
+   */
+  bool isSurfacePassedThrough() const;
+
+  /**
+   * @brief Returns true if the surface is in the filter's local coordinates and the
+   * filter's transform must be applied by the actor.
+   * @return
+   */
+  bool isSurfaceLocal() const;
+
+  /**
+   * @brief Returns the memory in kibibytes used by the extracted surface and outline
+   * @return
+   */
+  unsigned long getMemorySize() const;
+
+protected:
+  /**
+   * @brief Constructor
+   * @param filter
+   */
+  VSRenderGeometry(VSAbstractFilter* filter);
+
+private:
+  QPointer<VSAbstractFilter> m_Filter;
+  VSAbstractFilter* m_FilterKey = nullptr;
+  VTK_PTR(vtkPolyDataAlgorithm) m_SurfaceFilter = nullptr;
+  VTK_PTR(vtkOutlineFilter) m_OutlineFilter = nullptr;
+  VTK_PTR(VSAppendArrayFilter) m_ArrayFilter = nullptr;
+  bool m_Shared = false;
+  bool m_PassThroughSurface = false;
+  bool m_LocalSurface = false;
+
+  static std::map<VSAbstractFilter*, std::weak_ptr<VSRenderGeometry>> m_SharedGeometry;
+};
@@ -0,0 +1,370 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSSessionBundle.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSDataSetSnapshot.h"
+
+namespace
+{
+const quint32 BundleMagic = 0x56535342;
+const quint32 BundleVersion = 2;
+const QDataStream::Version BundleStreamVersion = QDataStream::Qt_5_6;
+
+// Snapshots start on this boundary so their arrays can be used in place from the mapping
+const qint64 SnapshotAlignment = 64;
+
+// The last bytes of the file hold the position of the snapshot table
+const qint64 TrailerSize = sizeof(qint64);
+} // namespace
+
+VSSessionBundle::Pointer VSSessionBundle::m_ActiveBundle = nullptr;
+QSemaphore VSSessionBundle::m_ActiveBundleLock(1);
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSessionBundle::VSSessionBundle(const QString& filePath)
+: m_FilePath(filePath)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSessionBundle::~VSSessionBundle() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundle::IsBundle(const QString& filePath)
+{
+  QFile file(filePath);
+  if(false == file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+
+  QDataStream stream(&file);
+  stream.setVersion(BundleStreamVersion);
+
+  quint32 magic = 0;
+  stream >> magic;
+  return BundleMagic == magic;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSessionBundle::Pointer VSSessionBundle::Open(const QString& filePath)
+{
+  Pointer bundle(new VSSessionBundle(filePath));
+  if(false == bundle->readHeader())
+  {
+    return nullptr;
+  }
+
+  return bundle;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundle::readHeader()
+{
+  qint64 fileSize = 0;
+  m_MappedData = VSDataSetSnapshot::MapFile(m_FilePath, fileSize);
+  if(nullptr == m_MappedData)
+  {
+    return false;
+  }
+
+  // The header is at the start of the file so only the first 2GB need to be visible to the stream
+  const char* data = m_MappedData.get();
+  int headerSize = static_cast<int>(std::min<qint64>(fileSize, std::numeric_limits<int>::max()));
+  QByteArray fileData = QByteArray::fromRawData(data, headerSize);
+  QDataStream stream(fileData);
+  stream.setVersion(BundleStreamVersion);
+
+  quint32 magic = 0;
+  quint32 version = 0;
+  stream >> magic >> version;
+  if(BundleMagic != magic || version > BundleVersion)
+  {
+    return false;
+  }
+
+  stream >> m_SessionJson;
+  if(stream.status() != QDataStream::Ok)
+  {
+    return false;
+  }
+
+  // Older bundles stored snapshots in a format that is no longer read, so only their session is used
+  if(version < BundleVersion)
+  {
+    return true;
+  }
+
+  qint64 tableOffset = -1;
+  const qint64 headerEnd = stream.device()->pos();
+  if(fileSize >= headerEnd + TrailerSize)
+  {
+    QByteArray trailerData = QByteArray::fromRawData(data + fileSize - TrailerSize, static_cast<int>(TrailerSize));
+    QDataStream trailerStream(trailerData);
+    trailerStream.setVersion(BundleStreamVersion);
+    trailerStream >> tableOffset;
+  }
+
+  const qint64 tableEnd = fileSize - TrailerSize;
+  if(tableOffset < headerEnd || tableOffset > tableEnd || tableEnd - tableOffset > std::numeric_limits<int>::max())
+  {
+    return false;
+  }
+
+  QByteArray tableData = QByteArray::fromRawData(data + tableOffset, static_cast<int>(tableEnd - tableOffset));
+  QDataStream tableStream(tableData);
+  tableStream.setVersion(BundleStreamVersion);
+
+  quint32 count = 0;
+  tableStream >> count;
+  for(quint32 i = 0; i < count && tableStream.status() == QDataStream::Ok; i++)
+  {
+    QByteArray key;
+    qint64 offset = 0;
+    qint64 size = 0;
+    tableStream >> key >> offset >> size;
+
+    // Drop any entry extending outside of the snapshot data
+    if(tableStream.status() == QDataStream::Ok && offset >= headerEnd && size > 0 && size <= tableOffset - offset)
+    {
+      m_Entries[key] = SnapshotEntry(offset, size);
+    }
+  }
+
+  return tableStream.status() == QDataStream::Ok;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionBundle::SetActiveBundle(Pointer bundle)
+{
+  m_ActiveBundleLock.acquire();
+  m_ActiveBundle = bundle;
+  m_ActiveBundleLock.release();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSessionBundle::Pointer VSSessionBundle::GetActiveBundle()
+{
+  m_ActiveBundleLock.acquire();
+  Pointer bundle = m_ActiveBundle;
+  m_ActiveBundleLock.release();
+  return bundle;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSSessionBundle::FindSnapshot(const QByteArray& key)
+{
+  Pointer bundle = GetActiveBundle();
+  if(nullptr == bundle)
+  {
+    return nullptr;
+  }
+
+  return bundle->getSnapshot(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundle::HasSnapshot(const QByteArray& key)
+{
+  Pointer bundle = GetActiveBundle();
+  return bundle && bundle->contains(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSSessionBundle::getFilePath() const
+{
+  return m_FilePath;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray VSSessionBundle::getSessionJson() const
+{
+  return m_SessionJson;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int VSSessionBundle::getSnapshotCount() const
+{
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundle::contains(const QByteArray& key) const
+{
+  return m_Entries.contains(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSSessionBundle::getSnapshot(const QByteArray& key) const
+{
+  auto iter = m_Entries.find(key);
+  if(iter == m_Entries.end())
+  {
+    return nullptr;
+  }
+
+  const char* data = m_MappedData.get() + iter.value().first;
+  return VSDataSetSnapshot::Deserialize(data, iter.value().second, m_MappedData);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSessionBundleWriter::VSSessionBundleWriter(const QString& filePath)
+: m_File(filePath)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundleWriter::open(const QByteArray& sessionJson)
+{
+  if(false == m_File.open(QIODevice::WriteOnly))
+  {
+    m_Failed = true;
+    return false;
+  }
+
+  QDataStream stream(&m_File);
+  stream.setVersion(BundleStreamVersion);
+  stream << BundleMagic << BundleVersion << sessionJson;
+  m_Failed = stream.status() != QDataStream::Ok;
+  return false == m_Failed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundleWriter::contains(const QByteArray& key) const
+{
+  return m_Entries.contains(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundleWriter::addSnapshot(const QByteArray& key, vtkDataSet* dataSet)
+{
+  if(m_Failed || false == m_File.isOpen() || m_Entries.contains(key))
+  {
+    return false;
+  }
+
+  const char padding[SnapshotAlignment] = {0};
+  const qint64 paddingSize = (SnapshotAlignment - m_File.pos() % SnapshotAlignment) % SnapshotAlignment;
+  if(m_File.write(padding, paddingSize) != paddingSize)
+  {
+    m_Failed = true;
+    return false;
+  }
+
+  const qint64 offset = m_File.pos();
+  if(false == VSDataSetSnapshot::Serialize(dataSet, &m_File))
+  {
+    // Data sets that cannot be stored are dropped from the bundle
+    m_Failed = false == m_File.seek(offset) || false == m_File.resize(offset);
+    return false;
+  }
+
+  m_Entries[key] = SnapshotEntry(offset, m_File.pos() - offset);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionBundleWriter::commit()
+{
+  if(m_Failed || false == m_File.isOpen())
+  {
+    m_File.cancelWriting();
+    return false;
+  }
+
+  QDataStream stream(&m_File);
+  stream.setVersion(BundleStreamVersion);
+
+  const qint64 tableOffset = m_File.pos();
+  stream << static_cast<quint32>(m_Entries.size());
+  for(auto iter = m_Entries.constBegin(); iter != m_Entries.constEnd(); iter++)
+  {
+    stream << iter.key() << iter.value().first << iter.value().second;
+  }
+  stream << tableOffset;
+
+  if(stream.status() != QDataStream::Ok)
+  {
+    m_File.cancelWriting();
+    return false;
+  }
+
+  return m_File.commit();
+}
@@ -0,0 +1,229 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <memory>
+
+#include <vtkDataSet.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMap>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSemaphore>
+#include <QtCore/QString>
+
+#include "SIMPLVtkLib/SIMPLBridge/VtkMacros.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSSessionBundle VSSessionBundle.h SIMPLVtkLib/Visualization/Controllers/VSSessionBundle.h
+ * @brief This class reads and writes binary session bundles.  A bundle stores the session json
+ * together with VSDataSetSnapshots of filter outputs keyed by VSAbstractFilter::getOutputKey().
+ * Opened bundles are memory mapped and only the table of snapshots is read up front.  Snapshots
+ * are decoded when a filter with a matching key asks for one and their arrays point into the
+ * mapping.  Keys that no longer match a filter's input or parameters are never looked up, so
+ * those filters execute normally.  Bundles are written with VSSessionBundleWriter.
+ */
+class SIMPLVtkLib_EXPORT VSSessionBundle
+{
+public:
+  using Pointer = std::shared_ptr<VSSessionBundle>;
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSSessionBundle();
+
+  /**
+   * @brief Returns true if the file at the given path is a session bundle
+   * @param filePath
+   * @return
+   */
+  static bool IsBundle(const QString& filePath);
+
+  /**
+   * @brief Opens and maps the session bundle at the given path.  Returns nullptr if the
+   * file could not be read as a session bundle.
+   * @param filePath
+   * @return
+   */
+  static Pointer Open(const QString& filePath);
+
+  /**
+   * @brief Sets the bundle that FindSnapshot searches.  Passing nullptr releases the current bundle.
+   * @param bundle
+   */
+  static void SetActiveBundle(Pointer bundle);
+
+  /**
+   * @brief Returns the bundle that FindSnapshot searches
+   * @return
+   */
+  static Pointer GetActiveBundle();
+
+  /**
+   * @brief Returns the snapshot stored under the given key in the active bundle or nullptr
+   * if there is no active bundle or the key was not found.
+   * @param key
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) FindSnapshot(const QByteArray& key);
+
+  /**
+   * @brief Returns true if the active bundle stores a snapshot under the given key without
+   * reading it
+   * @param key
+   * @return
+   */
+  static bool HasSnapshot(const QByteArray& key);
+
+  /**
+   * @brief Returns the path of the bundle file
+   * @return
+   */
+  QString getFilePath() const;
+
+  /**
+   * @brief Returns the session json stored in the bundle
+   * @return
+   */
+  QByteArray getSessionJson() const;
+
+  /**
+   * @brief Returns the number of snapshots stored in the bundle
+   * @return
+   */
+  int getSnapshotCount() const;
+
+  /**
+   * @brief Returns true if the bundle contains a snapshot for the given key
+   * @param key
+   * @return
+   */
+  bool contains(const QByteArray& key) const;
+
+  /**
+   * @brief Decodes and returns the snapshot stored under the given key.  Returns nullptr
+   * if the key was not found.
+   * @param key
+   * @return
+   */
+  VTK_PTR(vtkDataSet) getSnapshot(const QByteArray& key) const;
+
+protected:
+  /**
+   * @brief Constructor
+   * @param filePath
+   */
+  VSSessionBundle(const QString& filePath);
+
+  /**
+   * @brief Maps the bundle file and reads the session json and snapshot table.
+   * Returns true if successful.
+   * @return
+   */
+  bool readHeader();
+
+private:
+  using SnapshotEntry = std::pair<qint64, qint64>;
+
+  static Pointer m_ActiveBundle;
+  static QSemaphore m_ActiveBundleLock;
+
+  QString m_FilePath;
+  std::shared_ptr<const char> m_MappedData;
+  QByteArray m_SessionJson;
+  QMap<QByteArray, SnapshotEntry> m_Entries;
+};
+
+/**
+ * @class VSSessionBundleWriter VSSessionBundle.h SIMPLVtkLib/Visualization/Controllers/VSSessionBundle.h
+ * @brief This class writes session bundles one snapshot at a time so only the snapshot being
+ * written is held in memory.  The table of snapshots is written after the last snapshot and the
+ * file only replaces an existing bundle once commit() succeeds.
+ */
+class SIMPLVtkLib_EXPORT VSSessionBundleWriter
+{
+public:
+  /**
+   * @brief Constructor
+   * @param filePath
+   */
+  VSSessionBundleWriter(const QString& filePath);
+
+  /**
+   * @brief Deconstructor.  Discards the bundle if it was not committed.
+   */
+  virtual ~VSSessionBundleWriter() = default;
+
+  /**
+   * @brief Opens the file and writes the session json.  Returns true if successful.
+   * @param sessionJson
+   * @return
+   */
+  bool open(const QByteArray& sessionJson);
+
+  /**
+   * @brief Returns true if a snapshot was already written under the given key
+   * @param key
+   * @return
+   */
+  bool contains(const QByteArray& key) const;
+
+  /**
+   * @brief Writes a snapshot of the data set under the given key.  Returns false if the data
+   * set could not be stored.  Failed writes are reported by commit().
+   * @param key
+   * @param dataSet
+   * @return
+   */
+  bool addSnapshot(const QByteArray& key, vtkDataSet* dataSet);
+
+  /**
+   * @brief Writes the table of snapshots and replaces the file at the bundle path.  Returns true
+   * if the bundle was written successfully.
+   * @return
+   */
+  bool commit();
+
+private:
+  using SnapshotEntry = std::pair<qint64, qint64>;
+
+  QSaveFile m_File;
+  QMap<QByteArray, SnapshotEntry> m_Entries;
+  bool m_Failed = false;
+};
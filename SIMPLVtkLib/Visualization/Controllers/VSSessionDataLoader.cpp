@@ -0,0 +1,288 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSSessionDataLoader.h"
+
+#include <QtConcurrent>
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLib/Utilities/SIMPLH5DataReader.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSessionDataLoader::VSSessionDataLoader(QObject* parent)
+: QObject(parent)
+, m_LoadResultLock(1)
+{
+  // Results are queued by worker threads and applied on the thread that owns the loader
+  connect(this, &VSSessionDataLoader::dataContainerWrapped, this, &VSSessionDataLoader::applyWrappedDataContainers, Qt::QueuedConnection);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::addDataContainerFilter(const QString& filePath, VSSIMPLDataContainerFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  m_FileRequests[filePath].push_back(std::make_pair(filter, filter->getFilterName()));
+  m_PendingFilters.insert(filter);
+  m_RequestCount++;
+  if(filter->hasImageRegion())
+  {
+    m_ImageRegions[filter] = filter->getImageRegion();
+  }
+  if(filter->isSliceOnly())
+  {
+    m_SliceOnlyFilters.insert(filter);
+  }
+
+  connect(filter, &QObject::destroyed, this, &VSSessionDataLoader::placeholderDestroyed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::run()
+{
+  if(m_FileRequests.isEmpty())
+  {
+    return;
+  }
+
+  QMap<QString, RequestList> fileRequests = m_FileRequests;
+  QMap<VSSIMPLDataContainerFilter*, VSImageRegion> imageRegions = m_ImageRegions;
+  m_FileRequests.clear();
+  QSet<VSSIMPLDataContainerFilter*> sliceOnlyFilters = m_SliceOnlyFilters;
+  m_ImageRegions.clear();
+  m_SliceOnlyFilters.clear();
+
+  emit applyingDataFilters(m_RequestCount);
+
+  QtConcurrent::run(this, &VSSessionDataLoader::readFiles, fileRequests, imageRegions, sliceOnlyFilters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSessionDataLoader::isLoading() const
+{
+  return m_LoadedCount < m_RequestCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::readFiles(QMap<QString, RequestList> fileRequests, QMap<VSSIMPLDataContainerFilter*, VSImageRegion> imageRegions, QSet<VSSIMPLDataContainerFilter*> sliceOnlyFilters)
+{
+  // Each file is read under the process-wide HDF5 lock so refinement, slab, and preview reads wait for it.
+  // Wrapping does not touch the file and is handed off as soon as each DataContainer is read.
+  for(QMap<QString, RequestList>::iterator fileIter = fileRequests.begin(); fileIter != fileRequests.end(); fileIter++)
+  {
+    QString filePath = fileIter.key();
+    RequestList requests = fileIter.value();
+
+    QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
+    SIMPLH5DataReader reader;
+    DataContainerArrayProxy dcaProxy;
+    int err = -1;
+    if(reader.openFile(filePath))
+    {
+      err = 0;
+      dcaProxy = reader.readDataContainerArrayStructure(nullptr, err);
+    }
+
+    for(const DataContainerRequest& request : requests)
+    {
+      QString dcName = request.second;
+
+      LoadResult result;
+      result.m_Filter = request.first;
+
+      if(err < 0)
+      {
+        result.m_ErrorMessage = tr("Data Container '%1' could not be loaded because the file '%2' could not be read.").arg(dcName).arg(filePath);
+        addResult(result);
+        continue;
+      }
+
+      if(false == dcaProxy.dataContainers.contains(dcName))
+      {
+        result.m_ErrorMessage = tr("Data Container '%1' could not be loaded because it no longer exists in the file '%2'.").arg(dcName).arg(filePath);
+        addResult(result);
+        continue;
+      }
+
+      DataContainerProxy dcProxy = dcaProxy.dataContainers.value(dcName);
+      if(dcProxy.dcType == static_cast<unsigned int>(IGeometry::Type::Unknown))
+      {
+        result.m_ErrorMessage = tr("Data Container '%1' could not be loaded because it has an unknown data container geometry.").arg(dcName);
+        addResult(result);
+        continue;
+      }
+
+      // Check only the requested DataContainer so that each read pulls a single DataContainer out of the open file
+      AttributeMatrixProxy::AMTypeFlags amFlags(AttributeMatrixProxy::AMTypeFlag::Cell_AMType);
+      DataArrayProxy::PrimitiveTypeFlags pFlags(DataArrayProxy::PrimitiveTypeFlag::Any_PType);
+      DataArrayProxy::CompDimsVector compDimsVector;
+      dcProxy.setFlags(Qt::Checked, amFlags, pFlags, compDimsVector);
+      if(sliceOnlyFilters.contains(request.first))
+      {
+        VSImageRegionReader::UncheckCellArrays(dcProxy);
+      }
+
+      DataContainerArrayProxy requestProxy = dcaProxy;
+      requestProxy.dataContainers[dcProxy.name] = dcProxy;
+
+      // ImageGeoms imported with a region of interest only read the voxels within the region
+      DataContainerArray::Pointer dca = nullptr;
+      if(imageRegions.contains(request.first))
+      {
+        QString errorMessage;
+        dca = VSImageRegionReader::ReadDataContainerArray(filePath, requestProxy, imageRegions.value(request.first), errorMessage);
+      }
+      else
+      {
+        dca = reader.readSIMPLDataUsingProxy(requestProxy, false);
+      }
+      DataContainer::Pointer dc = nullptr;
+      if(dca)
+      {
+        dc = dca->getDataContainer(dcName);
+      }
+      if(nullptr == dc)
+      {
+        result.m_ErrorMessage = tr("Data Container '%1' could not be read from the file '%2'.").arg(dcName).arg(filePath);
+        addResult(result);
+        continue;
+      }
+
+      QtConcurrent::run(this, &VSSessionDataLoader::wrapDataContainer, request.first, dc);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::wrapDataContainer(VSSIMPLDataContainerFilter* filter, DataContainer::Pointer dc)
+{
+  LoadResult result;
+  result.m_Filter = filter;
+  result.m_WrappedDc = SIMPLVtkBridge::WrapDataContainerAsStruct(dc);
+  if(result.m_WrappedDc)
+  {
+    SIMPLVtkBridge::FinishWrappingDataContainerStruct(result.m_WrappedDc);
+  }
+  else
+  {
+    result.m_ErrorMessage = tr("Data Container '%1' does not contain any data that can be rendered.").arg(dc->getName());
+  }
+
+  addResult(result);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::addResult(const LoadResult& result)
+{
+  m_LoadResultLock.acquire();
+  m_LoadResults.push_back(result);
+  m_LoadResultLock.release();
+
+  emit dataContainerWrapped();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::applyWrappedDataContainers()
+{
+  std::list<LoadResult> results;
+  m_LoadResultLock.acquire();
+  results.swap(m_LoadResults);
+  m_LoadResultLock.release();
+
+  for(const LoadResult& result : results)
+  {
+    emit dataFilterApplied(++m_LoadedCount);
+
+    // Skip filters that were removed while their data was being read
+    VSSIMPLDataContainerFilter* filter = result.m_Filter;
+    if(false == m_PendingFilters.contains(filter))
+    {
+      continue;
+    }
+
+    m_PendingFilters.remove(filter);
+    disconnect(filter, &QObject::destroyed, this, &VSSessionDataLoader::placeholderDestroyed);
+
+    if(result.m_WrappedDc)
+    {
+      filter->setLoadedDataContainer(result.m_WrappedDc);
+    }
+    else
+    {
+      filter->setLoadFailed(result.m_ErrorMessage);
+    }
+  }
+
+  if(results.size() > 0 && false == isLoading())
+  {
+    m_RequestCount = 0;
+    m_LoadedCount = 0;
+    emit finishedLoading();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSessionDataLoader::placeholderDestroyed(QObject* object)
+{
+  for(QSet<VSSIMPLDataContainerFilter*>::iterator iter = m_PendingFilters.begin(); iter != m_PendingFilters.end(); iter++)
+  {
+    if(static_cast<QObject*>(*iter) == object)
+    {
+      m_PendingFilters.erase(iter);
+      return;
+    }
+  }
+}
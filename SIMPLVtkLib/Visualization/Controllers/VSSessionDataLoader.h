@@ -0,0 +1,153 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <list>
+
+#include <QtCore/QMap>
+#include <QtCore/QSemaphore>
+#include <QtCore/QSet>
+
+#include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSSessionDataLoader VSSessionDataLoader.h SIMPLVtkLib/Visualization/Controllers/VSSessionDataLoader.h
+ * @brief This class reads the DataContainers for placeholder VSSIMPLDataContainerFilters created
+ * while restoring a session.  Requests are grouped by file so that each file is opened and its
+ * DataContainerArray structure is read only once.  HDF5 reads are performed in order on a single
+ * background thread while the DataContainers already read are wrapped concurrently on the remaining
+ * threads.  Each filter is passed its data on the main thread as soon as it is ready.
+ */
+class SIMPLVtkLib_EXPORT VSSessionDataLoader : public QObject
+{
+  Q_OBJECT
+
+public:
+  using DataContainerRequest = std::pair<VSSIMPLDataContainerFilter*, QString>;
+  using RequestList = QList<DataContainerRequest>;
+
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSSessionDataLoader(QObject* parent = nullptr);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSSessionDataLoader() = default;
+
+  /**
+   * @brief Queues the DataContainer for a placeholder filter to be read from the given file.  Child
+   * filters can be created right away; they are marked dirty when the data arrives and only the
+   * branches that are displayed execute.
+   * @param filePath
+   * @param filter
+   */
+  void addDataContainerFilter(const QString& filePath, VSSIMPLDataContainerFilter* filter);
+
+  /**
+   * @brief Starts reading all queued DataContainers in the background
+   */
+  void run();
+
+  /**
+   * @brief Returns true while there are DataContainers that have not finished loading
+   * @return
+   */
+  bool isLoading() const;
+
+signals:
+  void applyingDataFilters(int count);
+  void dataFilterApplied(int num);
+  void finishedLoading();
+  void dataContainerWrapped();
+
+protected slots:
+  /**
+   * @brief Passes wrapped DataContainers to their filters.  This must run on the main thread.
+   */
+  void applyWrappedDataContainers();
+
+  /**
+   * @brief Stops tracking a placeholder filter that was deleted before its data finished loading
+   * @param object
+   */
+  void placeholderDestroyed(QObject* object);
+
+protected:
+  struct LoadResult
+  {
+    VSSIMPLDataContainerFilter* m_Filter = nullptr;
+    SIMPLVtkBridge::WrappedDataContainerPtr m_WrappedDc = nullptr;
+    QString m_ErrorMessage;
+  };
+
+  /**
+   * @brief Reads the requested DataContainers from each file in turn and schedules them to be wrapped.
+   * This method runs on a background thread.
+   * @param fileRequests
+   * @param imageRegions
+   * @param sliceOnlyFilters
+   */
+  void readFiles(QMap<QString, RequestList> fileRequests, QMap<VSSIMPLDataContainerFilter*, VSImageRegion> imageRegions, QSet<VSSIMPLDataContainerFilter*> sliceOnlyFilters);
+
+  /**
+   * @brief Wraps a DataContainer that was read from file.  This method runs on a background thread.
+   * @param filter
+   * @param dc
+   */
+  void wrapDataContainer(VSSIMPLDataContainerFilter* filter, DataContainer::Pointer dc);
+
+  /**
+   * @brief Queues a result to be applied on the main thread
+   * @param result
+   */
+  void addResult(const LoadResult& result);
+
+private:
+  QMap<QString, RequestList> m_FileRequests;
+  QSet<VSSIMPLDataContainerFilter*> m_PendingFilters;
+  QMap<VSSIMPLDataContainerFilter*, VSImageRegion> m_ImageRegions;
+  QSet<VSSIMPLDataContainerFilter*> m_SliceOnlyFilters;
+  std::list<LoadResult> m_LoadResults;
+  QSemaphore m_LoadResultLock;
+  int m_RequestCount = 0;
+  int m_LoadedCount = 0;
+};
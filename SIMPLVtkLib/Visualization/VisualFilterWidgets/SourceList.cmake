@@ -1,8 +1,11 @@
 
 set(VSVisualFilterWidgets
+  VSCalculatorFilterWidget
   VSClipFilterWidget
+  VSContourFilterWidget
   VSCropFilterWidget
   VSDataSetFilterWidget
+  VSGrainBoundaryFilterWidget
   VSMaskFilterWidget
   VSSIMPLDataContainerFilterWidget
   VSSliceFilterWidget
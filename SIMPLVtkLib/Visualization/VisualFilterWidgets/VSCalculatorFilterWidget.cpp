@@ -0,0 +1,232 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSCalculatorFilterWidget.h"
+
+#include <QtCore/QRegularExpression>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkPointData.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayExpression.h"
+
+#include "ui_VSCalculatorFilterWidget.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+class VSCalculatorFilterWidget::vsInternals : public Ui::VSCalculatorFilterWidget
+{
+public:
+  vsInternals()
+  {
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCalculatorFilterWidget::VSCalculatorFilterWidget(VSCalculatorFilter* filter, vtkRenderWindowInteractor* interactor, QWidget* parent)
+: VSAbstractFilterWidget(parent)
+, m_Internals(new vsInternals())
+, m_CalculatorFilter(filter)
+{
+  m_Internals->setupUi(this);
+
+  updateArrayNames();
+
+  connect(m_Internals->attributeComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(arrayTypeChanged(int)));
+  connect(m_Internals->arraysComboBox, SIGNAL(activated(int)), this, SLOT(insertArray(int)));
+  connect(m_Internals->expressionLineEdit, SIGNAL(textEdited(const QString&)), this, SLOT(valuesChanged()));
+  connect(m_Internals->resultLineEdit, SIGNAL(textEdited(const QString&)), this, SLOT(valuesChanged()));
+
+  if(m_CalculatorFilter->isInitialized() == true)
+  {
+    m_CalculatorFilter->setInitialized(false);
+    reset();
+    apply();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSCalculatorFilterWidget::getFilter() const
+{
+  return m_CalculatorFilter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilterWidget::apply()
+{
+  VSAbstractFilterWidget::apply();
+
+  QString resultName = m_Internals->resultLineEdit->text().trimmed();
+  if(resultName.isEmpty())
+  {
+    resultName = "Result";
+  }
+
+  m_CalculatorFilter->apply(m_Internals->expressionLineEdit->text(), resultName, getArrayType());
+  m_Internals->errorLabel->setText(m_CalculatorFilter->getErrorMessage());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilterWidget::reset()
+{
+  m_Internals->attributeComboBox->setCurrentIndex(static_cast<int>(m_CalculatorFilter->getLastArrayType()));
+  m_Internals->expressionLineEdit->setText(m_CalculatorFilter->getLastExpression());
+  m_Internals->resultLineEdit->setText(m_CalculatorFilter->getLastResultName());
+  m_Internals->errorLabel->setText(m_CalculatorFilter->getErrorMessage());
+
+  cancelChanges();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCalculatorFilter::ArrayType VSCalculatorFilterWidget::getArrayType()
+{
+  return static_cast<VSCalculatorFilter::ArrayType>(m_Internals->attributeComboBox->currentIndex());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataSetAttributes* VSCalculatorFilterWidget::getInputAttributes()
+{
+  vtkDataSet* inputData = m_CalculatorFilter->getParentFilter()->getOutput();
+  if(nullptr == inputData)
+  {
+    return nullptr;
+  }
+
+  if(VSCalculatorFilter::ArrayType::PointData == getArrayType())
+  {
+    return inputData->GetPointData();
+  }
+
+  return inputData->GetCellData();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilterWidget::updateArrayNames()
+{
+  m_Internals->arraysComboBox->clear();
+
+  vtkDataSetAttributes* attributes = getInputAttributes();
+  if(nullptr == attributes)
+  {
+    return;
+  }
+
+  // Names are listed the way they are written in an expression
+  QRegularExpression identifier("^[A-Za-z_][A-Za-z0-9_]*$");
+  int numArrays = attributes->GetNumberOfArrays();
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkDataArray* dataArray = attributes->GetArray(i);
+    if(nullptr == dataArray || nullptr == dataArray->GetName())
+    {
+      continue;
+    }
+
+    QString name = dataArray->GetName();
+    if(false == identifier.match(name).hasMatch())
+    {
+      name = "\"" + name + "\"";
+    }
+
+    int numComps = dataArray->GetNumberOfComponents();
+    if(numComps == 1)
+    {
+      m_Internals->arraysComboBox->addItem(name);
+      continue;
+    }
+
+    m_Internals->arraysComboBox->addItem("mag(" + name + ")");
+    for(int comp = 0; comp < numComps; comp++)
+    {
+      m_Internals->arraysComboBox->addItem(QString("%1[%2]").arg(name).arg(comp));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilterWidget::arrayTypeChanged(int index)
+{
+  updateArrayNames();
+  valuesChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilterWidget::insertArray(int index)
+{
+  m_Internals->expressionLineEdit->insert(m_Internals->arraysComboBox->itemText(index));
+  m_Internals->expressionLineEdit->setFocus();
+  valuesChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilterWidget::valuesChanged()
+{
+  QString expressionText = m_Internals->expressionLineEdit->text();
+  QString errorMessage;
+  if(false == expressionText.trimmed().isEmpty())
+  {
+    VSArrayExpression expression;
+    if(false == expression.compile(expressionText.toStdString(), getInputAttributes()))
+    {
+      errorMessage = QString::fromStdString(expression.getErrorMessage());
+    }
+  }
+  m_Internals->errorLabel->setText(errorMessage);
+
+  changesWaiting();
+}
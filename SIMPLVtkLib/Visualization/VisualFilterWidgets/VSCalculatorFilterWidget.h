@@ -0,0 +1,128 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSAbstractFilterWidget.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSCalculatorFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+class vtkDataSetAttributes;
+
+/**
+ * @class VSCalculatorFilterWidget VSCalculatorFilterWidget.h
+ * SIMPLVtkLib/Visualization/VisualFilterWidgets/VSCalculatorFilterWidget.h
+ * @brief This class handles the user input for calculating a new array from an
+ * expression.  Expressions are checked against the input arrays while they are edited.
+ */
+class SIMPLVtkLib_EXPORT VSCalculatorFilterWidget : public VSAbstractFilterWidget
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param filter
+   * @param interactor
+   * @param parent
+   */
+  VSCalculatorFilterWidget(VSCalculatorFilter* filter, vtkRenderWindowInteractor* interactor, QWidget* parent);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSCalculatorFilterWidget() = default;
+
+  /**
+   * @brief Returns the filter used by the widget
+   * @return
+   */
+  VSAbstractFilter* getFilter() const override;
+
+  /**
+   * @brief Applies changes to the filter and updates the output
+   */
+  void apply() override;
+
+  /**
+   * @brief reset
+   */
+  void reset() override;
+
+protected:
+  /**
+   * @brief Returns the selected array type
+   * @return
+   */
+  VSCalculatorFilter::ArrayType getArrayType();
+
+  /**
+   * @brief Returns the input attributes for the selected array type
+   * @return
+   */
+  vtkDataSetAttributes* getInputAttributes();
+
+  /**
+   * @brief Updates the array names that can be inserted into the expression
+   */
+  void updateArrayNames();
+
+protected slots:
+  /**
+   * @brief Updates the array names for the new array type
+   * @param index
+   */
+  void arrayTypeChanged(int index);
+
+  /**
+   * @brief Inserts the array at the given index into the expression
+   * @param index
+   */
+  void insertArray(int index);
+
+  /**
+   * @brief Checks the expression and notifies changes in the widget's values
+   */
+  void valuesChanged();
+
+private:
+  class vsInternals;
+  vsInternals* m_Internals;
+
+  VSCalculatorFilter* m_CalculatorFilter = nullptr;
+};
@@ -0,0 +1,256 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSContourFilterWidget.h"
+
+#include <QtCore/QStringList>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkPointData.h>
+
+#include "ui_VSContourFilterWidget.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+class VSContourFilterWidget::vsInternals : public Ui::VSContourFilterWidget
+{
+public:
+  vsInternals()
+  {
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSContourFilterWidget::VSContourFilterWidget(VSContourFilter* filter, vtkRenderWindowInteractor* interactor, QWidget* parent)
+: VSAbstractFilterWidget(parent)
+, m_Internals(new vsInternals())
+, m_ContourFilter(filter)
+{
+  m_Internals->setupUi(this);
+
+  updateArrayNames(filter->getParentFilter()->getOutput());
+
+  connect(m_Internals->scalarsComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(valuesChanged()));
+  connect(m_Internals->valuesLineEdit, SIGNAL(textEdited(const QString&)), this, SLOT(valuesChanged()));
+  connect(m_Internals->generateButton, SIGNAL(clicked()), this, SLOT(generateValues()));
+
+  if(m_ContourFilter->isInitialized() == true)
+  {
+    m_ContourFilter->setInitialized(false);
+    reset();
+    apply();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSContourFilterWidget::getFilter() const
+{
+  return m_ContourFilter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::apply()
+{
+  VSAbstractFilterWidget::apply();
+
+  m_ContourFilter->apply(getArrayName(), getValues());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::reset()
+{
+  setArrayName(m_ContourFilter->getLastArrayName());
+  setValues(m_ContourFilter->getLastValues());
+
+  cancelChanges();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::updateArrayNames(vtkDataSet* inputData)
+{
+  QString selectedArrayName = m_Internals->scalarsComboBox->currentText();
+
+  m_Internals->scalarsComboBox->clear();
+  if(nullptr == inputData)
+  {
+    return;
+  }
+
+  vtkFieldData* attributes[2] = {inputData->GetCellData(), inputData->GetPointData()};
+  for(vtkFieldData* fieldData : attributes)
+  {
+    int numArrays = fieldData->GetNumberOfArrays();
+    for(int i = 0; i < numArrays; i++)
+    {
+      vtkDataArray* dataArray = fieldData->GetArray(i);
+      if(VSContourFilter::isContourArray(dataArray) && m_Internals->scalarsComboBox->findText(dataArray->GetName()) < 0)
+      {
+        m_Internals->scalarsComboBox->addItem(dataArray->GetName());
+      }
+    }
+  }
+
+  m_Internals->scalarsComboBox->setCurrentText(selectedArrayName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::setArrayName(QString arrayName)
+{
+  if(false == arrayName.isEmpty())
+  {
+    m_Internals->scalarsComboBox->setCurrentText(arrayName);
+  }
+
+  changesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSContourFilterWidget::getArrayName()
+{
+  return m_Internals->scalarsComboBox->currentText();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<double> VSContourFilterWidget::getValues()
+{
+  QVector<double> values;
+  QStringList entries = m_Internals->valuesLineEdit->text().split(',', QString::SkipEmptyParts);
+  for(QString entry : entries)
+  {
+    bool ok = false;
+    double value = entry.trimmed().toDouble(&ok);
+    if(ok)
+    {
+      values.push_back(value);
+    }
+  }
+
+  return values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::setValues(QVector<double> values)
+{
+  QStringList entries;
+  for(double value : values)
+  {
+    entries.push_back(QString::number(value));
+  }
+
+  m_Internals->valuesLineEdit->setText(entries.join(", "));
+  if(values.size() > 0)
+  {
+    m_Internals->countSpinBox->setValue(values.size());
+  }
+
+  changesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataArray* VSContourFilterWidget::getSelectedArray()
+{
+  vtkDataSet* inputData = m_ContourFilter->getParentFilter()->getOutput();
+  if(nullptr == inputData)
+  {
+    return nullptr;
+  }
+
+  QString arrayName = getArrayName();
+  vtkDataArray* dataArray = inputData->GetCellData()->GetArray(qPrintable(arrayName));
+  if(nullptr == dataArray)
+  {
+    dataArray = inputData->GetPointData()->GetArray(qPrintable(arrayName));
+  }
+
+  return dataArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::valuesChanged()
+{
+  changesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilterWidget::generateValues()
+{
+  vtkDataArray* dataArray = getSelectedArray();
+  if(nullptr == dataArray)
+  {
+    return;
+  }
+
+  double range[2];
+  dataArray->GetRange(range);
+
+  // Values are placed between the range's ends because contours at either end are empty
+  int count = m_Internals->countSpinBox->value();
+  double step = (range[1] - range[0]) / (count + 1);
+
+  QVector<double> values;
+  for(int i = 1; i <= count; i++)
+  {
+    values.push_back(range[0] + i * step);
+  }
+
+  setValues(values);
+}
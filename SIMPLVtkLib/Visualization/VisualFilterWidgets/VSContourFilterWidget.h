@@ -0,0 +1,138 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSAbstractFilterWidget.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSContourFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSContourFilterWidget VSContourFilterWidget.h
+ * SIMPLVtkLib/Visualization/VisualFilterWidgets/VSContourFilterWidget.h
+ * @brief This class handles the user input for generating isosurfaces of a
+ * scalar array for one or more iso-values.
+ */
+class SIMPLVtkLib_EXPORT VSContourFilterWidget : public VSAbstractFilterWidget
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param filter
+   * @param interactor
+   * @param parent
+   */
+  VSContourFilterWidget(VSContourFilter* filter, vtkRenderWindowInteractor* interactor, QWidget* parent);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSContourFilterWidget() = default;
+
+  /**
+   * @brief Returns the filter used by the widget
+   * @return
+   */
+  VSAbstractFilter* getFilter() const override;
+
+  /**
+   * @brief Applies changes to the filter and updates the output
+   */
+  void apply() override;
+
+  /**
+   * @brief reset
+   */
+  void reset() override;
+
+protected:
+  /**
+   * @brief Returns the selected array name
+   * @return
+   */
+  QString getArrayName();
+
+  /**
+   * @brief Sets the selected array name
+   * @param arrayName
+   */
+  void setArrayName(QString arrayName);
+
+  /**
+   * @brief Returns the iso-values entered.  Invalid entries are skipped.
+   * @return
+   */
+  QVector<double> getValues();
+
+  /**
+   * @brief Sets the iso-values shown
+   * @param values
+   */
+  void setValues(QVector<double> values);
+
+  /**
+   * @brief Returns the selected array from the filter's input
+   * @return
+   */
+  vtkDataArray* getSelectedArray();
+
+  /**
+   * @brief Updates the array names based on the given vtkDataSet
+   * @param inputData
+   */
+  void updateArrayNames(vtkDataSet* inputData);
+
+protected slots:
+  /**
+   * @brief Notifies changes in the widget's values
+   */
+  void valuesChanged();
+
+  /**
+   * @brief Replaces the iso-values with evenly spaced values across the selected array's range
+   */
+  void generateValues();
+
+private:
+  class vsInternals;
+  vsInternals* m_Internals;
+
+  VSContourFilter* m_ContourFilter = nullptr;
+};
@@ -0,0 +1,218 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSGrainBoundaryFilterWidget.h"
+
+#include <QtCore/QRegularExpression>
+#include <QtCore/QStringList>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+
+#include "ui_VSGrainBoundaryFilterWidget.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+class VSGrainBoundaryFilterWidget::vsInternals : public Ui::VSGrainBoundaryFilterWidget
+{
+public:
+  vsInternals()
+  {
+  }
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSGrainBoundaryFilterWidget::VSGrainBoundaryFilterWidget(VSGrainBoundaryFilter* filter, vtkRenderWindowInteractor* interactor, QWidget* parent)
+: VSAbstractFilterWidget(parent)
+, m_Internals(new vsInternals())
+, m_GrainBoundaryFilter(filter)
+{
+  m_Internals->setupUi(this);
+
+  updateArrayNames(filter->getParentFilter()->getOutput());
+
+  connect(m_Internals->featureIdsComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(valuesChanged()));
+  connect(m_Internals->highlightLineEdit, SIGNAL(textEdited(const QString&)), this, SLOT(valuesChanged()));
+  connect(m_Internals->exteriorCheckBox, SIGNAL(toggled(bool)), this, SLOT(valuesChanged()));
+
+  if(m_GrainBoundaryFilter->isInitialized() == true)
+  {
+    m_GrainBoundaryFilter->setInitialized(false);
+    reset();
+    apply();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter* VSGrainBoundaryFilterWidget::getFilter() const
+{
+  return m_GrainBoundaryFilter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilterWidget::apply()
+{
+  VSAbstractFilterWidget::apply();
+
+  VSGrainBoundaryFilter::FeaturePairs pairs = ParseFeaturePairs(m_Internals->highlightLineEdit->text());
+  m_GrainBoundaryFilter->apply(getArrayName(), m_Internals->exteriorCheckBox->isChecked(), pairs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilterWidget::reset()
+{
+  setArrayName(m_GrainBoundaryFilter->getLastArrayName());
+  m_Internals->exteriorCheckBox->setChecked(m_GrainBoundaryFilter->getLastIncludeExterior());
+  m_Internals->highlightLineEdit->setText(FeaturePairsToString(m_GrainBoundaryFilter->getLastHighlightedPairs()));
+
+  cancelChanges();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilterWidget::updateArrayNames(vtkDataSet* inputData)
+{
+  QString selectedArrayName = m_Internals->featureIdsComboBox->currentText();
+
+  m_Internals->featureIdsComboBox->clear();
+  if(nullptr == inputData)
+  {
+    return;
+  }
+
+  int numArrays = inputData->GetCellData()->GetNumberOfArrays();
+  for(int i = 0; i < numArrays; i++)
+  {
+    vtkDataArray* dataArray = inputData->GetCellData()->GetArray(i);
+    if(VSGrainBoundaryFilter::isFeatureIdArray(dataArray))
+    {
+      m_Internals->featureIdsComboBox->addItem(dataArray->GetName());
+    }
+  }
+
+  // Default to the DREAM3D feature ID array when nothing is selected
+  if(selectedArrayName.isEmpty() && m_Internals->featureIdsComboBox->findText("FeatureIds") >= 0)
+  {
+    selectedArrayName = "FeatureIds";
+  }
+  m_Internals->featureIdsComboBox->setCurrentText(selectedArrayName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilterWidget::setArrayName(QString arrayName)
+{
+  if(false == arrayName.isEmpty())
+  {
+    m_Internals->featureIdsComboBox->setCurrentText(arrayName);
+  }
+
+  changesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSGrainBoundaryFilterWidget::getArrayName()
+{
+  return m_Internals->featureIdsComboBox->currentText();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilterWidget::valuesChanged()
+{
+  changesWaiting();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSGrainBoundaryFilter::FeaturePairs VSGrainBoundaryFilterWidget::ParseFeaturePairs(QString text)
+{
+  // IDs may be negative so the separator is the first '-' following a number
+  QRegularExpression pairExpression("^\\s*(-?\\d+)\\s*(?:-\\s*(-?\\d+))?\\s*$");
+
+  VSGrainBoundaryFilter::FeaturePairs pairs;
+  QStringList entries = text.split(',', QString::SkipEmptyParts);
+  for(QString entry : entries)
+  {
+    QRegularExpressionMatch match = pairExpression.match(entry);
+    if(false == match.hasMatch())
+    {
+      continue;
+    }
+
+    qint64 first = match.captured(1).toLongLong();
+    qint64 second = match.captured(2).isEmpty() ? first : match.captured(2).toLongLong();
+    pairs.push_back(VSGrainBoundaryFilter::FeaturePair(first, second));
+  }
+
+  return pairs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSGrainBoundaryFilterWidget::FeaturePairsToString(VSGrainBoundaryFilter::FeaturePairs pairs)
+{
+  QStringList entries;
+  for(VSGrainBoundaryFilter::FeaturePair pair : pairs)
+  {
+    if(pair.first == pair.second)
+    {
+      entries.push_back(QString::number(pair.first));
+    }
+    else
+    {
+      entries.push_back(QString("%1-%2").arg(pair.first).arg(pair.second));
+    }
+  }
+
+  return entries.join(", ");
+}
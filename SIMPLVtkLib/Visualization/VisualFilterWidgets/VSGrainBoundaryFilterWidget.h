@@ -0,0 +1,130 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/Visualization/VisualFilterWidgets/VSAbstractFilterWidget.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSGrainBoundaryFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSGrainBoundaryFilterWidget VSGrainBoundaryFilterWidget.h
+ * SIMPLVtkLib/Visualization/VisualFilterWidgets/VSGrainBoundaryFilterWidget.h
+ * @brief This class handles the user input for extracting grain boundaries from
+ * a feature ID array and selecting the feature pairs to highlight.
+ */
+class SIMPLVtkLib_EXPORT VSGrainBoundaryFilterWidget : public VSAbstractFilterWidget
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param filter
+   * @param interactor
+   * @param parent
+   */
+  VSGrainBoundaryFilterWidget(VSGrainBoundaryFilter* filter, vtkRenderWindowInteractor* interactor, QWidget* parent);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSGrainBoundaryFilterWidget() = default;
+
+  /**
+   * @brief Returns the filter used by the widget
+   * @return
+   */
+  VSAbstractFilter* getFilter() const override;
+
+  /**
+   * @brief Applies changes to the filter and updates the output
+   */
+  void apply() override;
+
+  /**
+   * @brief reset
+   */
+  void reset() override;
+
+  /**
+   * @brief Parses comma separated feature pairs such as "1-2, 5-9".  A single
+   * feature is returned as a pair with the same ID twice.  Invalid entries are skipped.
+   * @param text
+   * @return
+   */
+  static VSGrainBoundaryFilter::FeaturePairs ParseFeaturePairs(QString text);
+
+  /**
+   * @brief Returns the text describing the given feature pairs
+   * @param pairs
+   * @return
+   */
+  static QString FeaturePairsToString(VSGrainBoundaryFilter::FeaturePairs pairs);
+
+protected:
+  /**
+   * @brief Returns the selected feature ID array name
+   * @return
+   */
+  QString getArrayName();
+
+  /**
+   * @brief Sets the selected feature ID array name
+   * @param arrayName
+   */
+  void setArrayName(QString arrayName);
+
+  /**
+   * @brief Updates the feature ID array names based on the given vtkDataSet
+   * @param inputData
+   */
+  void updateArrayNames(vtkDataSet* inputData);
+
+protected slots:
+  /**
+   * @brief Notifies changes in the widget's values
+   */
+  void valuesChanged();
+
+private:
+  class vsInternals;
+  vsInternals* m_Internals;
+
+  VSGrainBoundaryFilter* m_GrainBoundaryFilter = nullptr;
+};
@@ -57,6 +57,15 @@ VSSIMPLDataContainerFilterWidget::VSSIMPLDataContainerFilterWidget(VSSIMPLDataCo
 , m_DataContainerFilter(filter)
 {
   m_Internals->setupUi(this);
+
+  // Only slice-only ImageGeoms have arrays to choose from
+  bool sliceOnly = m_DataContainerFilter->isSliceOnly();
+  m_Internals->sliceArrayLabel->setVisible(sliceOnly);
+  m_Internals->sliceArrayComboBox->setVisible(sliceOnly);
+  m_Internals->sliceArrayComboBox->addItems(m_DataContainerFilter->getSliceArrayNames());
+  m_Internals->sliceArrayComboBox->setCurrentText(m_DataContainerFilter->getActiveSliceArray());
+  connect(m_Internals->sliceArrayComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(currentSliceArrayChanged(int)));
+
   cancelChanges();
 
   if(m_DataContainerFilter->isInitialized() == true)
@@ -90,4 +99,27 @@ void VSSIMPLDataContainerFilterWidget::setBounds(double* bounds)
 void VSSIMPLDataContainerFilterWidget::apply()
 {
   m_DataContainerFilter->apply();
+
+  if(m_DataContainerFilter->isSliceOnly())
+  {
+    m_DataContainerFilter->setActiveSliceArray(m_Internals->sliceArrayComboBox->currentText());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilterWidget::reset()
+{
+  m_Internals->sliceArrayComboBox->setCurrentText(m_DataContainerFilter->getActiveSliceArray());
+
+  cancelChanges();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilterWidget::currentSliceArrayChanged(int index)
+{
+  changesWaiting();
 }
@@ -81,6 +81,18 @@ public:
    */
   void apply() override;
 
+  /**
+   * @brief Resets the widget to the filter's values
+   */
+  void reset() override;
+
+protected slots:
+  /**
+   * @brief Marks the widget as having changes when a different slice array is selected
+   * @param index
+   */
+  void currentSliceArrayChanged(int index);
+
 private:
   class vsInternals;
   vsInternals* m_Internals;
@@ -2,10 +2,13 @@
 set(VSVisualFilters
   VSAbstractDataFilter
   VSAbstractFilter
+  VSCalculatorFilter
   VSClipFilter
+  VSContourFilter
   VSCropFilter
   VSDataSetFilter
   VSFileNameFilter
+  VSGrainBoundaryFilter
   VSMaskFilter
   VSPipelineFilter
   VSRootFilter
@@ -35,12 +35,31 @@
 
 #include "VSAbstractDataFilter.h"
 
+#include <QtConcurrent>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSDataSetSnapshot.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 VSAbstractDataFilter::VSAbstractDataFilter()
 : VSAbstractFilter()
+, m_OutputHashWatcher(this)
 {
+  connect(&m_OutputHashWatcher, SIGNAL(finished()), this, SLOT(outputHashed()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractDataFilter::~VSAbstractDataFilter()
+{
+  m_OutputHashWatcher.waitForFinished();
 }
 
 // -----------------------------------------------------------------------------
@@ -107,3 +126,83 @@ VSAbstractFilter::FilterType VSAbstractDataFilter::getFilterType() const
 {
   return FilterType::Data;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray VSAbstractDataFilter::getOutputKey()
+{
+  VTK_PTR(vtkDataSet) output = getOutput();
+  if(nullptr == output)
+  {
+    return QByteArray();
+  }
+
+  if(output.Get() == m_OutputKeyData && output->GetMTime() == m_OutputKeyTime)
+  {
+    return m_OutputKey;
+  }
+
+  // Files are identified without reading the data again
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(getParentFilter());
+  QFileInfo fileInfo(fileFilter ? fileFilter->getFilePath() : QString());
+  if(fileInfo.exists())
+  {
+    QJsonObject json;
+    writeJson(json);
+    json.remove("CheckState");
+
+    // The output size changes with the refinement level read from the file
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(fileInfo.absoluteFilePath().toUtf8());
+    hash.addData(QByteArray::number(fileInfo.size()));
+    hash.addData(QByteArray::number(fileInfo.lastModified().toMSecsSinceEpoch()));
+    hash.addData(QByteArray::number(output->GetNumberOfPoints()));
+    hash.addData(QByteArray::number(output->GetNumberOfCells()));
+    hash.addData(QJsonDocument(json).toJson(QJsonDocument::Compact));
+
+    m_OutputKey = hash.result();
+    m_OutputKeyData = output.Get();
+    m_OutputKeyTime = output->GetMTime();
+    return m_OutputKey;
+  }
+
+  // Hashing every array takes too long for the GUI thread
+  m_OutputKey.clear();
+  m_OutputKeyData = output.Get();
+  m_OutputKeyTime = output->GetMTime();
+  if(false == m_OutputHashWatcher.isRunning())
+  {
+    m_HashedData = output.Get();
+    m_HashedTime = output->GetMTime();
+    m_OutputHashWatcher.setFuture(QtConcurrent::run(&VSAbstractDataFilter::HashOutput, output));
+  }
+
+  return m_OutputKey;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray VSAbstractDataFilter::HashOutput(VTK_PTR(vtkDataSet) output)
+{
+  return VSDataSetSnapshot::HashDataSet(output);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractDataFilter::outputHashed()
+{
+  // Outputs replaced while hashing are hashed again on the next request
+  VTK_PTR(vtkDataSet) output = getOutput();
+  if(nullptr == output || output.Get() != m_HashedData || output->GetMTime() != m_HashedTime)
+  {
+    m_OutputKeyData = nullptr;
+    return;
+  }
+
+  m_OutputKey = m_OutputHashWatcher.result();
+  m_OutputKeyData = m_HashedData;
+  m_OutputKeyTime = m_HashedTime;
+}
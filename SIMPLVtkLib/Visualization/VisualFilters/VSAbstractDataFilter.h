@@ -53,7 +53,7 @@ public:
   /**
    * @brief Deconstructor
    */
-  virtual ~VSAbstractDataFilter() = default;
+  virtual ~VSAbstractDataFilter();
 
   /**
    * @brief Returns the required input data type
@@ -84,10 +84,24 @@ public:
    */
   FilterType getFilterType() const override;
 
+  /**
+   * @brief Returns a key for the imported vtkDataSet.  Data read from a file is keyed by
+   * the file's path, size, and modification time.  Other data is hashed on a separate
+   * thread, and an empty key is returned until the hash is ready.
+   * @return
+   */
+  QByteArray getOutputKey() override;
+
 signals:
   void dataReloaded();
   void filterReloaded(VSAbstractFilter* filter);
 
+protected slots:
+  /**
+   * @brief Stores the output hash once it has been calculated
+   */
+  void outputHashed();
+
 protected:
   /**
    * @brief Constructor
@@ -101,6 +115,19 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Hashes the given output.  Called on a separate thread.
+   * @param output
+   * @return
+   */
+  static QByteArray HashOutput(VTK_PTR(vtkDataSet) output);
+
 private:
   bool m_DataImported = false;
+  QByteArray m_OutputKey;
+  vtkDataSet* m_OutputKeyData = nullptr;
+  vtkMTimeType m_OutputKeyTime = 0;
+  QFutureWatcher<QByteArray> m_OutputHashWatcher;
+  vtkDataSet* m_HashedData = nullptr;
+  vtkMTimeType m_HashedTime = 0;
 };
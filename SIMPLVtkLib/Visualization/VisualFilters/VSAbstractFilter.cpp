@@ -35,7 +35,10 @@
 
 #include "VSAbstractFilter.h"
 
+#include <QtConcurrent>
 #include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QJsonDocument>
 #include <QtCore/QString>
 #include <QtCore/QThread>
 
@@ -44,11 +47,15 @@
 #include <vtkGenericDataObjectWriter.h>
 #include <vtkPointData.h>
 #include <vtkPointSet.h>
+#include <vtkPolyData.h>
 
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
 #include "SIMPLVtkLib/SIMPLBridge/VSVertexGeom.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSFilterModel.h"
 #include "SIMPLVtkLib/Visualization/Controllers/VSLookupTableController.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSMemoryManager.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSOutputCache.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSSessionBundle.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 #include "SIMPLVtkLib/Visualization/VtkWidgets/VSAbstractWidget.h"
 
@@ -61,6 +68,7 @@ VSAbstractFilter::VSAbstractFilter()
 , m_Transform(new VSTransform())
 , m_ChildLock(1)
 , m_InputPort(nullptr)
+, m_CachedOutputWatcher(this)
 {
   setCheckable(true);
   setChecked(true);
@@ -71,6 +79,9 @@ VSAbstractFilter::VSAbstractFilter()
   m_Transform->moveToThread(thread);
 
   connect(this, SIGNAL(updatedOutputPort(VSAbstractFilter*)), this, SLOT(connectAdditionalOutputFilters(VSAbstractFilter*)));
+  connect(&m_CachedOutputWatcher, SIGNAL(finished()), this, SLOT(cachedOutputDecoded()));
+
+  VSMemoryManager::Instance()->addFilter(this);
 }
 
 // -----------------------------------------------------------------------------
@@ -750,7 +761,14 @@ void VSAbstractFilter::connectToOutput(VSAbstractFilter* filter)
   if(getConnectedInput())
   {
     // Connect algorithm input and filter output
+    markOutputDirty();
     updateAlgorithmInput(filter);
+
+    // Hidden branches wait until they are displayed or their output is requested
+    if(isOutputDemanded())
+    {
+      updateDirtyOutput();
+    }
   }
   else
   {
@@ -910,6 +928,472 @@ void VSAbstractFilter::writeJson(QJsonObject& json)
   json["Transform"] = transformObject;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray VSAbstractFilter::getOutputKey()
+{
+  QJsonObject json;
+  writeJson(json);
+
+  // Checking or unchecking a filter does not change its output
+  json.remove("CheckState");
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  VSAbstractFilter* parentFilter = getParentFilter();
+  if(parentFilter)
+  {
+    // Outputs of a parent without a key cannot be told apart
+    QByteArray parentKey = parentFilter->getOutputKey();
+    if(parentKey.isEmpty())
+    {
+      return QByteArray();
+    }
+    hash.addData(parentKey);
+  }
+  hash.addData(QJsonDocument(json).toJson(QJsonDocument::Compact));
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::canCacheOutput() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::setDisplayedBy(const QObject* viewer, bool displayed)
+{
+  if(displayed)
+  {
+    m_DisplayViewers.insert(viewer);
+    connect(viewer, &QObject::destroyed, this, &VSAbstractFilter::displayViewerDestroyed, Qt::UniqueConnection);
+    updateDirtyOutput();
+  }
+  else
+  {
+    m_DisplayViewers.remove(viewer);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::displayViewerDestroyed(QObject* viewer)
+{
+  m_DisplayViewers.remove(viewer);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isDisplayed() const
+{
+  return false == m_DisplayViewers.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isOutputDemanded() const
+{
+  if(isDisplayed())
+  {
+    return true;
+  }
+
+  FilterListType children = getChildren();
+  for(VSAbstractFilter* child : children)
+  {
+    if(child->isOutputDemanded())
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isOutputDirty() const
+{
+  return m_OutputDirty;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::markOutputDirty()
+{
+  m_OutputDirty = true;
+
+  FilterListType children = getChildren();
+  for(VSAbstractFilter* child : children)
+  {
+    child->markOutputDirty();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::requestOutputUpdate()
+{
+  markOutputDirty();
+
+  if(isOutputDemanded())
+  {
+    executeDirtyOutput();
+  }
+  else
+  {
+    // A stored output for the previous values should not stay connected while waiting
+    releaseStaleCachedOutput();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::updateDirtyOutput() const
+{
+  // Outputs are generated when they are first requested, including through const accessors
+  VSAbstractFilter* filter = const_cast<VSAbstractFilter*>(this);
+  VSMemoryManager::Instance()->outputUsed(filter);
+
+  if(false == m_OutputDirty)
+  {
+    return;
+  }
+
+  vtkAlgorithmOutput* previousPort = filter->getOutputPort();
+  filter->executeDirtyOutput();
+
+  if(filter->getOutputPort() != previousPort)
+  {
+    emit filter->updatedOutputPort(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::executeDirtyOutput()
+{
+  VSAbstractFilter* parentFilter = getParentFilter();
+  if(parentFilter)
+  {
+    parentFilter->updateDirtyOutput();
+  }
+
+  // Updating the parent may already have brought this filter up to date
+  if(false == m_OutputDirty)
+  {
+    return;
+  }
+
+  m_OutputDirty = false;
+  m_ExecuteTimer.start();
+  executeOutput();
+
+  VSMemoryManager::Instance()->outputUpdated(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::executeOutput()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataObject* VSAbstractFilter::getResidentOutput()
+{
+  if(false == getConnectedInput())
+  {
+    return nullptr;
+  }
+
+  vtkAlgorithmOutput* outputPort = getOutputPort();
+  if(nullptr == outputPort || nullptr == outputPort->GetProducer())
+  {
+    return nullptr;
+  }
+
+  return outputPort->GetProducer()->GetOutputDataObject(outputPort->GetIndex());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkDataObject* VSAbstractFilter::getResidentTransformedOutput()
+{
+  if(nullptr == m_TransformFilter)
+  {
+    return nullptr;
+  }
+
+  return m_TransformFilter->GetOutputDataObject(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::canReleaseOutput()
+{
+  if(FilterType::Filter != getFilterType() || isDisplayed() || isOutputDirty() || hasCachedOutput())
+  {
+    return false;
+  }
+
+  vtkDataObject* output = getResidentOutput();
+  if(nullptr == output || output->GetDataReleased())
+  {
+    return false;
+  }
+
+  // Trivial producers cannot generate their output again
+  vtkAlgorithmOutput* outputPort = getOutputPort();
+  return nullptr == vtkTrivialProducer::SafeDownCast(outputPort->GetProducer());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::releaseOutput()
+{
+  if(false == canReleaseOutput())
+  {
+    return false;
+  }
+
+  // Released data objects make the VTK pipeline execute again on the next update
+  getResidentOutput()->ReleaseData();
+  vtkDataObject* transformedOutput = getResidentTransformedOutput();
+  if(transformedOutput)
+  {
+    transformedOutput->ReleaseData();
+  }
+
+  m_OutputDirty = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSAbstractFilter::FindCachedOutput(const QByteArray& key)
+{
+  if(key.isEmpty())
+  {
+    return nullptr;
+  }
+
+  VTK_PTR(vtkDataSet) output = VSSessionBundle::FindSnapshot(key);
+  if(nullptr == output)
+  {
+    output = VSOutputCache::Instance()->find(key);
+  }
+
+  return output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::IsOutputStored(const QByteArray& key)
+{
+  if(key.isEmpty())
+  {
+    return false;
+  }
+
+  return VSSessionBundle::HasSnapshot(key) || VSOutputCache::Instance()->contains(key);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::IsOutputStoreActive()
+{
+  return VSOutputCache::Instance()->isEnabled() || nullptr != VSSessionBundle::GetActiveBundle();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::storeCachedOutput()
+{
+  // Outputs generated from a placeholder while an ancestor is decoding are never stored
+  if(false == canCacheOutput() || false == VSOutputCache::Instance()->isEnabled() || isDecodingCachedOutput())
+  {
+    return;
+  }
+
+  qint64 executeMSecs = m_ExecuteTimer.isValid() ? m_ExecuteTimer.elapsed() : 0;
+  VSOutputCache::Instance()->store(getOutputKey(), getOutput(), executeMSecs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::restoreCachedOutput()
+{
+  // Building the key can be expensive so nothing is looked up while there is nowhere to look
+  if(false == IsOutputStoreActive())
+  {
+    clearCachedOutput();
+    return false;
+  }
+
+  QByteArray key = getOutputKey();
+  if(hasCachedOutput() && key == m_CachedOutputKey)
+  {
+    return true;
+  }
+
+  clearCachedOutput();
+  if(key == m_UnreadableOutputKey || false == IsOutputStored(key))
+  {
+    return false;
+  }
+
+  // The placeholder keeps the output type so downstream filters stay connected while decoding
+  vtkDataObject* residentOutput = getResidentOutput();
+  VTK_PTR(vtkDataSet) placeholder;
+  if(vtkDataSet::SafeDownCast(residentOutput))
+  {
+    placeholder.TakeReference(vtkDataSet::SafeDownCast(residentOutput->NewInstance()));
+  }
+  else
+  {
+    placeholder = VTK_PTR(vtkPolyData)::New();
+  }
+
+  if(nullptr == m_CachedOutputProducer)
+  {
+    m_CachedOutputProducer = VTK_PTR(vtkTrivialProducer)::New();
+  }
+  m_CachedOutputProducer->SetOutput(placeholder);
+  m_CachedOutputKey = key;
+  m_CachedOutputWatcher.setFuture(QtConcurrent::run(&VSAbstractFilter::FindCachedOutput, key));
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::cachedOutputDecoded()
+{
+  // Outputs released or replaced while decoding are dropped
+  QByteArray key = m_CachedOutputKey;
+  VTK_PTR(vtkDataSet) output = m_CachedOutputWatcher.result();
+  if(key.isEmpty())
+  {
+    return;
+  }
+
+  if(nullptr == output)
+  {
+    m_UnreadableOutputKey = key;
+    clearCachedOutput();
+    requestOutputUpdate();
+  }
+  else
+  {
+    m_CachedOutputProducer->SetOutput(output);
+  }
+
+  // Children generated their outputs from the placeholder
+  FilterListType children = getChildren();
+  for(VSAbstractFilter* child : children)
+  {
+    child->requestOutputUpdate();
+  }
+
+  emit updatedOutputPort(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::isDecodingCachedOutput() const
+{
+  for(const VSAbstractFilter* filter = this; filter; filter = filter->getParentFilter())
+  {
+    if(filter->m_CachedOutputWatcher.isRunning())
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::releaseStaleCachedOutput()
+{
+  if(false == hasCachedOutput() || getOutputKey() == m_CachedOutputKey)
+  {
+    return false;
+  }
+
+  clearCachedOutput();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSAbstractFilter::clearCachedOutput()
+{
+  m_CachedOutputKey.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSAbstractFilter::hasCachedOutput() const
+{
+  return false == m_CachedOutputKey.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSAbstractFilter::getCachedOutputPort()
+{
+  if(false == hasCachedOutput())
+  {
+    return nullptr;
+  }
+
+  return m_CachedOutputProducer->GetOutputPort();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSAbstractFilter::getCachedOutput() const
+{
+  if(false == hasCachedOutput())
+  {
+    return nullptr;
+  }
+
+  return vtkDataSet::SafeDownCast(m_CachedOutputProducer->GetOutputDataObject(0));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -47,11 +47,14 @@
 #include <vtkTransformFilter.h>
 #include <vtkTrivialProducer.h>
 
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QList>
 #include <QtCore/QObject>
 #include <QtCore/QSemaphore>
+#include <QtCore/QSet>
 #include <QtCore/QString>
 #include <QtCore/QVector>
 #include <QtGui/QFont>
@@ -348,6 +351,82 @@ public:
    */
   virtual void writeJson(QJsonObject& json);
 
+  /**
+   * @brief Returns a key identifying the filter's output.  The key is built from the
+   * parent filter's output key and the applied values written by writeJson, so it
+   * changes whenever the input data or any applied parameter changes.
+   * @return
+   */
+  virtual QByteArray getOutputKey();
+
+  /**
+   * @brief Returns true if the current output was generated by this filter and can be
+   * stored under getOutputKey().  Returns false by default.
+   * @return
+   */
+  virtual bool canCacheOutput() const;
+
+  /**
+   * @brief Sets whether or not the given viewer currently displays the filter's output.
+   * Displaying the output brings this filter and its ancestors up to date.
+   * @param viewer
+   * @param displayed
+   */
+  void setDisplayedBy(const QObject* viewer, bool displayed);
+
+  /**
+   * @brief Returns true if any viewer currently displays the filter's output
+   * @return
+   */
+  bool isDisplayed() const;
+
+  /**
+   * @brief Returns true if the filter or any of its descendants is displayed.  Filters
+   * without a displayed descendant only execute when their output is requested.
+   * @return
+   */
+  bool isOutputDemanded() const;
+
+  /**
+   * @brief Returns true if applied values or input changes have not been executed yet
+   * @return
+   */
+  bool isOutputDirty() const;
+
+  /**
+   * @brief Executes the filter if it has pending changes.  Dirty ancestors are executed first.
+   */
+  void updateDirtyOutput() const;
+
+  /**
+   * @brief Returns the output currently held by the filter without executing it.  Returns
+   * nullptr if the filter passes its parent's output through.
+   * @return
+   */
+  vtkDataObject* getResidentOutput();
+
+  /**
+   * @brief Returns the transformed output currently held by the filter without executing
+   * it.  Returns nullptr if the transformed output was never requested.
+   * @return
+   */
+  vtkDataObject* getResidentTransformedOutput();
+
+  /**
+   * @brief Returns true if the filter's output can be released and generated again when it
+   * is next needed.  Only hidden outputs of visual filters backed by a vtkAlgorithm qualify.
+   * @return
+   */
+  bool canReleaseOutput();
+
+  /**
+   * @brief Releases the output and transformed output if canReleaseOutput() returns true.
+   * The filter executes again the next time its output is requested.  Returns true if the
+   * output was released.
+   * @return
+   */
+  bool releaseOutput();
+
   /**
    * @brief Returns the VSFilterModel that this item belongs to
    * @return
@@ -444,6 +523,18 @@ protected slots:
    */
   void updateTransformFilter();
 
+  /**
+   * @brief Stops counting a destroyed viewer as displaying the filter
+   * @param viewer
+   */
+  void displayViewerDestroyed(QObject* viewer);
+
+  /**
+   * @brief Uses the stored output once it has been decoded on a separate thread.  The filter
+   * is executed instead if the stored output could not be read.
+   */
+  void cachedOutputDecoded();
+
 protected:
   /**
    * @brief Constructor
@@ -533,7 +624,104 @@ protected:
    */
   void setEditable(bool editable);
 
+  /**
+   * @brief Generates the filter output from the applied values.  Subclasses that defer
+   * execution until the output is needed override this.  Does nothing by default.
+   */
+  virtual void executeOutput();
+
+  /**
+   * @brief Marks the output and every descendant's output as dirty and executes the
+   * filter right away if its output is demanded.
+   */
+  void requestOutputUpdate();
+
+  /**
+   * @brief Marks the output and every descendant's output as dirty
+   */
+  void markOutputDirty();
+
+  /**
+   * @brief Returns a previously generated output stored under the given key or nullptr
+   * if no output was found.  The active session bundle is searched before the VSOutputCache.
+   * Stored outputs are decoded by the calling thread.
+   * @param key
+   * @return
+   */
+  static VTK_PTR(vtkDataSet) FindCachedOutput(const QByteArray& key);
+
+  /**
+   * @brief Returns true if an output is stored under the given key without decoding it
+   * @param key
+   * @return
+   */
+  static bool IsOutputStored(const QByteArray& key);
+
+  /**
+   * @brief Returns true if the VSOutputCache is enabled or a session bundle is active.
+   * Output keys are only built while this is true.
+   * @return
+   */
+  static bool IsOutputStoreActive();
+
+  /**
+   * @brief Stores the current output in the VSOutputCache under the current output key
+   * if canCacheOutput() returns true.  The time since executeOutput was last called is
+   * used as the cost of generating the output.
+   */
+  void storeCachedOutput();
+
+  /**
+   * @brief Looks up a stored output for the current output key and uses it as the
+   * filter output if one exists.  Returns true if a stored output was found.  The stored
+   * output is decoded on a separate thread and an empty output of the same type is used
+   * until it is ready.
+   * @return
+   */
+  bool restoreCachedOutput();
+
+  /**
+   * @brief Returns true while this filter or one of its ancestors is decoding a stored output
+   * @return
+   */
+  bool isDecodingCachedOutput() const;
+
+  /**
+   * @brief Stops using the stored output if the output key has changed since it was
+   * restored.  Returns true if the stored output was released.
+   * @return
+   */
+  bool releaseStaleCachedOutput();
+
+  /**
+   * @brief Stops using the stored output
+   */
+  void clearCachedOutput();
+
+  /**
+   * @brief Returns true if the filter output comes from a stored output
+   * @return
+   */
+  bool hasCachedOutput() const;
+
+  /**
+   * @brief Returns the output port for the stored output
+   * @return
+   */
+  vtkAlgorithmOutput* getCachedOutputPort();
+
+  /**
+   * @brief Returns the stored output
+   * @return
+   */
+  VTK_PTR(vtkDataSet) getCachedOutput() const;
+
 private:
+  /**
+   * @brief Executes dirty ancestors and then this filter without announcing port changes
+   */
+  void executeDirtyOutput();
+
   /**
    * @brief Adds a child VSAbstractFilter
    * @param child
@@ -558,6 +746,13 @@ private:
   QFont m_Font;
   Qt::ItemFlags m_Flags;
   QString m_DisplayText;
+  VTK_PTR(vtkTrivialProducer) m_CachedOutputProducer;
+  QByteArray m_CachedOutputKey;
+  QByteArray m_UnreadableOutputKey;
+  QFutureWatcher<VTK_PTR(vtkDataSet)> m_CachedOutputWatcher;
+  QElapsedTimer m_ExecuteTimer;
+  QSet<const QObject*> m_DisplayViewers;
+  bool m_OutputDirty = false;
 };
 
 #ifdef __clang__
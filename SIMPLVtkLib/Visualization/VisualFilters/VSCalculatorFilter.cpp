@@ -0,0 +1,347 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSCalculatorFilter.h"
+
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include <vtkDataSet.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCalculatorFilter::VSCalculatorFilter(VSAbstractFilter* parent)
+: VSAbstractFilter()
+{
+  m_CalculatorAlgorithm = nullptr;
+  setParentFilter(parent);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCalculatorFilter::VSCalculatorFilter(const VSCalculatorFilter& copy)
+: VSAbstractFilter()
+, m_LastExpression(copy.m_LastExpression)
+, m_LastResultName(copy.m_LastResultName)
+, m_LastArrayType(copy.m_LastArrayType)
+{
+  m_CalculatorAlgorithm = nullptr;
+  setParentFilter(copy.getParentFilter());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCalculatorFilter* VSCalculatorFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
+{
+  VSCalculatorFilter* filter = new VSCalculatorFilter(parent);
+
+  filter->readJson(json);
+
+  filter->setInitialized(true);
+  filter->readTransformJson(json);
+
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::createFilter()
+{
+  m_CalculatorAlgorithm = VTK_PTR(VSArrayCalculator)::New();
+  m_CalculatorAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+  setConnectedInput(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSCalculatorFilter::getFilterName() const
+{
+  return "Calculator";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSCalculatorFilter::getToolTip() const
+{
+  return "Array Calculator Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::FilterType VSCalculatorFilter::getFilterType() const
+{
+  return FilterType::Filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::apply(QString expression, QString resultName, ArrayType arrayType)
+{
+  if(nullptr == m_CalculatorAlgorithm)
+  {
+    createFilter();
+  }
+
+  // Save the applied values for resetting Calculator-Type widgets
+  m_LastExpression = expression;
+  m_LastResultName = resultName;
+  m_LastArrayType = arrayType;
+
+  int association = (ArrayType::PointData == arrayType) ? vtkDataObject::FIELD_ASSOCIATION_POINTS : vtkDataObject::FIELD_ASSOCIATION_CELLS;
+  m_CalculatorAlgorithm->SetExpression(expression.toStdString());
+  m_CalculatorAlgorithm->SetResultArrayName(resultName.toStdString());
+  m_CalculatorAlgorithm->SetAttributeType(association);
+  requestOutputUpdate();
+
+  emit updatedOutputPort(this);
+  emit arrayNamesChanged();
+  emit scalarNamesChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSCalculatorFilter::getErrorMessage() const
+{
+  if(nullptr == m_CalculatorAlgorithm)
+  {
+    return QString();
+  }
+
+  return QString::fromStdString(m_CalculatorAlgorithm->GetErrorMessage());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::readJson(QJsonObject& json)
+{
+  m_LastExpression = json["Last Expression"].toString();
+  m_LastResultName = json["Last Result Name"].toString("Result");
+  m_LastArrayType = static_cast<ArrayType>(json["Last Array Type"].toInt());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::writeJson(QJsonObject& json)
+{
+  VSAbstractFilter::writeJson(json);
+
+  json["Last Expression"] = m_LastExpression;
+  json["Last Result Name"] = m_LastResultName;
+  json["Last Array Type"] = static_cast<int>(m_LastArrayType);
+  json["Uuid"] = GetUuid().toString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::executeOutput()
+{
+  if(nullptr == m_CalculatorAlgorithm)
+  {
+    return;
+  }
+
+  m_CalculatorAlgorithm->Update();
+
+  if(false == getErrorMessage().isEmpty())
+  {
+    emit errorGenerated("Calculator Error", getErrorMessage(), -3100);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSCalculatorFilter::getOutputPort()
+{
+  if(getConnectedInput() && m_CalculatorAlgorithm)
+  {
+    return m_CalculatorAlgorithm->GetOutputPort();
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutputPort();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSCalculatorFilter::getOutput() const
+{
+  updateDirtyOutput();
+
+  if(getConnectedInput() && m_CalculatorAlgorithm)
+  {
+    return vtkDataSet::SafeDownCast(m_CalculatorAlgorithm->GetOutputDataObject(0));
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutput();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::updateAlgorithmInput(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  setInputPort(filter->getOutputPort());
+
+  if(getConnectedInput() && m_CalculatorAlgorithm)
+  {
+    m_CalculatorAlgorithm->SetInputConnection(filter->getOutputPort());
+  }
+  else
+  {
+    emit updatedOutputPort(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid VSCalculatorFilter::GetUuid()
+{
+  return QUuid("{be307106-795d-4eb8-961e-3332808d0902}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSCalculatorFilter::getOutputType() const
+{
+  // The input type is passed through
+  if(getParentFilter())
+  {
+    return getParentFilter()->getOutputType();
+  }
+
+  return INVALID_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSCalculatorFilter::getRequiredInputType()
+{
+  return ANY_DATA_SET;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSCalculatorFilter::compatibleWithParent(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return false;
+  }
+
+  if(compatibleInput(filter->getOutputType(), getRequiredInputType()))
+  {
+    return true;
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSCalculatorFilter::getLastExpression()
+{
+  return m_LastExpression;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::setLastExpression(QString expression)
+{
+  m_LastExpression = expression;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSCalculatorFilter::getLastResultName()
+{
+  return m_LastResultName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::setLastResultName(QString resultName)
+{
+  m_LastResultName = resultName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSCalculatorFilter::ArrayType VSCalculatorFilter::getLastArrayType()
+{
+  return m_LastArrayType;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCalculatorFilter::setLastArrayType(ArrayType arrayType)
+{
+  m_LastArrayType = arrayType;
+}
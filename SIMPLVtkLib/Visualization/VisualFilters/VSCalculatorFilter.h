@@ -0,0 +1,233 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSArrayCalculator.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSCalculatorFilter VSCalculatorFilter.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSCalculatorFilter.h
+ * @brief This class adds an array calculated from an arithmetic or logical
+ * expression over the cell or point arrays of its input.  The calculated array
+ * becomes the active scalars so it can be thresholded, masked, or colored by.
+ * See VSArrayExpression for the expression syntax.
+ */
+class SIMPLVtkLib_EXPORT VSCalculatorFilter : public VSAbstractFilter
+{
+  Q_OBJECT
+
+public:
+  enum class ArrayType : int
+  {
+    CellData = 0,
+    PointData = 1
+  };
+
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSCalculatorFilter(VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Copy constructor
+   * @param copy
+   */
+  VSCalculatorFilter(const VSCalculatorFilter& copy);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSCalculatorFilter() = default;
+
+  /**
+   * @brief Create
+   * @param json
+   * @param parent
+   * @return
+   */
+  static VSCalculatorFilter* Create(QJsonObject& json, VSAbstractFilter* parent);
+
+  /**
+   * Brief Returns the filter name
+   * @return
+   */
+  QString getFilterName() const override;
+
+  /**
+   * @brief Convenience method for determining what the filter does
+   * @return
+   */
+  FilterType getFilterType() const override;
+
+  /**
+   * @brief Returns the tooltip to use for the filter
+   * @return
+   */
+  virtual QString getToolTip() const override;
+
+  /**
+   * @brief Calculates the named array from the expression using arrays of the given type
+   * @param expression
+   * @param resultName
+   * @param arrayType
+   */
+  void apply(QString expression, QString resultName, ArrayType arrayType);
+
+  /**
+   * @brief Returns the error message from the last calculation or an empty string
+   * if the expression was evaluated
+   * @return
+   */
+  QString getErrorMessage() const;
+
+  /**
+   * @brief Returns the output port to be used by vtkMappers and subsequent filters
+   * @return
+   */
+  virtual vtkAlgorithmOutput* getOutputPort() override;
+
+  /**
+   * @brief Returns a smart pointer containing the output data from the filter
+   * @return
+   */
+  virtual VTK_PTR(vtkDataSet) getOutput() const override;
+
+  /**
+   * @brief Returns the output data type
+   * @return
+   */
+  dataType_t getOutputType() const override;
+
+  /**
+   * @brief Returns the required input data type
+   * @return
+   */
+  static dataType_t getRequiredInputType();
+
+  /**
+   * @brief Returns true if this filter type can be added as a child of
+   * the given filter.  Returns false otherwise.
+   * @param
+   * @return
+   */
+  static bool compatibleWithParent(VSAbstractFilter* filter);
+
+  /**
+   * @brief Returns the last expression applied
+   * @return
+   */
+  QString getLastExpression();
+
+  /**
+   * @brief Sets the last expression applied
+   * @param expression
+   */
+  void setLastExpression(QString expression);
+
+  /**
+   * @brief Returns the name of the array last calculated
+   * @return
+   */
+  QString getLastResultName();
+
+  /**
+   * @brief Sets the name of the array last calculated
+   * @param resultName
+   */
+  void setLastResultName(QString resultName);
+
+  /**
+   * @brief Returns the type of arrays last used
+   * @return
+   */
+  ArrayType getLastArrayType();
+
+  /**
+   * @brief Sets the type of arrays last used
+   * @param arrayType
+   */
+  void setLastArrayType(ArrayType arrayType);
+
+  /**
+   * @brief Reads values from a json file into the filter
+   * @param json
+   */
+  void readJson(QJsonObject& json);
+
+  /**
+   * @brief Writes values to a json file from the filter
+   * @param json
+   */
+  void writeJson(QJsonObject& json) override;
+
+  /**
+   * @brief getUuid
+   * @return
+   */
+  static QUuid GetUuid();
+
+protected:
+  /**
+   * @brief Initializes the algorithm and connects it to the vtkMapper
+   */
+  void createFilter() override;
+
+  /**
+   * @brief This method updates the input port and connects it to the vtkAlgorithm if it exists
+   * @param filter
+   */
+  void updateAlgorithmInput(VSAbstractFilter* filter) override;
+
+  /**
+   * @brief Evaluates the applied expression and reports any errors
+   */
+  void executeOutput() override;
+
+private:
+  VTK_PTR(VSArrayCalculator) m_CalculatorAlgorithm;
+
+  QString m_LastExpression;
+  QString m_LastResultName = "Result";
+  ArrayType m_LastArrayType = ArrayType::CellData;
+};
+
+Q_DECLARE_METATYPE(VSCalculatorFilter)
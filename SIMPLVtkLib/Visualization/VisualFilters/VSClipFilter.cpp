@@ -198,7 +198,7 @@ void VSClipFilter::apply(double origin[3], double normal[3], bool inverted)
 
   m_ClipAlgorithm->SetClipFunction(plane);
   m_ClipAlgorithm->SetInsideOut(inverted);
-  m_ClipAlgorithm->Update();
+  requestOutputUpdate();
 
   emit updatedOutputPort(this);
   emit clipTypeChanged();
@@ -228,7 +228,7 @@ void VSClipFilter::apply(VTK_PTR(vtkPlanes) planes, VTK_PTR(vtkTransform) transf
 
   m_ClipAlgorithm->SetClipFunction(planes);
   m_ClipAlgorithm->SetInsideOut(inverted);
-  m_ClipAlgorithm->Update();
+  requestOutputUpdate();
 
   emit updatedOutputPort(this);
   emit clipTypeChanged();
@@ -411,7 +411,11 @@ QUuid VSClipFilter::GetUuid()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSClipFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_ClipAlgorithm)
+  if(hasCachedOutput())
+  {
+    return getCachedOutputPort();
+  }
+  else if(getConnectedInput() && m_ClipAlgorithm)
   {
     return m_ClipAlgorithm->GetOutputPort();
   }
@@ -428,7 +432,13 @@ vtkAlgorithmOutput* VSClipFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSClipFilter::getOutput() const
 {
-  if(getConnectedInput() && m_ClipAlgorithm)
+  updateDirtyOutput();
+
+  if(hasCachedOutput())
+  {
+    return getCachedOutput();
+  }
+  else if(getConnectedInput() && m_ClipAlgorithm)
   {
     return m_ClipAlgorithm->GetOutput();
   }
@@ -455,6 +465,12 @@ void VSClipFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   if(getConnectedInput() && m_ClipAlgorithm)
   {
     m_ClipAlgorithm->SetInputConnection(filter->getOutputPort());
+
+    // Children reconnect to the algorithm once the stored output no longer matches the input
+    if(releaseStaleCachedOutput())
+    {
+      emit updatedOutputPort(this);
+    }
   }
   else
   {
@@ -462,6 +478,31 @@ void VSClipFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSClipFilter::executeOutput()
+{
+  if(nullptr == m_ClipAlgorithm)
+  {
+    return;
+  }
+
+  if(false == restoreCachedOutput())
+  {
+    m_ClipAlgorithm->Update();
+    storeCachedOutput();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSClipFilter::canCacheOutput() const
+{
+  return getConnectedInput() && m_ClipAlgorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -0,0 +1,456 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSContourFilter.h"
+
+#include <vector>
+
+#include <QtConcurrent>
+#include <QtCore/QJsonArray>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkPointData.h>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSImageContourFilter.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSContourFilter::VSContourFilter(VSAbstractFilter* parent)
+: VSAbstractFilter()
+, m_ContourWatcher(this)
+{
+  connect(&m_ContourWatcher, SIGNAL(finished()), this, SLOT(contouringFinished()));
+  setParentFilter(parent);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSContourFilter::VSContourFilter(const VSContourFilter& copy)
+: VSAbstractFilter()
+, m_ContourWatcher(this)
+, m_LastArrayName(copy.m_LastArrayName)
+, m_LastValues(copy.m_LastValues)
+{
+  connect(&m_ContourWatcher, SIGNAL(finished()), this, SLOT(contouringFinished()));
+  setParentFilter(copy.getParentFilter());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSContourFilter::~VSContourFilter()
+{
+  // The contouring thread writes to this filter's output
+  m_ContourWatcher.waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSContourFilter* VSContourFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
+{
+  VSContourFilter* filter = new VSContourFilter(parent);
+
+  filter->readJson(json);
+
+  filter->setInitialized(true);
+  filter->readTransformJson(json);
+
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::createFilter()
+{
+  m_OutputProducer = VTK_PTR(vtkTrivialProducer)::New();
+  m_OutputProducer->SetOutput(VTK_PTR(vtkPolyData)::New());
+  setConnectedInput(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSContourFilter::getFilterName() const
+{
+  return "Contour";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSContourFilter::getToolTip() const
+{
+  return "Contour Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::FilterType VSContourFilter::getFilterType() const
+{
+  return FilterType::Filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::apply(QString arrayName, QVector<double> values)
+{
+  if(nullptr == m_OutputProducer)
+  {
+    createFilter();
+  }
+
+  // Save the applied values for resetting Contour-Type widgets
+  m_LastArrayName = arrayName;
+  m_LastValues = values;
+
+  requestOutputUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::executeOutput()
+{
+  if(nullptr == m_OutputProducer)
+  {
+    return;
+  }
+
+  if(isContouring())
+  {
+    m_ContourPending = true;
+    return;
+  }
+
+  startContouring();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSContourFilter::isContouring() const
+{
+  return m_ContourWatcher.isRunning();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::startContouring()
+{
+  vtkImageData* input = vtkImageData::SafeDownCast(getParentFilter()->getOutput());
+  if(nullptr == input)
+  {
+    return;
+  }
+
+  // Cell arrays take priority over point arrays with the same name
+  int association = vtkDataObject::FIELD_ASSOCIATION_CELLS;
+  if(nullptr == input->GetCellData()->GetArray(qPrintable(m_LastArrayName)))
+  {
+    association = vtkDataObject::FIELD_ASSOCIATION_POINTS;
+  }
+
+  // The thread contours its own shallow copy so the parent's output can keep changing
+  VTK_PTR(vtkImageData) image = VTK_PTR(vtkImageData)::New();
+  image->ShallowCopy(input);
+
+  QByteArray key = IsOutputStoreActive() ? getOutputKey() : QByteArray();
+  m_ContourWatcher.setFuture(QtConcurrent::run(this, &VSContourFilter::generateContours, image, key, m_LastArrayName, association, m_LastValues));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::generateContours(VTK_PTR(vtkImageData) image, QByteArray key, QString arrayName, int association, QVector<double> values)
+{
+  // Contours stored for the same input and values are decoded here instead of contouring again
+  m_ContourStored = false;
+  VTK_PTR(vtkPolyData) storedOutput = vtkPolyData::SafeDownCast(FindCachedOutput(key));
+  if(storedOutput)
+  {
+    m_ContourOutput = storedOutput;
+    m_ContourStored = true;
+    return;
+  }
+
+  std::vector<double> contourValues(values.begin(), values.end());
+
+  VTK_NEW(VSImageContourFilter, contourFilter);
+  contourFilter->SetInputData(image);
+  contourFilter->SetInputArrayToProcess(0, 0, 0, association, qPrintable(arrayName));
+  contourFilter->SetValues(contourValues);
+  contourFilter->Update();
+
+  VTK_PTR(vtkPolyData) output = VTK_PTR(vtkPolyData)::New();
+  output->ShallowCopy(contourFilter->GetOutput());
+  m_ContourOutput = output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::contouringFinished()
+{
+  // Values applied while contouring replace the finished contours
+  if(m_ContourPending)
+  {
+    m_ContourPending = false;
+    startContouring();
+    return;
+  }
+
+  if(m_ContourOutput)
+  {
+    m_OutputProducer->SetOutput(m_ContourOutput);
+    m_ContourOutput = nullptr;
+    if(false == m_ContourStored)
+    {
+      storeCachedOutput();
+    }
+  }
+
+  emit updatedOutputPort(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::readJson(QJsonObject& json)
+{
+  m_LastArrayName = json["Last Array Name"].toString();
+
+  m_LastValues.clear();
+  QJsonArray valuesArray = json["Last Values"].toArray();
+  for(QJsonValue value : valuesArray)
+  {
+    m_LastValues.push_back(value.toDouble());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::writeJson(QJsonObject& json)
+{
+  VSAbstractFilter::writeJson(json);
+
+  QJsonArray valuesArray;
+  for(double value : m_LastValues)
+  {
+    valuesArray.append(value);
+  }
+
+  json["Last Array Name"] = m_LastArrayName;
+  json["Last Values"] = valuesArray;
+  json["Uuid"] = GetUuid().toString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSContourFilter::getOutputPort()
+{
+  if(getConnectedInput() && m_OutputProducer)
+  {
+    return m_OutputProducer->GetOutputPort();
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutputPort();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSContourFilter::getOutput() const
+{
+  updateDirtyOutput();
+
+  if(getConnectedInput() && m_OutputProducer)
+  {
+    return vtkDataSet::SafeDownCast(m_OutputProducer->GetOutputDataObject(0));
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutput();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::updateAlgorithmInput(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  setInputPort(filter->getOutputPort());
+
+  if(getConnectedInput() && m_OutputProducer)
+  {
+    apply(m_LastArrayName, m_LastValues);
+  }
+  else
+  {
+    emit updatedOutputPort(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSContourFilter::canCacheOutput() const
+{
+  return getConnectedInput() && m_OutputProducer && false == isContouring();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid VSContourFilter::GetUuid()
+{
+  return QUuid("{80369e74-5cdd-4c00-9784-6f12fe922c2e}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSContourFilter::getOutputType() const
+{
+  return POLY_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSContourFilter::getRequiredInputType()
+{
+  return IMAGE_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSContourFilter::compatibleWithParent(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return false;
+  }
+
+  if(false == compatibleInput(filter->getOutputType(), getRequiredInputType()))
+  {
+    return false;
+  }
+
+  // Require a scalar array
+  vtkDataSet* output = filter->getOutput();
+  if(nullptr == output)
+  {
+    return false;
+  }
+
+  vtkFieldData* attributes[2] = {output->GetCellData(), output->GetPointData()};
+  for(vtkFieldData* fieldData : attributes)
+  {
+    int numArrays = fieldData ? fieldData->GetNumberOfArrays() : 0;
+    for(int i = 0; i < numArrays; i++)
+    {
+      if(isContourArray(fieldData->GetArray(i)))
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSContourFilter::isContourArray(vtkDataArray* array)
+{
+  return array && array->GetNumberOfComponents() == 1 && array->GetDataType() != VTK_BIT;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSContourFilter::getLastArrayName()
+{
+  return m_LastArrayName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::setLastArrayName(QString lastArrayName)
+{
+  m_LastArrayName = lastArrayName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<double> VSContourFilter::getLastValues()
+{
+  return m_LastValues;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSContourFilter::setLastValues(QVector<double> lastValues)
+{
+  m_LastValues = lastValues;
+}
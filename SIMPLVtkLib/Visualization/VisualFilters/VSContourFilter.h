@@ -0,0 +1,256 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QVector>
+#include <QtWidgets/QWidget>
+
+#include <vtkImageData.h>
+#include <vtkPolyData.h>
+#include <vtkTrivialProducer.h>
+
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSContourFilter VSContourFilter.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSContourFilter.h
+ * @brief This class generates isosurfaces of a single component cell or point
+ * array on vtkImageData for one or more iso-values.  Contours are generated on
+ * a separate thread and the output port is updated once they are finished.
+ */
+class SIMPLVtkLib_EXPORT VSContourFilter : public VSAbstractFilter
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSContourFilter(VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Copy constructor
+   * @param copy
+   */
+  VSContourFilter(const VSContourFilter& copy);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSContourFilter();
+
+  /**
+   * @brief Create
+   * @param json
+   * @param parent
+   * @return
+   */
+  static VSContourFilter* Create(QJsonObject& json, VSAbstractFilter* parent);
+
+  /**
+   * Brief Returns the filter name
+   * @return
+   */
+  QString getFilterName() const override;
+
+  /**
+   * @brief Convenience method for determining what the filter does
+   * @return
+   */
+  FilterType getFilterType() const override;
+
+  /**
+   * @brief Returns the tooltip to use for the filter
+   * @return
+   */
+  virtual QString getToolTip() const override;
+
+  /**
+   * @brief Generates isosurfaces of the specified array for the given values.  If
+   * contours are already being generated, the new values are applied once they finish.
+   * @param arrayName
+   * @param values
+   */
+  void apply(QString arrayName, QVector<double> values);
+
+  /**
+   * @brief Returns true while contours are being generated
+   * @return
+   */
+  bool isContouring() const;
+
+  /**
+   * @brief Returns the output port to be used by vtkMappers and subsequent filters
+   * @return
+   */
+  virtual vtkAlgorithmOutput* getOutputPort() override;
+
+  /**
+   * @brief Returns a smart pointer containing the output data from the filter
+   * @return
+   */
+  virtual VTK_PTR(vtkDataSet) getOutput() const override;
+
+  /**
+   * @brief Returns the output data type
+   * @return
+   */
+  dataType_t getOutputType() const override;
+
+  /**
+   * @brief Returns the required input data type
+   * @return
+   */
+  static dataType_t getRequiredInputType();
+
+  /**
+   * @brief Returns true if this filter type can be added as a child of
+   * the given filter.  Returns false otherwise.
+   * @param
+   * @return
+   */
+  static bool compatibleWithParent(VSAbstractFilter* filter);
+
+  /**
+   * @brief Returns true if isosurfaces can be generated for the array
+   * @param array
+   * @return
+   */
+  static bool isContourArray(vtkDataArray* array);
+
+  /**
+   * @brief Returns the name of the array last contoured
+   * @return
+   */
+  QString getLastArrayName();
+
+  /**
+   * @brief Sets the name of the array last contoured
+   * @param lastArrayName
+   */
+  void setLastArrayName(QString lastArrayName);
+
+  /**
+   * @brief Returns the iso-values last applied
+   * @return
+   */
+  QVector<double> getLastValues();
+
+  /**
+   * @brief Sets the iso-values last applied
+   * @param lastValues
+   */
+  void setLastValues(QVector<double> lastValues);
+
+  /**
+   * @brief Reads values from a json file into the filter
+   * @param json
+   */
+  void readJson(QJsonObject& json);
+
+  /**
+   * @brief Writes values to a json file from the filter
+   * @param json
+   */
+  void writeJson(QJsonObject& json) override;
+
+  /**
+   * @brief Returns true if the filter has applied its own output
+   * @return
+   */
+  bool canCacheOutput() const override;
+
+  /**
+   * @brief getUuid
+   * @return
+   */
+  static QUuid GetUuid();
+
+protected slots:
+  /**
+   * @brief This slot is called when contours are finished being generated on a separate thread
+   */
+  void contouringFinished();
+
+protected:
+  /**
+   * @brief Initializes the trivial producer and connects it to the vtkMapper
+   */
+  void createFilter() override;
+
+  /**
+   * @brief This method updates the input port and connects it to the vtkAlgorithm if it exists
+   * @param filter
+   */
+  void updateAlgorithmInput(VSAbstractFilter* filter) override;
+
+  /**
+   * @brief Starts contouring the applied values on a background thread
+   */
+  void executeOutput() override;
+
+  /**
+   * @brief Starts generating contours of the parent's output for the last applied values
+   */
+  void startContouring();
+
+  /**
+   * @brief Generates contours of the image array unless contours are stored under the key.
+   * This method is run on a separate thread.
+   * @param image
+   * @param key
+   * @param arrayName
+   * @param association
+   * @param values
+   */
+  void generateContours(VTK_PTR(vtkImageData) image, QByteArray key, QString arrayName, int association, QVector<double> values);
+
+private:
+  VTK_PTR(vtkTrivialProducer) m_OutputProducer = nullptr;
+  VTK_PTR(vtkPolyData) m_ContourOutput = nullptr;
+  bool m_ContourStored = false;
+  QFutureWatcher<void> m_ContourWatcher;
+  bool m_ContourPending = false;
+
+  QString m_LastArrayName;
+  QVector<double> m_LastValues;
+};
+
+Q_DECLARE_METATYPE(VSContourFilter)
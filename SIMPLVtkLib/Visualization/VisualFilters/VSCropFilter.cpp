@@ -41,7 +41,6 @@
 #include <QtCore/QUuid>
 
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
-#include <vtkExtractVOI.h>
 
 #include <vtkRenderWindowInteractor.h>
 
@@ -114,8 +113,7 @@ VSCropFilter* VSCropFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
 // -----------------------------------------------------------------------------
 void VSCropFilter::createFilter()
 {
-  m_CropAlgorithm = vtkSmartPointer<vtkExtractVOI>::New();
-  m_CropAlgorithm->IncludeBoundaryOn();
+  m_CropAlgorithm = vtkSmartPointer<VSImageExtentFilter>::New();
   m_CropAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
 
   setConnectedInput(true);
@@ -132,10 +130,6 @@ void VSCropFilter::apply(int voi[6], int sampleRate[3])
   }
 
   // Save the applied values for resetting Crop-Type widgets
-  m_CropAlgorithm->SetVOI(voi);
-  m_CropAlgorithm->SetSampleRate(sampleRate);
-  m_CropAlgorithm->Update();
-
   for(int i = 0; i < 6; i++)
   {
     m_LastVoi[i] = voi[i];
@@ -146,6 +140,10 @@ void VSCropFilter::apply(int voi[6], int sampleRate[3])
     m_LastSampleRate[i] = sampleRate[i];
   }
 
+  m_CropAlgorithm->SetVOI(voi);
+  m_CropAlgorithm->SetSampleRate(sampleRate);
+  requestOutputUpdate();
+
   emit updatedOutputPort(this);
   emit voiChanged();
   emit sampleRateChanged();
@@ -240,7 +238,11 @@ VSAbstractFilter::FilterType VSCropFilter::getFilterType() const
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSCropFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_CropAlgorithm)
+  if(hasCachedOutput())
+  {
+    return getCachedOutputPort();
+  }
+  else if(getConnectedInput() && m_CropAlgorithm)
   {
     return m_CropAlgorithm->GetOutputPort();
   }
@@ -257,7 +259,13 @@ vtkAlgorithmOutput* VSCropFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSCropFilter::getOutput() const
 {
-  if(getConnectedInput() && m_CropAlgorithm)
+  updateDirtyOutput();
+
+  if(hasCachedOutput())
+  {
+    return getCachedOutput();
+  }
+  else if(getConnectedInput() && m_CropAlgorithm)
   {
     return m_CropAlgorithm->GetOutput();
   }
@@ -284,6 +292,12 @@ void VSCropFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   if(getConnectedInput() && m_CropAlgorithm)
   {
     m_CropAlgorithm->SetInputConnection(filter->getOutputPort());
+
+    // Children reconnect to the algorithm once the stored output no longer matches the input
+    if(releaseStaleCachedOutput())
+    {
+      emit updatedOutputPort(this);
+    }
   }
   else
   {
@@ -291,6 +305,28 @@ void VSCropFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSCropFilter::executeOutput()
+{
+  if(nullptr == m_CropAlgorithm)
+  {
+    return;
+  }
+
+  m_CropAlgorithm->Update();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSCropFilter::canCacheOutput() const
+{
+  // Cropped arrays view the parent's arrays, so regenerating them is cheaper than storing them
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -40,9 +40,10 @@
 #include "VSAbstractFilter.h"
 
 #include <vtkBox.h>
-#include <vtkExtractVOI.h>
 #include <vtkImageData.h>
 
+#include "SIMPLVtkLib/SIMPLBridge/VSImageExtentFilter.h"
+
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
 /**
@@ -52,7 +53,8 @@
  * and Z bounds. This class can be chained with other VSAbstractFilters to
  * further specify the data allowed to be visualized. This filter requires
  * the incoming data type to be a vtkImageData, thus restricting it to following
- * VSSIMPLDataContainerFilters.
+ * VSSIMPLDataContainerFilters.  Cropped arrays view the parent's arrays instead of
+ * copying them.
  */
 class SIMPLVtkLib_EXPORT VSCropFilter : public VSAbstractFilter
 {
@@ -192,6 +194,12 @@ public:
    */
   void writeJson(QJsonObject& json) override;
 
+  /**
+   * @brief Returns false because cropped outputs are views of the parent's arrays
+   * @return
+   */
+  bool canCacheOutput() const override;
+
   /**
    * @brief getUuid
    * @return
@@ -214,8 +222,13 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Updates the algorithm
+   */
+  void executeOutput() override;
+
 private:
-  VTK_PTR(vtkExtractVOI) m_CropAlgorithm;
+  VTK_PTR(VSImageExtentFilter) m_CropAlgorithm;
 
   int m_LastVoi[6];
   int m_LastSampleRate[3];
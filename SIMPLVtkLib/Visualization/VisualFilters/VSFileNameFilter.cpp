@@ -138,6 +138,79 @@ QString VSFileNameFilter::getFileName()
   return fi.fileName();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFileNameFilter::setImageRegion(const VSImageRegion& region)
+{
+  m_ImageRegion = region;
+  m_HasImageRegion = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegion VSFileNameFilter::getImageRegion() const
+{
+  return m_ImageRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFileNameFilter::hasImageRegion() const
+{
+  return m_HasImageRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFileNameFilter::setImageRefinement(const QString& dcName, const VSImageRefinement& refinement)
+{
+  m_ImageRefinements[dcName] = refinement;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFileNameFilter::hasImageRefinement(const QString& dcName) const
+{
+  return m_ImageRefinements.contains(dcName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRefinement VSFileNameFilter::takeImageRefinement(const QString& dcName)
+{
+  return m_ImageRefinements.take(dcName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSFileNameFilter::setSliceArrays(const QString& dcName, const QList<VSImageArrayInfo>& arrays)
+{
+  m_SliceArrays[dcName] = arrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSFileNameFilter::hasSliceArrays(const QString& dcName) const
+{
+  return m_SliceArrays.contains(dcName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<VSImageArrayInfo> VSFileNameFilter::takeSliceArrays(const QString& dcName)
+{
+  return m_SliceArrays.take(dcName);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -35,6 +35,7 @@
 
 #pragma once
 
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSTextFilter.h"
 
 /**
@@ -87,6 +88,67 @@ public:
    */
   QString getFileName();
 
+  /**
+   * @brief Sets the region of interest that ImageGeom DataContainers were imported with
+   * @param region
+   */
+  void setImageRegion(const VSImageRegion& region);
+
+  /**
+   * @brief Returns the region of interest that ImageGeom DataContainers were imported with
+   * @return
+   */
+  VSImageRegion getImageRegion() const;
+
+  /**
+   * @brief Returns true if ImageGeom DataContainers were imported with a region of interest
+   * @return
+   */
+  bool hasImageRegion() const;
+
+  /**
+   * @brief Sets the levels still to be read for an ImageGeom DataContainer imported progressively
+   * @param dcName
+   * @param refinement
+   */
+  void setImageRefinement(const QString& dcName, const VSImageRefinement& refinement);
+
+  /**
+   * @brief Returns true if the named DataContainer is waiting for its refinement to be taken
+   * @param dcName
+   * @return
+   */
+  bool hasImageRefinement(const QString& dcName) const;
+
+  /**
+   * @brief Returns and removes the refinement levels for the named DataContainer
+   * @param dcName
+   * @return
+   */
+  VSImageRefinement takeImageRefinement(const QString& dcName);
+
+  /**
+   * @brief Sets the cell arrays of an ImageGeom DataContainer imported in slice-only mode.
+   * The arrays are read from file one slab at a time instead of being kept in memory.
+   * @param dcName
+   * @param arrays
+   */
+  void setSliceArrays(const QString& dcName, const QList<VSImageArrayInfo>& arrays);
+
+  /**
+   * @brief Returns true if the named DataContainer is waiting for its slice arrays to be taken
+   * @param dcName
+   * @return
+   */
+  bool hasSliceArrays(const QString& dcName) const;
+
+  /**
+   * @brief Returns and removes the slice arrays for the named DataContainer
+   * @param dcName
+   * @return
+   */
+  QList<VSImageArrayInfo> takeSliceArrays(const QString& dcName);
+
   /**
    * @brief Returns the filter's name
    * @return
@@ -115,4 +177,8 @@ public:
 
 private:
   QString m_FilePath;
+  VSImageRegion m_ImageRegion;
+  bool m_HasImageRegion = false;
+  QMap<QString, VSImageRefinement> m_ImageRefinements;
+  QMap<QString, QList<VSImageArrayInfo>> m_SliceArrays;
 };
@@ -0,0 +1,404 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "VSGrainBoundaryFilter.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QString>
+#include <QtCore/QUuid>
+
+#include <vtkCellData.h>
+#include <vtkDataArray.h>
+#include <vtkImageData.h>
+#include <vtkPolyData.h>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSGrainBoundaryFilter::VSGrainBoundaryFilter(VSAbstractFilter* parent)
+: VSAbstractFilter()
+{
+  m_BoundaryAlgorithm = nullptr;
+  setParentFilter(parent);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSGrainBoundaryFilter::VSGrainBoundaryFilter(const VSGrainBoundaryFilter& copy)
+: VSAbstractFilter()
+, m_LastArrayName(copy.m_LastArrayName)
+, m_LastIncludeExterior(copy.m_LastIncludeExterior)
+, m_LastHighlightedPairs(copy.m_LastHighlightedPairs)
+{
+  m_BoundaryAlgorithm = nullptr;
+  setParentFilter(copy.getParentFilter());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSGrainBoundaryFilter* VSGrainBoundaryFilter::Create(QJsonObject& json, VSAbstractFilter* parent)
+{
+  VSGrainBoundaryFilter* filter = new VSGrainBoundaryFilter(parent);
+
+  filter->readJson(json);
+
+  filter->setInitialized(true);
+  filter->readTransformJson(json);
+
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::createFilter()
+{
+  m_BoundaryAlgorithm = VTK_PTR(VSFeatureBoundaryFilter)::New();
+  m_BoundaryAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+  setConnectedInput(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSGrainBoundaryFilter::getFilterName() const
+{
+  return "Grain Boundary";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSGrainBoundaryFilter::getToolTip() const
+{
+  return "Grain Boundary Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::FilterType VSGrainBoundaryFilter::getFilterType() const
+{
+  return FilterType::Filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::apply(QString arrayName, bool includeExterior, FeaturePairs highlightedPairs)
+{
+  if(nullptr == m_BoundaryAlgorithm)
+  {
+    createFilter();
+  }
+
+  // Save the applied values for resetting Grain Boundary-Type widgets
+  m_LastArrayName = arrayName;
+  m_LastIncludeExterior = includeExterior;
+  m_LastHighlightedPairs = highlightedPairs;
+
+  std::vector<VSFeatureBoundaryFilter::FeaturePair> pairs;
+  for(const FeaturePair& pair : highlightedPairs)
+  {
+    pairs.push_back(std::make_pair(pair.first, pair.second));
+  }
+
+  // The boundary faces are cached so only changing the highlighted pairs does not extract them again
+  m_BoundaryAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(arrayName));
+  m_BoundaryAlgorithm->SetIncludeExterior(includeExterior);
+  m_BoundaryAlgorithm->SetHighlightedPairs(pairs);
+  requestOutputUpdate();
+
+  emit updatedOutputPort(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::readJson(QJsonObject& json)
+{
+  m_LastArrayName = json["Last Array Name"].toString();
+  m_LastIncludeExterior = json["Include Exterior"].toBool();
+
+  m_LastHighlightedPairs.clear();
+  QJsonArray pairsArray = json["Highlighted Pairs"].toArray();
+  for(QJsonValue pairValue : pairsArray)
+  {
+    QJsonArray pairArray = pairValue.toArray();
+    if(pairArray.size() == 2)
+    {
+      m_LastHighlightedPairs.push_back(FeaturePair(static_cast<qint64>(pairArray[0].toDouble()), static_cast<qint64>(pairArray[1].toDouble())));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::writeJson(QJsonObject& json)
+{
+  VSAbstractFilter::writeJson(json);
+
+  QJsonArray pairsArray;
+  for(const FeaturePair& pair : m_LastHighlightedPairs)
+  {
+    QJsonArray pairArray;
+    pairArray.append(static_cast<double>(pair.first));
+    pairArray.append(static_cast<double>(pair.second));
+    pairsArray.append(pairArray);
+  }
+
+  json["Last Array Name"] = m_LastArrayName;
+  json["Include Exterior"] = m_LastIncludeExterior;
+  json["Highlighted Pairs"] = pairsArray;
+  json["Uuid"] = GetUuid().toString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+vtkAlgorithmOutput* VSGrainBoundaryFilter::getOutputPort()
+{
+  if(hasCachedOutput())
+  {
+    return getCachedOutputPort();
+  }
+  else if(getConnectedInput() && m_BoundaryAlgorithm)
+  {
+    return m_BoundaryAlgorithm->GetOutputPort();
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutputPort();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VTK_PTR(vtkDataSet) VSGrainBoundaryFilter::getOutput() const
+{
+  updateDirtyOutput();
+
+  if(hasCachedOutput())
+  {
+    return getCachedOutput();
+  }
+  else if(getConnectedInput() && m_BoundaryAlgorithm)
+  {
+    return m_BoundaryAlgorithm->GetOutput();
+  }
+  else if(getParentFilter())
+  {
+    return getParentFilter()->getOutput();
+  }
+
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::updateAlgorithmInput(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return;
+  }
+
+  setInputPort(filter->getOutputPort());
+
+  if(getConnectedInput() && m_BoundaryAlgorithm)
+  {
+    m_BoundaryAlgorithm->SetInputConnection(filter->getOutputPort());
+
+    // Children reconnect to the algorithm once the stored output no longer matches the input
+    if(releaseStaleCachedOutput())
+    {
+      emit updatedOutputPort(this);
+    }
+  }
+  else
+  {
+    emit updatedOutputPort(filter);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::executeOutput()
+{
+  if(nullptr == m_BoundaryAlgorithm)
+  {
+    return;
+  }
+
+  if(false == restoreCachedOutput())
+  {
+    m_BoundaryAlgorithm->Update();
+    storeCachedOutput();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSGrainBoundaryFilter::canCacheOutput() const
+{
+  return getConnectedInput() && m_BoundaryAlgorithm;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid VSGrainBoundaryFilter::GetUuid()
+{
+  return QUuid("{aaf7be88-9129-4a3e-a937-9ccdf823da8b}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSGrainBoundaryFilter::getOutputType() const
+{
+  return POLY_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSAbstractFilter::dataType_t VSGrainBoundaryFilter::getRequiredInputType()
+{
+  return IMAGE_DATA;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSGrainBoundaryFilter::compatibleWithParent(VSAbstractFilter* filter)
+{
+  if(nullptr == filter)
+  {
+    return false;
+  }
+
+  if(false == compatibleInput(filter->getOutputType(), getRequiredInputType()))
+  {
+    return false;
+  }
+
+  // Require a feature ID array
+  vtkDataSet* output = filter->getOutput();
+  if(output && output->GetCellData())
+  {
+    int numArrays = output->GetCellData()->GetNumberOfArrays();
+    for(int i = 0; i < numArrays; i++)
+    {
+      if(isFeatureIdArray(output->GetCellData()->GetArray(i)))
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSGrainBoundaryFilter::isFeatureIdArray(vtkDataArray* array)
+{
+  if(nullptr == array || array->GetNumberOfComponents() != 1)
+  {
+    return false;
+  }
+
+  int dataType = array->GetDataType();
+  return dataType != VTK_FLOAT && dataType != VTK_DOUBLE && dataType != VTK_BIT;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSGrainBoundaryFilter::getLastArrayName()
+{
+  return m_LastArrayName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::setLastArrayName(QString lastArrayName)
+{
+  m_LastArrayName = lastArrayName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSGrainBoundaryFilter::getLastIncludeExterior()
+{
+  return m_LastIncludeExterior;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::setLastIncludeExterior(bool includeExterior)
+{
+  m_LastIncludeExterior = includeExterior;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSGrainBoundaryFilter::FeaturePairs VSGrainBoundaryFilter::getLastHighlightedPairs()
+{
+  return m_LastHighlightedPairs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSGrainBoundaryFilter::setLastHighlightedPairs(FeaturePairs highlightedPairs)
+{
+  m_LastHighlightedPairs = highlightedPairs;
+}
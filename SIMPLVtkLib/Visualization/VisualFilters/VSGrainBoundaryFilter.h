@@ -0,0 +1,240 @@
+/* ============================================================================
+ * Copyright (c) 2009-2017 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QPair>
+#include <QtCore/QVector>
+#include <QtWidgets/QWidget>
+
+#include "SIMPLVtkLib/SIMPLBridge/VSFeatureBoundaryFilter.h"
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractFilter.h"
+
+#include "SIMPLVtkLib/SIMPLVtkLib.h"
+
+/**
+ * @class VSGrainBoundaryFilter VSGrainBoundaryFilter.h
+ * SIMPLVtkLib/Visualization/VisualFilters/VSGrainBoundaryFilter.h
+ * @brief This class extracts the grain boundaries of an image by generating the
+ * voxel faces between cells with different values in an integer feature ID array.
+ * Each face stores the pair of feature IDs it separates, and faces between selected
+ * feature pairs can be highlighted without extracting the boundaries again.
+ */
+class SIMPLVtkLib_EXPORT VSGrainBoundaryFilter : public VSAbstractFilter
+{
+  Q_OBJECT
+
+public:
+  using FeaturePair = QPair<qint64, qint64>;
+  using FeaturePairs = QVector<FeaturePair>;
+
+  /**
+   * @brief Constructor
+   * @param parent
+   */
+  VSGrainBoundaryFilter(VSAbstractFilter* parent = nullptr);
+
+  /**
+   * @brief Copy constructor
+   * @param copy
+   */
+  VSGrainBoundaryFilter(const VSGrainBoundaryFilter& copy);
+
+  /**
+   * @brief Deconstructor
+   */
+  virtual ~VSGrainBoundaryFilter() = default;
+
+  /**
+   * @brief Create
+   * @param json
+   * @param parent
+   * @return
+   */
+  static VSGrainBoundaryFilter* Create(QJsonObject& json, VSAbstractFilter* parent);
+
+  /**
+   * Brief Returns the filter name
+   * @return
+   */
+  QString getFilterName() const override;
+
+  /**
+   * @brief Convenience method for determining what the filter does
+   * @return
+   */
+  FilterType getFilterType() const override;
+
+  /**
+   * @brief Returns the tooltip to use for the filter
+   * @return
+   */
+  virtual QString getToolTip() const override;
+
+  /**
+   * @brief Extracts the boundaries between features in the specified array and
+   * highlights the faces between the given feature pairs.  A pair with the same
+   * ID twice highlights every boundary of that feature.
+   * @param arrayName
+   * @param includeExterior
+   * @param highlightedPairs
+   */
+  void apply(QString arrayName, bool includeExterior, FeaturePairs highlightedPairs);
+
+  /**
+   * @brief Returns the output port to be used by vtkMappers and subsequent filters
+   * @return
+   */
+  virtual vtkAlgorithmOutput* getOutputPort() override;
+
+  /**
+   * @brief Returns a smart pointer containing the output data from the filter
+   * @return
+   */
+  virtual VTK_PTR(vtkDataSet) getOutput() const override;
+
+  /**
+   * @brief Returns the output data type
+   * @return
+   */
+  dataType_t getOutputType() const override;
+
+  /**
+   * @brief Returns the required input data type
+   * @return
+   */
+  static dataType_t getRequiredInputType();
+
+  /**
+   * @brief Returns true if this filter type can be added as a child of
+   * the given filter.  Returns false otherwise.
+   * @param
+   * @return
+   */
+  static bool compatibleWithParent(VSAbstractFilter* filter);
+
+  /**
+   * @brief Returns true if the array can be used as feature IDs
+   * @param array
+   * @return
+   */
+  static bool isFeatureIdArray(vtkDataArray* array);
+
+  /**
+   * @brief Returns the name of the feature ID array last applied
+   * @return
+   */
+  QString getLastArrayName();
+
+  /**
+   * @brief Sets the name of the feature ID array last applied
+   * @param lastArrayName
+   */
+  void setLastArrayName(QString lastArrayName);
+
+  /**
+   * @brief Returns true if the exterior faces were last included
+   * @return
+   */
+  bool getLastIncludeExterior();
+
+  /**
+   * @brief Sets whether the exterior faces were last included
+   * @param includeExterior
+   */
+  void setLastIncludeExterior(bool includeExterior);
+
+  /**
+   * @brief Returns the feature pairs last highlighted
+   * @return
+   */
+  FeaturePairs getLastHighlightedPairs();
+
+  /**
+   * @brief Sets the feature pairs last highlighted
+   * @param highlightedPairs
+   */
+  void setLastHighlightedPairs(FeaturePairs highlightedPairs);
+
+  /**
+   * @brief Reads values from a json file into the filter
+   * @param json
+   */
+  void readJson(QJsonObject& json);
+
+  /**
+   * @brief Writes values to a json file from the filter
+   * @param json
+   */
+  void writeJson(QJsonObject& json) override;
+
+  /**
+   * @brief Returns true if the filter has applied its own output
+   * @return
+   */
+  bool canCacheOutput() const override;
+
+  /**
+   * @brief getUuid
+   * @return
+   */
+  static QUuid GetUuid();
+
+protected:
+  /**
+   * @brief Initializes the algorithm and connects it to the vtkMapper
+   */
+  void createFilter() override;
+
+  /**
+   * @brief This method updates the input port and connects it to the vtkAlgorithm if it exists
+   * @param filter
+   */
+  void updateAlgorithmInput(VSAbstractFilter* filter) override;
+
+  /**
+   * @brief Updates the algorithm unless a stored output matches the applied values
+   */
+  void executeOutput() override;
+
+private:
+  VTK_PTR(VSFeatureBoundaryFilter) m_BoundaryAlgorithm;
+
+  QString m_LastArrayName;
+  bool m_LastIncludeExterior = false;
+  FeaturePairs m_LastHighlightedPairs;
+};
+
+Q_DECLARE_METATYPE(VSGrainBoundaryFilter)
@@ -127,7 +127,7 @@ void VSMaskFilter::apply(QString name)
 
   m_MaskAlgorithm->ThresholdByUpper(1.0);
   m_MaskAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(name));
-  m_MaskAlgorithm->Update();
+  requestOutputUpdate();
 
   emit updatedOutputPort(this);
 }
@@ -156,7 +156,11 @@ void VSMaskFilter::writeJson(QJsonObject& json)
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSMaskFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_MaskAlgorithm)
+  if(hasCachedOutput())
+  {
+    return getCachedOutputPort();
+  }
+  else if(getConnectedInput() && m_MaskAlgorithm)
   {
     return m_MaskAlgorithm->GetOutputPort();
   }
@@ -173,7 +177,13 @@ vtkAlgorithmOutput* VSMaskFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSMaskFilter::getOutput() const
 {
-  if(getConnectedInput() && m_MaskAlgorithm)
+  updateDirtyOutput();
+
+  if(hasCachedOutput())
+  {
+    return getCachedOutput();
+  }
+  else if(getConnectedInput() && m_MaskAlgorithm)
   {
     return m_MaskAlgorithm->GetOutput();
   }
@@ -200,6 +210,12 @@ void VSMaskFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   if(getConnectedInput() && m_MaskAlgorithm)
   {
     m_MaskAlgorithm->SetInputConnection(filter->getOutputPort());
+
+    // Children reconnect to the algorithm once the stored output no longer matches the input
+    if(releaseStaleCachedOutput())
+    {
+      emit updatedOutputPort(this);
+    }
   }
   else
   {
@@ -207,6 +223,31 @@ void VSMaskFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSMaskFilter::executeOutput()
+{
+  if(nullptr == m_MaskAlgorithm)
+  {
+    return;
+  }
+
+  if(false == restoreCachedOutput())
+  {
+    m_MaskAlgorithm->Update();
+    storeCachedOutput();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSMaskFilter::canCacheOutput() const
+{
+  return getConnectedInput() && m_MaskAlgorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
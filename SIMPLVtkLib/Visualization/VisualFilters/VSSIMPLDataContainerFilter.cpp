@@ -36,8 +36,13 @@
 #include "VSSIMPLDataContainerFilter.h"
 
 #include <QtConcurrent>
+#include <QtCore/QJsonArray>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QUuid>
 
+#include <algorithm>
+#include <cmath>
+
 #include <vtkAlgorithmOutput.h>
 #include <vtkCellData.h>
 #include <vtkDataArray.h>
@@ -52,6 +57,41 @@
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSFileNameFilter.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSPipelineFilter.h"
 
+namespace
+{
+/**
+ * @brief Returns a copy of the proxy with only the arrays that are already in the DataContainer checked
+ * @param proxy
+ * @param dc
+ * @return
+ */
+DataContainerArrayProxy LoadedArrayProxy(DataContainerArrayProxy proxy, DataContainer::Pointer dc)
+{
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = proxy.dataContainers.begin(); dcIter != proxy.dataContainers.end(); dcIter++)
+  {
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcIter.value().attributeMatricies.begin(); amIter != dcIter.value().attributeMatricies.end(); amIter++)
+    {
+      AttributeMatrixProxy& amProxy = amIter.value();
+      if(amProxy.amType != AttributeMatrix::Type::Cell)
+      {
+        continue;
+      }
+
+      AttributeMatrix::Pointer am = dc ? dc->getAttributeMatrix(amProxy.name) : nullptr;
+      for(QMap<QString, DataArrayProxy>::iterator daIter = amProxy.dataArrays.begin(); daIter != amProxy.dataArrays.end(); daIter++)
+      {
+        if(nullptr == am || false == am->doesAttributeArrayExist(daIter.key()))
+        {
+          daIter.value().flag = Qt::Unchecked;
+        }
+      }
+    }
+  }
+
+  return proxy;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -61,6 +101,30 @@ VSSIMPLDataContainerFilter::VSSIMPLDataContainerFilter(SIMPLVtkBridge::WrappedDa
 , m_WrappingWatcher(this)
 , m_ApplyLock(1)
 {
+  // ImageGeoms imported with a region of interest keep the region for reloading and expanding
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(parent);
+  if(fileFilter && fileFilter->hasImageRegion() && wrappedDataContainer && wrappedDataContainer->m_DataContainer &&
+     wrappedDataContainer->m_DataContainer->getGeometryAs<ImageGeom>())
+  {
+    m_ImageRegion = fileFilter->getImageRegion();
+    m_HasImageRegion = true;
+  }
+
+  // Progressively imported ImageGeoms start with a coarse level and read the finer levels once applied
+  if(fileFilter && wrappedDataContainer && fileFilter->hasImageRefinement(wrappedDataContainer->m_Name))
+  {
+    m_Refinement = fileFilter->takeImageRefinement(wrappedDataContainer->m_Name);
+    connect(this, &VSAbstractFilter::dataImported, this, &VSSIMPLDataContainerFilter::refineImageData, Qt::QueuedConnection);
+  }
+
+  // Slice-only ImageGeoms keep their geometry in memory and leave the cell arrays in the file
+  if(fileFilter && wrappedDataContainer && fileFilter->hasSliceArrays(wrappedDataContainer->m_Name))
+  {
+    m_SliceOnly = true;
+    m_SliceArrays = fileFilter->takeSliceArrays(wrappedDataContainer->m_Name);
+    m_ActiveSliceArray = m_SliceArrays.isEmpty() ? QString() : m_SliceArrays.front().m_Name;
+  }
+
   createFilter();
   setParentFilter(parent);
 
@@ -129,6 +193,7 @@ VSSIMPLDataContainerFilter* VSSIMPLDataContainerFilter::Create(const QString& fi
   QString dcName = json["Data Container Name"].toString();
 
   // Read in the data from the file and initialize the filter
+  QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
   SIMPLH5DataReader reader;
   bool success = reader.openFile(filePath);
   if(success)
@@ -162,15 +227,41 @@ VSSIMPLDataContainerFilter* VSSIMPLDataContainerFilter::Create(const QString& fi
           dcProxy.attributeMatricies[amProxy.name] = amProxy;
         }
 
+        bool sliceOnly = json["Slice Only"].toBool();
+        if(sliceOnly)
+        {
+          VSImageRegionReader::UncheckCellArrays(dcProxy);
+        }
+
         proxy.dataContainers[dcProxy.name] = dcProxy;
 
-        DataContainerArray::Pointer dca = reader.readSIMPLDataUsingProxy(proxy, false);
-        DataContainerShPtr dc = dca->getDataContainer(dcName);
+        DataContainerArray::Pointer dca = nullptr;
+        bool hasRegion = json.contains("Region of Interest") && false == sliceOnly;
+        VSImageRegion region = VSImageRegion::FromJson(json["Region of Interest"].toObject());
+        if(hasRegion)
+        {
+          QString errorMessage;
+          dca = VSImageRegionReader::ReadDataContainerArray(filePath, proxy, region, errorMessage);
+        }
+        else
+        {
+          dca = reader.readSIMPLDataUsingProxy(proxy, false);
+        }
+
+        DataContainerShPtr dc = dca ? dca->getDataContainer(dcName) : nullptr;
         if(dc)
         {
           SIMPLVtkBridge::WrappedDataContainerPtr wrappedDC = SIMPLVtkBridge::WrapDataContainerAsStruct(dc);
 
           VSSIMPLDataContainerFilter* newFilter = new VSSIMPLDataContainerFilter(wrappedDC, parent);
+          if(hasRegion)
+          {
+            newFilter->setImageRegion(region);
+          }
+          if(sliceOnly)
+          {
+            newFilter->readSliceJson(json);
+          }
           newFilter->setToolTip(json["Tooltip"].toString());
           newFilter->setInitialized(true);
           newFilter->readTransformJson(json);
@@ -183,6 +274,70 @@ VSSIMPLDataContainerFilter* VSSIMPLDataContainerFilter::Create(const QString& fi
   return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSIMPLDataContainerFilter* VSSIMPLDataContainerFilter::CreatePlaceholder(QJsonObject& json, VSAbstractFilter* parent)
+{
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDC(new SIMPLVtkBridge::WrappedDataContainer());
+  wrappedDC->m_Name = json["Data Container Name"].toString();
+  wrappedDC->m_DataSet = VTK_PTR(vtkImageData)::New();
+
+  VSSIMPLDataContainerFilter* newFilter = new VSSIMPLDataContainerFilter(wrappedDC, parent);
+  newFilter->m_Placeholder = true;
+  if(json["Slice Only"].toBool())
+  {
+    newFilter->readSliceJson(json);
+  }
+  else if(json.contains("Region of Interest"))
+  {
+    newFilter->setImageRegion(VSImageRegion::FromJson(json["Region of Interest"].toObject()));
+  }
+  newFilter->setToolTip(json["Tooltip"].toString());
+  newFilter->setInitialized(true);
+  newFilter->readTransformJson(json);
+  return newFilter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::isPlaceholder() const
+{
+  return m_Placeholder;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::setLoadedDataContainer(SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc)
+{
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  m_WrappedDataContainer = wrappedDc;
+  m_FullyWrapped = true;
+  m_Placeholder = false;
+  m_LoadError.clear();
+
+  reloadWrappingFinished();
+
+  emit arrayNamesChanged();
+  emit scalarNamesChanged();
+  emit dataImported();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::setLoadFailed(const QString& message)
+{
+  m_LoadError = message;
+  emit errorGenerated("Session Load Error", message, -3004);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -193,6 +348,39 @@ void VSSIMPLDataContainerFilter::writeJson(QJsonObject& json)
   json["Data Container Name"] = getText();
   json["Tooltip"] = getToolTip();
   json["Uuid"] = GetUuid().toString();
+  if(m_HasImageRegion)
+  {
+    json["Region of Interest"] = m_ImageRegion.toJson();
+  }
+  if(m_SliceOnly)
+  {
+    QJsonArray sliceArrays;
+    for(const VSImageArrayInfo& arrayInfo : m_SliceArrays)
+    {
+      sliceArrays.append(arrayInfo.toJson());
+    }
+
+    json["Slice Only"] = true;
+    json["Slice Arrays"] = sliceArrays;
+    json["Active Slice Array"] = m_ActiveSliceArray;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::readSliceJson(const QJsonObject& json)
+{
+  m_SliceOnly = true;
+  m_SliceArrays.clear();
+
+  QJsonArray sliceArrays = json["Slice Arrays"].toArray();
+  for(const QJsonValue& value : sliceArrays)
+  {
+    m_SliceArrays.push_back(VSImageArrayInfo::FromJson(value.toObject()));
+  }
+
+  m_ActiveSliceArray = json["Active Slice Array"].toString();
 }
 
 // -----------------------------------------------------------------------------
@@ -240,6 +428,9 @@ void VSSIMPLDataContainerFilter::reloadData()
 {
   QString dcName = m_WrappedDataContainer->m_Name;
 
+  // Reloading reads the final level directly
+  m_Refinement.m_Levels.clear();
+
   VSAbstractFilter* parentFilter = getParentFilter();
   VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(parentFilter);
   VSPipelineFilter* pipelineFilter = dynamic_cast<VSPipelineFilter*>(parentFilter);
@@ -248,6 +439,7 @@ void VSSIMPLDataContainerFilter::reloadData()
   {
     QString filePath = fileFilter->getFilePath();
 
+    QMutexLocker locker(&VSImageRegionReader::GetHDF5Lock());
     QSharedPointer<SIMPLH5DataReader> reader = QSharedPointer<SIMPLH5DataReader>(new SIMPLH5DataReader());
     connect(reader.data(), SIGNAL(errorGenerated(const QString&, const QString&, const int&)), this, SIGNAL(errorGenerated(const QString&, const QString&, const int&)));
 
@@ -270,9 +462,29 @@ void VSSIMPLDataContainerFilter::reloadData()
           DataArrayProxy::CompDimsVector compDimsVector;
 
           dcProxy.setFlags(Qt::Checked, amFlags, pFlags, compDimsVector);
+          if(m_SliceOnly)
+          {
+            // Slabs read before the file changed are no longer valid
+            VSImageRegionReader::UncheckCellArrays(dcProxy);
+            VSImageSlabCache::Instance()->clear(filePath);
+          }
           dcaProxy.dataContainers[dcProxy.name] = dcProxy;
 
-          DataContainerArray::Pointer dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+          DataContainerArray::Pointer dca = nullptr;
+          if(m_HasImageRegion)
+          {
+            QString errorMessage;
+            dca = VSImageRegionReader::ReadDataContainerArray(filePath, dcaProxy, m_ImageRegion, errorMessage);
+            if(nullptr == dca)
+            {
+              emit errorGenerated("Data Reload Error", errorMessage, -3005);
+              return;
+            }
+          }
+          else
+          {
+            dca = reader->readSIMPLDataUsingProxy(dcaProxy, false);
+          }
           DataContainer::Pointer dc = dca->getDataContainer(m_WrappedDataContainer->m_Name);
 
           m_WrappingWatcher.setFuture(QtConcurrent::run(this, &VSSIMPLDataContainerFilter::reloadData, dc));
@@ -345,6 +557,247 @@ void VSSIMPLDataContainerFilter::reloadData(DataContainer::Pointer dc)
   m_WrappedDataContainer = SIMPLVtkBridge::WrapDataContainerAsStruct(dc);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::hasImageRegion() const
+{
+  return m_HasImageRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSImageRegion VSSIMPLDataContainerFilter::getImageRegion() const
+{
+  return m_ImageRegion;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::setImageRegion(const VSImageRegion& region)
+{
+  m_ImageRegion = region;
+  m_HasImageRegion = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::expandImageRegion(const VSImageRegion& region)
+{
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(getParentFilter());
+  if(nullptr == fileFilter || false == m_HasImageRegion || m_Placeholder || isRefiningImageData())
+  {
+    QString ss = QObject::tr("The region of interest of Data Container '%1' can only be expanded for ImageGeoms read from a file.").arg(m_WrappedDataContainer->m_Name);
+    emit errorGenerated("Data Reload Error", ss, -3005);
+    return;
+  }
+  if(m_WrappingWatcher.isRunning())
+  {
+    return;
+  }
+
+  QString filePath = fileFilter->getFilePath();
+  DataContainer::Pointer dc = m_WrappedDataContainer->m_DataContainer;
+  m_WrappingWatcher.setFuture(QtConcurrent::run(this, &VSSIMPLDataContainerFilter::expandImageRegionData, filePath, dc, region));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::expandImageRegionData(QString filePath, DataContainer::Pointer dc, VSImageRegion region)
+{
+  QString errorMessage;
+  DataContainer::Pointer expandedDc = VSImageRegionReader::ExpandDataContainer(filePath, dc, m_ImageRegion, region, errorMessage);
+  if(nullptr == expandedDc)
+  {
+    emit errorGenerated("Data Reload Error", errorMessage, -3005);
+    return;
+  }
+
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = SIMPLVtkBridge::WrapDataContainerAsStruct(expandedDc);
+  if(nullptr == wrappedDc)
+  {
+    return;
+  }
+
+  SIMPLVtkBridge::FinishWrappingDataContainerStruct(wrappedDc);
+  m_WrappedDataContainer = wrappedDc;
+  m_ImageRegion = region;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::isRefiningImageData() const
+{
+  return m_RefiningFinalLevel || false == m_Refinement.m_Levels.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::refineImageData()
+{
+  if(m_Refinement.m_Levels.isEmpty() || m_WrappingWatcher.isRunning() || m_Placeholder)
+  {
+    return;
+  }
+
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(getParentFilter());
+  if(nullptr == fileFilter || nullptr == m_WrappedDataContainer)
+  {
+    m_Refinement.m_Levels.clear();
+    return;
+  }
+
+  // Intermediate levels only read the arrays already shown
+  VSImageRegion level = m_Refinement.m_Levels.takeFirst();
+  m_RefiningFinalLevel = m_Refinement.m_Levels.isEmpty();
+  DataContainerArrayProxy proxy = m_RefiningFinalLevel ? m_Refinement.m_Proxy : LoadedArrayProxy(m_Refinement.m_Proxy, m_WrappedDataContainer->m_DataContainer);
+
+  m_WrappingWatcher.setFuture(QtConcurrent::run(this, &VSSIMPLDataContainerFilter::readRefinedImageData, fileFilter->getFilePath(), proxy, level));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::readRefinedImageData(QString filePath, DataContainerArrayProxy proxy, VSImageRegion level)
+{
+  QMap<QString, VSImageRegion> regions;
+  regions[m_WrappedDataContainer->m_Name] = level;
+
+  QString errorMessage;
+  DataContainerArray::Pointer dca = VSImageRegionReader::ReadDataContainerArray(filePath, proxy, regions, errorMessage);
+
+  DataContainer::Pointer dc = dca ? dca->getDataContainer(m_WrappedDataContainer->m_Name) : nullptr;
+  SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc = dc ? SIMPLVtkBridge::WrapDataContainerAsStruct(dc) : nullptr;
+  if(nullptr == wrappedDc)
+  {
+    // The coarser level stays in place
+    emit errorGenerated("Data Import Error", errorMessage, -3006);
+    return;
+  }
+
+  SIMPLVtkBridge::FinishWrappingDataContainerStruct(wrappedDc);
+  m_WrappedDataContainer = wrappedDc;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::isSliceOnly() const
+{
+  return m_SliceOnly;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<VSImageArrayInfo> VSSIMPLDataContainerFilter::getSliceArrays() const
+{
+  return m_SliceArrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList VSSIMPLDataContainerFilter::getSliceArrayNames() const
+{
+  QStringList names;
+  for(const VSImageArrayInfo& arrayInfo : m_SliceArrays)
+  {
+    names.push_back(arrayInfo.m_Name);
+  }
+
+  return names;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString VSSIMPLDataContainerFilter::getActiveSliceArray() const
+{
+  return m_ActiveSliceArray;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSIMPLDataContainerFilter::setActiveSliceArray(const QString& arrayName)
+{
+  if(arrayName == m_ActiveSliceArray || false == getSliceArrayNames().contains(arrayName))
+  {
+    return;
+  }
+
+  m_ActiveSliceArray = arrayName;
+
+  // Child slices read the new array and report their own array names
+  emit sliceArrayChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSIMPLDataContainerFilter::createSlabRequest(const double origin[3], const double normal[3], VSImageSlabRequest& request) const
+{
+  VSFileNameFilter* fileFilter = dynamic_cast<VSFileNameFilter*>(getParentFilter());
+  vtkImageData* imageData = m_WrappedDataContainer ? vtkImageData::SafeDownCast(m_WrappedDataContainer->m_DataSet) : nullptr;
+  if(false == m_SliceOnly || m_Placeholder || nullptr == fileFilter || nullptr == imageData)
+  {
+    return false;
+  }
+
+  int arrayIndex = getSliceArrayNames().indexOf(m_ActiveSliceArray);
+  if(arrayIndex < 0)
+  {
+    return false;
+  }
+
+  // Slabs are read along the axis closest to the plane's normal
+  int axis = 0;
+  for(int i = 1; i < 3; i++)
+  {
+    if(std::abs(normal[i]) > std::abs(normal[axis]))
+    {
+      axis = i;
+    }
+  }
+
+  int pointDims[3];
+  imageData->GetDimensions(pointDims);
+
+  request.m_FilePath = fileFilter->getFilePath();
+  request.m_DataContainer = m_WrappedDataContainer->m_Name;
+  request.m_Array = m_SliceArrays[arrayIndex];
+  request.m_Axis = axis;
+  imageData->GetOrigin(request.m_Origin);
+  imageData->GetSpacing(request.m_Spacing);
+  for(int i = 0; i < 3; i++)
+  {
+    request.m_Dims[i] = pointDims[i] > 1 ? static_cast<size_t>(pointDims[i] - 1) : 1;
+  }
+
+  double position = 0.0;
+  if(request.m_Spacing[axis] > 0.0)
+  {
+    position = (origin[axis] - request.m_Origin[axis]) / request.m_Spacing[axis];
+  }
+  if(position <= 0.0)
+  {
+    request.m_Index = 0;
+  }
+  else
+  {
+    request.m_Index = std::min(static_cast<size_t>(position), request.m_Dims[axis] - 1);
+  }
+
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -366,8 +819,22 @@ void VSSIMPLDataContainerFilter::reloadWrappingFinished()
 
   m_TrivialProducer->SetOutput(dataSet);
 
+  // Children are marked dirty by the new output and only the displayed branches execute again
   emit updatedOutputPort(this);
   emit dataReloaded();
+
+  if(m_RefiningFinalLevel && false == m_WrappingWatcher.isRunning())
+  {
+    // The last level adds the arrays that were not read for the coarser levels
+    m_RefiningFinalLevel = false;
+    m_Refinement.m_Levels.clear();
+    emit arrayNamesChanged();
+    emit scalarNamesChanged();
+  }
+  else
+  {
+    refineImageData();
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -383,6 +850,15 @@ QString VSSIMPLDataContainerFilter::getFilterName() const
 // -----------------------------------------------------------------------------
 QString VSSIMPLDataContainerFilter::getToolTip() const
 {
+  if(false == m_LoadError.isEmpty())
+  {
+    return m_LoadError;
+  }
+  if(m_Placeholder)
+  {
+    return tr("%1 (Loading...)").arg(m_WrappedDataContainer->m_Name);
+  }
+
   return m_WrappedDataContainer->m_Name;
 }
 
@@ -391,6 +867,12 @@ QString VSSIMPLDataContainerFilter::getToolTip() const
 // -----------------------------------------------------------------------------
 void VSSIMPLDataContainerFilter::apply()
 {
+  // Placeholder data is replaced by setLoadedDataContainer once it has been read
+  if(m_Placeholder)
+  {
+    return;
+  }
+
   // finishWrapping aquires the apply lock and emits a signal that calls apply().
   // finishWrapping will not execute a second time until reaching the end of apply()
   // where the apply lock is released.
@@ -406,6 +888,11 @@ void VSSIMPLDataContainerFilter::apply()
 // -----------------------------------------------------------------------------
 bool VSSIMPLDataContainerFilter::finishWrapping()
 {
+  if(m_Placeholder)
+  {
+    return false;
+  }
+
   // Do not lock the main thread trying to apply a filter that is already being applied.
   if(m_ApplyLock.tryAcquire())
   {
@@ -43,6 +43,8 @@
 #include <vtkTrivialProducer.h>
 
 #include "SIMPLVtkLib/SIMPLBridge/SIMPLVtkBridge.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageRegionReader.h"
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageSlabCache.h"
 #include "SIMPLVtkLib/Visualization/VisualFilters/VSAbstractDataFilter.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
@@ -133,6 +135,34 @@ public:
    */
   static VSSIMPLDataContainerFilter* Create(const QString& filePath, QJsonObject& json, VSAbstractFilter* parent);
 
+  /**
+   * @brief Creates a SIMPLDataContainer filter from a json object without reading any data.
+   * The filter renders nothing until the DataContainer is passed to setLoadedDataContainer.
+   * @param json
+   * @param parent
+   * @return
+   */
+  static VSSIMPLDataContainerFilter* CreatePlaceholder(QJsonObject& json, VSAbstractFilter* parent);
+
+  /**
+   * @brief Returns true if the filter is still waiting for its DataContainer to be loaded
+   * @return
+   */
+  bool isPlaceholder() const;
+
+  /**
+   * @brief Replaces the placeholder data with a fully wrapped DataContainer.
+   * This method is not thread safe.
+   * @param wrappedDc
+   */
+  void setLoadedDataContainer(SIMPLVtkBridge::WrappedDataContainerPtr wrappedDc);
+
+  /**
+   * @brief Reports that the DataContainer for a placeholder filter could not be loaded
+   * @param message
+   */
+  void setLoadFailed(const QString& message);
+
   /**
    * @brief Writes values to a json file from the filter
    * @param json
@@ -150,6 +180,80 @@ public:
    */
   void reloadData(DataContainer::Pointer dc);
 
+  /**
+   * @brief Returns true if the ImageGeom was read with a region of interest instead of the full volume
+   * @return
+   */
+  bool hasImageRegion() const;
+
+  /**
+   * @brief Returns the region of interest the ImageGeom was read with
+   * @return
+   */
+  VSImageRegion getImageRegion() const;
+
+  /**
+   * @brief Sets the region of interest used when reading or reloading the ImageGeom from file.
+   * This does not read any data.
+   * @param region
+   */
+  void setImageRegion(const VSImageRegion& region);
+
+  /**
+   * @brief Expands the region of interest and reads the voxels not already in memory from the
+   * source file on a separate thread.  The filter output is replaced once the data has been read.
+   * @param region
+   */
+  void expandImageRegion(const VSImageRegion& region);
+
+  /**
+   * @brief Returns true while finer levels of a progressively imported ImageGeom are still being read
+   * @return
+   */
+  bool isRefiningImageData() const;
+
+  /**
+   * @brief Returns true if only the ImageGeom is kept in memory and its cell arrays are read
+   * from file one slab at a time by child slice filters
+   * @return
+   */
+  bool isSliceOnly() const;
+
+  /**
+   * @brief Returns the cell arrays that can be read from file in slice-only mode
+   * @return
+   */
+  QList<VSImageArrayInfo> getSliceArrays() const;
+
+  /**
+   * @brief Returns the names of the cell arrays that can be read from file in slice-only mode
+   * @return
+   */
+  QStringList getSliceArrayNames() const;
+
+  /**
+   * @brief Returns the name of the cell array read for slices in slice-only mode
+   * @return
+   */
+  QString getActiveSliceArray() const;
+
+  /**
+   * @brief Sets the cell array read for slices in slice-only mode
+   * @param arrayName
+   */
+  void setActiveSliceArray(const QString& arrayName);
+
+  /**
+   * @brief Fills in the slab of the active slice array containing the given plane.  Planes that
+   * are not perpendicular to an axis use the axis closest to their normal.  Returns false if the
+   * filter is not in slice-only mode.
+   * @param origin
+   * @param normal
+   * @param request
+   * @return
+   */
+  bool createSlabRequest(const double origin[3], const double normal[3], VSImageSlabRequest& request) const;
+
   /**
    * @brief Returns true if the data has been fully wrapped and loaded into a vtkDataSet. Returns false otherwise.
    * @return
@@ -176,8 +280,15 @@ public slots:
    */
   void reloadWrappingFinished();
 
+  /**
+   * @brief Starts reading the next level of a progressively imported ImageGeom on a separate thread.
+   * Does nothing if there are no levels left or data is already being read.
+   */
+  void refineImageData();
+
 signals:
   void finishedWrapping();
+  void sliceArrayChanged();
 
 protected:
   /**
@@ -185,6 +296,30 @@ protected:
    */
   void createFilter() override;
 
+  /**
+   * @brief Reads the expanded region of interest and wraps the DataContainer.  This method is
+   * run on a separate thread by expandImageRegion.
+   * @param filePath
+   * @param dc
+   * @param region
+   */
+  void expandImageRegionData(QString filePath, DataContainer::Pointer dc, VSImageRegion region);
+
+  /**
+   * @brief Reads and wraps the DataContainer for the given refinement level.  This method is run
+   * on a separate thread by refineImageData.
+   * @param filePath
+   * @param proxy
+   * @param level
+   */
+  void readRefinedImageData(QString filePath, DataContainerArrayProxy proxy, VSImageRegion level);
+
+  /**
+   * @brief Reads the slice-only values written by writeJson
+   * @param json
+   */
+  void readSliceJson(const QJsonObject& json);
+
 private:
   SIMPLVtkBridge::WrappedDataContainerPtr m_WrappedDataContainer = nullptr;
   VTK_PTR(vtkTrivialProducer) m_TrivialProducer = nullptr;
@@ -192,4 +327,13 @@ private:
   QSemaphore m_ApplyLock;
   bool m_WrappingTransform = false;
   bool m_FullyWrapped = false;
+  bool m_Placeholder = false;
+  QString m_LoadError;
+  VSImageRegion m_ImageRegion;
+  bool m_HasImageRegion = false;
+  VSImageRefinement m_Refinement;
+  bool m_RefiningFinalLevel = false;
+  bool m_SliceOnly = false;
+  QList<VSImageArrayInfo> m_SliceArrays;
+  QString m_ActiveSliceArray;
 };
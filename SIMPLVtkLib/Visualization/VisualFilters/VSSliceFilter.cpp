@@ -35,20 +35,31 @@
 
 #include "VSSliceFilter.h"
 
+#include <QtConcurrent>
 #include <QtCore/QJsonArray>
 #include <QtCore/QString>
 #include <QtCore/QUuid>
 
 #include <vtkDataArray.h>
 #include <vtkDataSet.h>
+#include <vtkImageData.h>
 #include <vtkUnstructuredGrid.h>
 
+#include "SIMPLVtkLib/Visualization/VisualFilters/VSSIMPLDataContainerFilter.h"
+
+namespace
+{
+const int SlabPrefetchDistance = 2;
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 VSSliceFilter::VSSliceFilter(VSAbstractFilter* parent)
 : VSAbstractFilter()
+, m_SlabWatcher(this)
 {
+  connect(&m_SlabWatcher, SIGNAL(finished()), this, SLOT(slabReadFinished()));
   m_SliceAlgorithm = nullptr;
   setParentFilter(parent);
 
@@ -59,6 +70,12 @@ VSSliceFilter::VSSliceFilter(VSAbstractFilter* parent)
   m_LastNormal[0] = 1.0;
   m_LastNormal[1] = 0.0;
   m_LastNormal[2] = 0.0;
+
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(parent);
+  if(dcFilter)
+  {
+    connect(dcFilter, &VSSIMPLDataContainerFilter::sliceArrayChanged, this, &VSSliceFilter::updateSliceArray);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -66,7 +83,9 @@ VSSliceFilter::VSSliceFilter(VSAbstractFilter* parent)
 // -----------------------------------------------------------------------------
 VSSliceFilter::VSSliceFilter(const VSSliceFilter& copy)
 : VSAbstractFilter()
+, m_SlabWatcher(this)
 {
+  connect(&m_SlabWatcher, SIGNAL(finished()), this, SLOT(slabReadFinished()));
   m_SliceAlgorithm = nullptr;
   setParentFilter(copy.getParentFilter());
 
@@ -75,6 +94,21 @@ VSSliceFilter::VSSliceFilter(const VSSliceFilter& copy)
     m_LastOrigin[i] = copy.m_LastOrigin[i];
     m_LastNormal[i] = copy.m_LastNormal[i];
   }
+
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(copy.getParentFilter());
+  if(dcFilter)
+  {
+    connect(dcFilter, &VSSIMPLDataContainerFilter::sliceArrayChanged, this, &VSSliceFilter::updateSliceArray);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+VSSliceFilter::~VSSliceFilter()
+{
+  // The reading thread writes to this filter's slab
+  m_SlabWatcher.waitForFinished();
 }
 
 // -----------------------------------------------------------------------------
@@ -160,7 +194,7 @@ void VSSliceFilter::apply(double origin[3], double normal[3])
   planeWidget->SetNormal(normal);
 
   m_SliceAlgorithm->SetCutFunction(planeWidget);
-  m_SliceAlgorithm->Update();
+  requestOutputUpdate();
 
   emit updatedOutputPort(this);
   emit lastOriginChanged();
@@ -225,7 +259,11 @@ void VSSliceFilter::writeJson(QJsonObject& json)
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSSliceFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_SliceAlgorithm)
+  if(hasCachedOutput())
+  {
+    return getCachedOutputPort();
+  }
+  else if(getConnectedInput() && m_SliceAlgorithm)
   {
     return m_SliceAlgorithm->GetOutputPort();
   }
@@ -242,7 +280,13 @@ vtkAlgorithmOutput* VSSliceFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSSliceFilter::getOutput() const
 {
-  if(getConnectedInput() && m_SliceAlgorithm)
+  updateDirtyOutput();
+
+  if(hasCachedOutput())
+  {
+    return getCachedOutput();
+  }
+  else if(getConnectedInput() && m_SliceAlgorithm)
   {
     return m_SliceAlgorithm->GetOutput();
   }
@@ -269,6 +313,13 @@ void VSSliceFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   if(getConnectedInput() && m_SliceAlgorithm)
   {
     m_SliceAlgorithm->SetInputConnection(filter->getOutputPort());
+    m_SlabInput = false;
+
+    // Children reconnect to the algorithm once the stored output no longer matches the input
+    if(releaseStaleCachedOutput())
+    {
+      emit updatedOutputPort(this);
+    }
   }
   else
   {
@@ -276,6 +327,209 @@ void VSSliceFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::executeOutput()
+{
+  if(nullptr == m_SliceAlgorithm)
+  {
+    return;
+  }
+
+  // Slice-only ImageGeoms are cut from a single slab read from file instead of the parent's output
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(getParentFilter());
+  VSImageSlabRequest request;
+  if(dcFilter && dcFilter->createSlabRequest(m_LastOrigin, m_LastNormal, request))
+  {
+    executeSlabOutput(request);
+    return;
+  }
+
+  if(m_SlabInput)
+  {
+    restoreParentInput();
+  }
+
+  if(false == restoreCachedOutput())
+  {
+    m_SliceAlgorithm->Update();
+    storeCachedOutput();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::executeSlabOutput(const VSImageSlabRequest& request)
+{
+  VTK_PTR(vtkImageData) slab = VSImageSlabCache::Instance()->findSlab(request);
+  if(slab)
+  {
+    cutSlab(request, slab);
+    return;
+  }
+
+  // The latest position is requested again once the current read finishes
+  if(m_SlabWatcher.isRunning())
+  {
+    return;
+  }
+
+  m_SlabWatcher.setFuture(QtConcurrent::run(this, &VSSliceFilter::readSlab, request));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::readSlab(VSImageSlabRequest request)
+{
+  m_SlabRequest = request;
+  m_SlabError.clear();
+  m_ReadSlab = VSImageSlabCache::Instance()->getSlab(request, m_SlabError);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::slabReadFinished()
+{
+  VTK_PTR(vtkImageData) slab = m_ReadSlab;
+  m_ReadSlab = nullptr;
+  if(nullptr == m_SliceAlgorithm)
+  {
+    return;
+  }
+
+  // The slice moved while reading, so the new position is cut from the cache or read next
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(getParentFilter());
+  VSImageSlabRequest request;
+  if(nullptr == dcFilter || false == dcFilter->createSlabRequest(m_LastOrigin, m_LastNormal, request) || request.getKey() != m_SlabRequest.getKey())
+  {
+    requestOutputUpdate();
+    if(false == m_SlabWatcher.isRunning())
+    {
+      emit updatedOutputPort(this);
+    }
+    return;
+  }
+
+  if(nullptr == slab)
+  {
+    // Fall back to cutting the geometry without any values
+    restoreParentInput();
+    m_SliceAlgorithm->Update();
+    emit errorGenerated("Slice Read Error", m_SlabError, -3007);
+  }
+  else
+  {
+    cutSlab(m_SlabRequest, slab);
+  }
+
+  emit updatedOutputPort(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::cutSlab(const VSImageSlabRequest& request, VTK_PTR(vtkImageData) slab)
+{
+  VSImageSlabCache* slabCache = VSImageSlabCache::Instance();
+  if(nullptr == m_SlabProducer)
+  {
+    m_SlabProducer = VTK_PTR(vtkTrivialProducer)::New();
+  }
+  m_SlabProducer->SetOutput(slab);
+  m_SliceAlgorithm->SetInputConnection(m_SlabProducer->GetOutputPort());
+  m_SlabInput = true;
+
+  // The slab is a single voxel thick, so the plane is cut through its center along the slab's axis
+  int axis = request.m_Axis;
+  double origin[3] = {m_LastOrigin[0], m_LastOrigin[1], m_LastOrigin[2]};
+  double normal[3] = {0.0, 0.0, 0.0};
+  origin[axis] = request.m_Origin[axis] + (request.m_Index + 0.5) * request.m_Spacing[axis];
+  normal[axis] = m_LastNormal[axis] < 0.0 ? -1.0 : 1.0;
+
+  VTK_NEW(vtkPlane, slabPlane);
+  slabPlane->SetOrigin(origin);
+  slabPlane->SetNormal(normal);
+  m_SliceAlgorithm->SetCutFunction(slabPlane);
+  m_SliceAlgorithm->Update();
+
+  // Moving the plane usually continues in the same direction
+  for(int offset = 1; offset <= SlabPrefetchDistance; offset++)
+  {
+    if(request.m_Index + offset < request.m_Dims[axis])
+    {
+      slabCache->prefetch(request.withIndex(request.m_Index + offset));
+    }
+    if(request.m_Index >= static_cast<size_t>(offset))
+    {
+      slabCache->prefetch(request.withIndex(request.m_Index - offset));
+    }
+  }
+
+  if(m_SlabArrayName != request.m_Array.m_Name)
+  {
+    m_SlabArrayName = request.m_Array.m_Name;
+    emit arrayNamesChanged();
+    emit scalarNamesChanged();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::restoreParentInput()
+{
+  if(getParentFilter())
+  {
+    m_SliceAlgorithm->SetInputConnection(getParentFilter()->getOutputPort());
+  }
+
+  VTK_NEW(vtkPlane, plane);
+  plane->SetOrigin(m_LastOrigin);
+  plane->SetNormal(m_LastNormal);
+  m_SliceAlgorithm->SetCutFunction(plane);
+  m_SlabInput = false;
+
+  if(false == m_SlabArrayName.isEmpty())
+  {
+    m_SlabArrayName.clear();
+    emit arrayNamesChanged();
+    emit scalarNamesChanged();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSSliceFilter::updateSliceArray()
+{
+  if(nullptr == m_SliceAlgorithm)
+  {
+    return;
+  }
+
+  requestOutputUpdate();
+  emit updatedOutputPort(this);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSSliceFilter::canCacheOutput() const
+{
+  // Slabs are already kept by the slab cache
+  VSSIMPLDataContainerFilter* dcFilter = dynamic_cast<VSSIMPLDataContainerFilter*>(getParentFilter());
+  if(dcFilter && dcFilter->isSliceOnly())
+  {
+    return false;
+  }
+
+  return getConnectedInput() && m_SliceAlgorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -35,12 +35,16 @@
 
 #pragma once
 
+#include <QtCore/QFutureWatcher>
 #include <QtWidgets/QWidget>
 
 #include "Visualization/VisualFilters/VSAbstractFilter.h"
 
 #include <vtkCutter.h>
 #include <vtkPlane.h>
+#include <vtkTrivialProducer.h>
+
+#include "SIMPLVtkLib/Visualization/Controllers/VSImageSlabCache.h"
 
 #include "SIMPLVtkLib/SIMPLVtkLib.h"
 
@@ -74,7 +78,7 @@ public:
   /**
    * @brief Deconstructor
    */
-  virtual ~VSSliceFilter() = default;
+  virtual ~VSSliceFilter();
 
   /**
    * @brief Create
@@ -198,6 +202,12 @@ public:
    */
   void writeJson(QJsonObject& json) override;
 
+  /**
+   * @brief Returns true if the filter has applied its own output
+   * @return
+   */
+  bool canCacheOutput() const override;
+
   /**
    * @brief getUuid
    * @return
@@ -220,8 +230,57 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Updates the algorithm unless a stored output matches the applied values
+   */
+  void executeOutput() override;
+
+  /**
+   * @brief Cuts the slab for a slice-only parent if it is cached.  Otherwise the slab is read on
+   * a background thread and the previous slice is kept until it arrives.
+   * @param request
+   */
+  void executeSlabOutput(const VSImageSlabRequest& request);
+
+  /**
+   * @brief Cuts the slab and prefetches the neighbouring slabs
+   * @param request
+   * @param slab
+   */
+  void cutSlab(const VSImageSlabRequest& request, VTK_PTR(vtkImageData) slab);
+
+  /**
+   * @brief Reads the requested slab.  This method is run on a separate thread.
+   * @param request
+   */
+  void readSlab(VSImageSlabRequest request);
+
+  /**
+   * @brief Connects the algorithm back to the parent's output after cutting a slab
+   */
+  void restoreParentInput();
+
+protected slots:
+  /**
+   * @brief Reads the slab of the parent's new slice array
+   */
+  void updateSliceArray();
+
+  /**
+   * @brief This slot is called when a slab is finished being read on a separate thread.  If the
+   * slice moved while it was read, the slab for the new position is requested instead.
+   */
+  void slabReadFinished();
+
 private:
   VTK_PTR(vtkCutter) m_SliceAlgorithm;
+  VTK_PTR(vtkTrivialProducer) m_SlabProducer = nullptr;
+  bool m_SlabInput = false;
+  QString m_SlabArrayName;
+  QFutureWatcher<void> m_SlabWatcher;
+  VSImageSlabRequest m_SlabRequest;
+  VTK_PTR(vtkImageData) m_ReadSlab = nullptr;
+  QString m_SlabError;
 
   double m_LastOrigin[3];
   double m_LastNormal[3];
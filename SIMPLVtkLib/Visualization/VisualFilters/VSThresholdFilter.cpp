@@ -146,7 +146,7 @@ void VSThresholdFilter::apply(QString arrayName, double min, double max)
 
   m_ThresholdAlgorithm->ThresholdBetween(min, max);
   m_ThresholdAlgorithm->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, qPrintable(arrayName));
-  m_ThresholdAlgorithm->Update();
+  requestOutputUpdate();
 
   emit updatedOutputPort(this);
   emit lastArrayNameChanged();
@@ -187,7 +187,11 @@ QUuid VSThresholdFilter::GetUuid()
 // -----------------------------------------------------------------------------
 vtkAlgorithmOutput* VSThresholdFilter::getOutputPort()
 {
-  if(getConnectedInput() && m_ThresholdAlgorithm)
+  if(hasCachedOutput())
+  {
+    return getCachedOutputPort();
+  }
+  else if(getConnectedInput() && m_ThresholdAlgorithm)
   {
     return m_ThresholdAlgorithm->GetOutputPort();
   }
@@ -204,7 +208,13 @@ vtkAlgorithmOutput* VSThresholdFilter::getOutputPort()
 // -----------------------------------------------------------------------------
 VTK_PTR(vtkDataSet) VSThresholdFilter::getOutput() const
 {
-  if(getConnectedInput() && m_ThresholdAlgorithm)
+  updateDirtyOutput();
+
+  if(hasCachedOutput())
+  {
+    return getCachedOutput();
+  }
+  else if(getConnectedInput() && m_ThresholdAlgorithm)
   {
     return m_ThresholdAlgorithm->GetOutput();
   }
@@ -231,6 +241,12 @@ void VSThresholdFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   if(getConnectedInput() && m_ThresholdAlgorithm)
   {
     m_ThresholdAlgorithm->SetInputConnection(filter->getOutputPort());
+
+    // Children reconnect to the algorithm once the stored output no longer matches the input
+    if(releaseStaleCachedOutput())
+    {
+      emit updatedOutputPort(this);
+    }
   }
   else
   {
@@ -238,6 +254,31 @@ void VSThresholdFilter::updateAlgorithmInput(VSAbstractFilter* filter)
   }
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VSThresholdFilter::executeOutput()
+{
+  if(nullptr == m_ThresholdAlgorithm)
+  {
+    return;
+  }
+
+  if(false == restoreCachedOutput())
+  {
+    m_ThresholdAlgorithm->Update();
+    storeCachedOutput();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool VSThresholdFilter::canCacheOutput() const
+{
+  return getConnectedInput() && m_ThresholdAlgorithm;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -192,6 +192,12 @@ public:
    */
   void writeJson(QJsonObject& json) override;
 
+  /**
+   * @brief Returns true if the filter has applied its own output
+   * @return
+   */
+  bool canCacheOutput() const override;
+
   /**
    * @brief getUuid
    * @return
@@ -215,6 +221,11 @@ protected:
    */
   void updateAlgorithmInput(VSAbstractFilter* filter) override;
 
+  /**
+   * @brief Updates the algorithm unless a stored output matches the applied values
+   */
+  void executeOutput() override;
+
 private:
   VTK_PTR(vtkThreshold) m_ThresholdAlgorithm;
 